@@ -4,6 +4,7 @@
 #include "MantidAPI/IBoxControllerIO.h"
 #include "MantidKernel/DiskBuffer.h"
 #include "MantidKernel/Exception.h"
+#include "MantidKernel/SlabAllocator.h"
 #include "MantidKernel/System.h"
 #include "MantidKernel/ThreadPool.h"
 #include <nexus/NeXusFile.hpp>
@@ -35,7 +36,8 @@ public:
   BoxController(size_t nd)
       : nd(nd), m_maxId(0), m_SplitThreshold(1024), m_splitTopInto(boost::none),
         m_numSplit(1), m_numTopSplit(1),
-        m_fileIO(boost::shared_ptr<API::IBoxControllerIO>()) {
+        m_fileIO(boost::shared_ptr<API::IBoxControllerIO>()),
+        m_boxAllocator(new Kernel::SlabAllocator()) {
     // TODO: Smarter ways to determine all of these values
     m_maxDepth = 5;
     m_numEventsAtMax = 0;
@@ -249,6 +251,11 @@ public:
    * would be a slow-down, but keeping the boxes split at an earlier stage
    * should help scalability for later adding, so there is a balance to get.
    *
+   * For a file-backed workspace splitting also hands the boxes that received
+   * events to the disk buffer, so the boxes are split at least every time as
+   * many events as fit in the write buffer have been added. This keeps the
+   * events held in memory within the write buffer size.
+   *
    * @param nEventsInOutput :: How many events are currently in workspace in
    *memory;
    * @param eventsAdded     :: How many events were added since the last split?
@@ -261,6 +268,12 @@ public:
     // Avoid divide by zero
     if (numMDBoxes == 0)
       return false;
+    // Spill the added events to the file before they exceed the write buffer
+    if (m_fileIO) {
+      const uint64_t writeBufferSize = m_fileIO->getWriteBufferSize();
+      if (writeBufferSize > 0 && eventsAdded >= writeBufferSize)
+        return true;
+    }
     // Performance depends pretty strongly on WHEN you split the boxes.
     // This is an empirically-determined way to optimize the splitting calls.
     // Split when adding 1/16^th as many events as are already in the output,
@@ -388,6 +401,10 @@ public:
   /// based workspaces
   bool useWriteBuffer() const;
 
+  /// @return the allocator for the boxes of the workspace. Boxes created with
+  /// new (boxController) MDBox<...>(...) are allocated from it.
+  Kernel::SlabAllocator &getBoxAllocator() const { return *m_boxAllocator; }
+
 private:
   /// When you split a MDBox, it becomes this many sub-boxes
   void calcNumSplit() {
@@ -499,6 +516,9 @@ private:
   // the class which does actual IO operations, including MRU support list
   boost::shared_ptr<IBoxControllerIO> m_fileIO;
 
+  /// Memory for the boxes of the workspace, released with the box controller
+  Kernel::SlabAllocator *m_boxAllocator;
+
   /// Number of bytes in a single MDLeanEvent<> of the workspace.
   // size_t m_bytesPerEvent;
 public:
@@ -34,6 +34,10 @@ public:
   virtual CoordTransform *clone() const = 0;
   virtual std::string id() const = 0;
 
+  /// Apply to a block of coordinates stored by dimension
+  virtual void applyMany(const coord_t *inputCoords, coord_t *outCoords,
+                         const size_t count) const;
+
   /// Wrapper for VMD
   Mantid::Kernel::VMD applyVMD(const Mantid::Kernel::VMD &inputVector) const;
 
@@ -10,7 +10,7 @@ namespace Mantid {
 namespace API {
 
 /// What kind of event list is being stored
-enum EventType { TOF, WEIGHTED, WEIGHTED_NOTIME };
+enum EventType { TOF, WEIGHTED, WEIGHTED_NOTIME, COMPACT_WEIGHTED_NOTIME };
 
 /** IEventList : Interface to Mantid::DataObjects::EventList class, used to
  * expose to PythonAPI
@@ -174,6 +174,12 @@ public:
    * events
    */
   virtual void setEventsData(const std::vector<coord_t> &coordTable) = 0;
+  /** The method to convert the table of data into events appended to the
+   * events already in the node
+   *   @param coordTable -- vector of events data, which would be packed into
+   * events
+   */
+  virtual void addEventsData(const std::vector<coord_t> &coordTable) = 0;
 
   /// Add a single event defined by its components
   virtual void buildAndAddEvent(const signal_t Signal, const signal_t errorSq,
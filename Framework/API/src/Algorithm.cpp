@@ -17,6 +17,7 @@
 #include "MantidKernel/PropertyWithValue.h"
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/Timer.h"
+#include "MantidKernel/TraceRecorder.h"
 #include "MantidKernel/UsageService.h"
 
 #include "MantidParallel/Communicator.h"
@@ -440,6 +441,8 @@ void Algorithm::unlockWorkspaces() {
  *  @return true if executed successfully.
  */
 bool Algorithm::execute() {
+  TraceRecorderImpl::Scope trace(name(),
+                                 isChild() ? "child algorithm" : "algorithm");
   Timer timer;
   AlgorithmManager::Instance().notifyAlgorithmStarting(this->getAlgorithmID());
   {
@@ -46,7 +46,8 @@ BoxController::BoxController(const BoxController &other)
       m_numMDBoxes(other.m_numMDBoxes),
       m_numMDGridBoxes(other.m_numMDGridBoxes),
       m_maxNumMDBoxes(other.m_maxNumMDBoxes),
-      m_fileIO(boost::shared_ptr<API::IBoxControllerIO>()) {}
+      m_fileIO(boost::shared_ptr<API::IBoxControllerIO>()),
+      m_boxAllocator(new Kernel::SlabAllocator()) {}
 
 bool BoxController::operator==(const BoxController &other) const {
   if (nd != other.nd || m_maxId != other.m_maxId ||
@@ -109,6 +110,8 @@ BoxController::~BoxController() {
     m_fileIO->closeFile();
     m_fileIO.reset();
   }
+  // Any boxes still alive keep the memory until they are deleted
+  m_boxAllocator->release();
 }
 /**reserve range of id-s for use on set of adjacent boxes.
  * Needed to be thread safe as adjacent boxes have to have subsequent ID-s
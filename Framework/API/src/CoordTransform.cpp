@@ -7,6 +7,8 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/format.hpp>
 
+#include <vector>
+
 using namespace Mantid::Geometry;
 using namespace Mantid::Kernel;
 
@@ -52,5 +54,30 @@ CoordTransform::applyVMD(const Mantid::Kernel::VMD &inputVector) const {
   return out;
 }
 
+//----------------------------------------------------------------------------------------------
+/** Apply the transformation to a block of coordinates. The coordinates are
+ * stored by dimension: the count values of the first dimension, then the
+ * count values of the second, and so on. Subclasses override this with loops
+ * over each dimension that the compiler can vectorize.
+ *
+ * This default implementation calls apply() on each coordinate in turn.
+ *
+ * @param inputCoords :: inD * count input values, by dimension
+ * @param outCoords :: outD * count output values, by dimension
+ * @param count :: number of coordinates to transform
+ */
+void CoordTransform::applyMany(const coord_t *inputCoords, coord_t *outCoords,
+                               const size_t count) const {
+  std::vector<coord_t> in(inD);
+  std::vector<coord_t> out(outD);
+  for (size_t i = 0; i < count; ++i) {
+    for (size_t d = 0; d < inD; ++d)
+      in[d] = inputCoords[d * count + i];
+    this->apply(in.data(), out.data());
+    for (size_t d = 0; d < outD; ++d)
+      outCoords[d * count + i] = out[d];
+  }
+}
+
 } // namespace API
 } // namespace Mantid
@@ -221,6 +221,7 @@ std::tuple<bool, size_t> DetectorSearcher::checkInteceptWithNeighbours(
     const auto &det = m_detInfo.detector(m_indexMap[index]);
 
     Mantid::Geometry::BoundingBox bb;
+    det.getBoundingBox(bb);
     if (!bb.doesLineIntersect(track))
       continue;
 
@@ -1363,8 +1363,8 @@ void ExperimentInfo::setInstumentFromXML(const std::string &nxFilename,
       // If it does, just use the one from the one stored there
       instr = InstrumentDataService::Instance().retrieve(instrumentNameMangled);
     } else {
-      // Really create the instrument
-      instr = parser.parseXML(nullptr);
+      // Really create the instrument, or read it from the instrument cache
+      instr = parser.parseXMLOrReadCache(nullptr);
       // Add to data service for later retrieval
       InstrumentDataService::Instance().add(instrumentNameMangled, instr);
     }
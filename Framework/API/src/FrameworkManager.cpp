@@ -9,6 +9,7 @@
 #include "MantidKernel/Memory.h"
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/PropertyManagerDataService.h"
+#include "MantidKernel/TraceRecorder.h"
 #include "MantidKernel/UsageService.h"
 
 #include <boost/algorithm/string/split.hpp>
@@ -188,6 +189,7 @@ void FrameworkManagerImpl::clear() {
 
 void FrameworkManagerImpl::shutdown() {
   Kernel::UsageService::Instance().shutdown();
+  Kernel::TraceRecorder::Instance().shutdown();
   clear();
 }
 
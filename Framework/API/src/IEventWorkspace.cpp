@@ -19,6 +19,9 @@ const std::string IEventWorkspace::toString() const {
   case WEIGHTED_NOTIME:
     os << " (weighted, no times)\n";
     break;
+  case COMPACT_WEIGHTED_NOTIME:
+    os << " (weighted, no times, single precision)\n";
+    break;
   case TOF:
     os << "\n";
     break;
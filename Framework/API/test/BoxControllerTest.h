@@ -34,6 +34,25 @@ public:
     TS_ASSERT(!sc.willSplit(100, 5));
   }
 
+  void test_shouldSplitBoxes() {
+    BoxController sc(2);
+    sc.setSplitThreshold(10);
+    TS_ASSERT(!sc.shouldSplitBoxes(1000, 100, 0));
+    TS_ASSERT(!sc.shouldSplitBoxes(1000, 100, 20));
+    TS_ASSERT(sc.shouldSplitBoxes(1000, 300, 20));
+  }
+
+  void test_shouldSplitBoxes_when_file_backed_write_buffer_is_full() {
+    auto sc = boost::make_shared<BoxController>(2);
+    sc->setSplitThreshold(10);
+    boost::shared_ptr<IBoxControllerIO> pS(
+        new MantidTestHelpers::BoxControllerDummyIO(sc.get()));
+    sc->setFileBacked(pS, "fakeFile");
+    sc->getFileIO()->setWriteBufferSize(50);
+    TS_ASSERT(!sc->shouldSplitBoxes(1000, 49, 20));
+    TS_ASSERT(sc->shouldSplitBoxes(1000, 50, 20));
+  }
+
   void test_getSplitInto() {
     BoxController sc(3);
     sc.setSplitInto(10);
@@ -118,6 +118,14 @@ protected:
   convertQuickly(API::MatrixWorkspace_const_sptr inputWS, const double &factor,
                  const double &power);
 
+  /// Detector specific values of a spectrum used in the conversion
+  struct DetectorValues {
+    bool valid{false}; ///< Whether the values could be found
+    double efixed{0.0};
+    double l2{0.0};
+    double twoTheta{0.0};
+  };
+
   /// Internal function to gather detector specific L2, theta and efixed values
   bool getDetectorValues(const API::SpectrumInfo &spectrumInfo,
                          const Kernel::Unit &outputUnit, int emode,
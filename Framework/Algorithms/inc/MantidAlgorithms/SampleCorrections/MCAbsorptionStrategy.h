@@ -4,6 +4,7 @@
 #include "MantidAlgorithms/DllConfig.h"
 #include "MantidAlgorithms/SampleCorrections/MCInteractionVolume.h"
 #include <tuple>
+#include <vector>
 
 namespace Mantid {
 namespace API {
@@ -25,6 +26,10 @@ class IBeamProfile;
   The error on all points is defined to be \f$\frac{1}{\sqrt{N}}\f$, where N is
   the number of events generated.
 
+  Corrections for several wavelengths can be computed in one pass: each
+  generated track is then used for every wavelength point, so the geometry
+  is only traced once per event rather than once per event and wavelength.
+
   Copyright &copy; 2016 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
   National Laboratory & European Spallation Source
 
@@ -55,6 +60,11 @@ public:
                                        const Kernel::V3D &finalPos,
                                        double lambdaBefore,
                                        double lambdaAfter) const;
+  void calculate(Kernel::PseudoRandomNumberGenerator &rng,
+                 const Kernel::V3D &finalPos,
+                 const std::vector<double> &lambdasBefore,
+                 const std::vector<double> &lambdasAfter,
+                 std::vector<double> &attenuationFactors) const;
 
 private:
   const IBeamProfile &m_beamProfile;
@@ -150,7 +150,8 @@ void CalculateCountRate::exec() {
 
   DataObjects::EventWorkspace_sptr sourceWS = getProperty("Workspace");
   API::EventType et = sourceWS->getEventType();
-  if (et == API::EventType::WEIGHTED_NOTIME) {
+  if (et == API::EventType::WEIGHTED_NOTIME ||
+      et == API::EventType::COMPACT_WEIGHTED_NOTIME) {
     throw std::runtime_error("Event workspace " + sourceWS->getName() +
                              " contains events without necessary frame "
                              "information. Can not process counting rate");
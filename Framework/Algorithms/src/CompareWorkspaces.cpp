@@ -51,6 +51,12 @@ getEventVector(const EventList &el) {
   return el.getWeightedEventsNoTime();
 }
 
+template <>
+const std::vector<DataObjects::CompactWeightedEventNoTime> &
+getEventVector(const EventList &el) {
+  return el.getCompactWeightedEventsNoTime();
+}
+
 template <class ET>
 int compareEventLists(Kernel::Logger &logger, const EventList &el1,
                       const EventList &el2, double tolTof, double tolWeight,
@@ -1004,6 +1010,10 @@ int CompareWorkspaces::compareEventsListInDetails(
     return compareEventLists<DataObjects::WeightedEventNoTime>(
         g_log, el1, el2, tolTof, tolWeight, tolPulse, printdetails,
         numdiffpulse, numdifftof, numdiffboth, numdiffweight);
+  case EventType::COMPACT_WEIGHTED_NOTIME:
+    return compareEventLists<DataObjects::CompactWeightedEventNoTime>(
+        g_log, el1, el2, tolTof, tolWeight, tolPulse, printdetails,
+        numdiffpulse, numdifftof, numdiffboth, numdiffweight);
   default:
     throw std::runtime_error("Cannot compare event lists: unknown event type.");
   }
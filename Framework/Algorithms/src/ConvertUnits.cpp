@@ -540,45 +540,70 @@ ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUnit,
   assert(static_cast<bool>(eventWS) == m_inputEvents); // Sanity check
 
   auto &outSpectrumInfo = outputWS->mutableSpectrumInfo();
-  // Loop over the histograms (detector spectra)
+  // Look up the detector values of all spectra first, so that the spectra
+  // can then be converted in parallel
+  std::vector<DetectorValues> detectorValues(m_numberOfSpectra);
   for (int64_t i = 0; i < numberOfSpectra_i; ++i) {
-    double efixed = efixedProp;
+    auto &values = detectorValues[i];
+    values.efixed = efixedProp;
+    values.valid = getDetectorValues(outSpectrumInfo, *outputUnit, emode,
+                                     *outputWS, signedTheta, i, values.efixed,
+                                     values.l2, values.twoTheta);
+    if (!values.valid) {
+      // Get to here if exception thrown when calculating distance to detector
+      failedDetectorCount++;
+      if (outSpectrumInfo.hasDetectors(i))
+        outSpectrumInfo.setMasked(i, true);
+    }
+  }
 
-    // Now get the detector object for this histogram
-    double l2;
-    double twoTheta;
-    if (getDetectorValues(outSpectrumInfo, *outputUnit, emode, *outputWS,
-                          signedTheta, i, efixed, l2, twoTheta)) {
+  // The units are initialized for each spectrum, so each thread needs its
+  // own copies
+  std::vector<std::unique_ptr<Unit>> threadFromUnits;
+  std::vector<std::unique_ptr<Unit>> threadOutputUnits;
+  for (int thread = 0; thread < PARALLEL_GET_MAX_THREADS; ++thread) {
+    threadFromUnits.emplace_back(fromUnit->clone());
+    threadOutputUnits.emplace_back(outputUnit->clone());
+  }
+  const std::string progressMessage = "Convert to " + m_outputUnit->unitID();
+
+  // Loop over the histograms (detector spectra)
+  PARALLEL_FOR_IF(Kernel::threadSafe(*outputWS))
+  for (int64_t i = 0; i < numberOfSpectra_i; ++i) {
+    PARALLEL_START_INTERUPT_REGION
+    const auto &values = detectorValues[i];
+    if (values.valid) {
+      Unit &localFrom = *threadFromUnits[PARALLEL_THREAD_NUMBER];
+      Unit &localOutput = *threadOutputUnits[PARALLEL_THREAD_NUMBER];
+      std::vector<double> emptyY;
 
       /// @todo Don't yet consider hold-off (delta)
       const double delta = 0.0;
 
       // TODO toTOF and fromTOF need to be reimplemented outside of kernel
-      localFromUnit->toTOF(outputWS->dataX(i), emptyVec, l1, l2, twoTheta,
-                           emode, efixed, delta);
+      localFrom.toTOF(outputWS->dataX(i), emptyY, l1, values.l2,
+                      values.twoTheta, emode, values.efixed, delta);
       // Convert from time-of-flight to the desired unit
-      localOutputUnit->fromTOF(outputWS->dataX(i), emptyVec, l1, l2, twoTheta,
-                               emode, efixed, delta);
+      localOutput.fromTOF(outputWS->dataX(i), emptyY, l1, values.l2,
+                          values.twoTheta, emode, values.efixed, delta);
 
-      // EventWorkspace part, modifying the EventLists.
+      // EventWorkspace part, modifying the EventLists. The units have been
+      // initialized for this spectrum by the conversion of the X values.
       if (m_inputEvents) {
-        eventWS->getSpectrum(i).convertUnitsViaTof(localFromUnit.get(),
-                                                   localOutputUnit.get());
+        eventWS->getSpectrum(i).convertUnitsViaTof(&localFrom, &localOutput);
       }
     } else {
-      // Get to here if exception thrown when calculating distance to detector
-      failedDetectorCount++;
       // Since you usually (always?) get to here when there's no attached
       // detectors, this call is
       // the same as just zeroing out the data (calling clearData on the
       // spectrum)
       outputWS->getSpectrum(i).clearData();
-      if (outSpectrumInfo.hasDetectors(i))
-        outSpectrumInfo.setMasked(i, true);
     }
 
-    prog.report("Convert to " + m_outputUnit->unitID());
+    prog.report(progressMessage);
+    PARALLEL_END_INTERUPT_REGION
   } // loop over spectra
+  PARALLEL_CHECK_INTERUPT_REGION
 
   if (failedDetectorCount != 0) {
     g_log.information() << "Unable to calculate sample-detector distance for "
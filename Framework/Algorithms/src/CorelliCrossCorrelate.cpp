@@ -92,7 +92,8 @@ std::map<std::string, std::string> CorelliCrossCorrelate::validateInputs() {
     errors["InputWorkspace"] = "The workspace needs to be a sorted.";
 
   // Check event type for pulse times
-  else if (inputWS->getEventType() == WEIGHTED_NOTIME)
+  else if (inputWS->getEventType() == WEIGHTED_NOTIME ||
+           inputWS->getEventType() == COMPACT_WEIGHTED_NOTIME)
     errors["InputWorkspace"] = "This workspace has no pulse time information.";
 
   return errors;
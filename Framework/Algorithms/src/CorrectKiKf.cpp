@@ -256,6 +256,11 @@ void CorrectKiKf::execEvent() {
       correctKiKfEventHelper(evlist.getWeightedEventsNoTime(), efixed,
                              emodeStr);
       break;
+
+    case COMPACT_WEIGHTED_NOTIME:
+      correctKiKfEventHelper(evlist.getCompactWeightedEventsNoTime(), efixed,
+                             emodeStr);
+      break;
     }
 
     prog.report();
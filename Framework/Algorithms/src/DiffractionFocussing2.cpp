@@ -13,6 +13,7 @@
 #include "MantidHistogramData/LogarithmicGenerator.h"
 #include "MantidIndexing/Group.h"
 #include "MantidIndexing/IndexInfo.h"
+#include "MantidKernel/PerThread.h"
 #include "MantidKernel/VectorHelper.h"
 
 #include <cfloat>
@@ -386,6 +387,11 @@ void DiffractionFocussing2::execEvent() {
 
     int chunkSize = 200;
 
+    // Each thread accumulates its chunks in its own blank EventList
+    EventList blankEL;
+    blankEL.switchTo(eventWtype);
+    PerThread<EventList> threadEL(blankEL);
+
     int end = (totalHistProcess / chunkSize) + 1;
     // cppcheck-suppress syntaxError
     PRAGMA_OMP(parallel for schedule(dynamic, 1) )
@@ -397,26 +403,21 @@ void DiffractionFocussing2::execEvent() {
       if (max > totalHistProcess)
         max = totalHistProcess;
 
-      // Make a blank EventList that will accumulate the chunk.
-      EventList chunkEL;
-      chunkEL.switchTo(eventWtype);
-      // chunkEL.reserve(numEventsInChunk);
-
       // process the chunk
+      auto &chunkEL = threadEL.local();
       for (int i = wiChunk * chunkSize; i < max; i++) {
         // Accumulate the chunk
         size_t wi = indices[i];
         chunkEL += m_eventW->getSpectrum(wi);
       }
 
-      // Rejoin the chunk with the rest.
-      PARALLEL_CRITICAL(DiffractionFocussing2_JoinChunks) {
-        groupEL += chunkEL;
-      }
-
       PARALLEL_END_INTERUPT_REGION
     }
     PARALLEL_CHECK_INTERUPT_REGION
+
+    // Rejoin the chunks with the rest.
+    for (const auto &chunkEL : threadEL)
+      groupEL += chunkEL;
   } else {
     // ------ PARALLELIZE BY GROUPS -------------------------
 
@@ -212,6 +212,11 @@ void ExtractSpectra::execEvent() {
       filterEventsHelper(el.getWeightedEventsNoTime(), minX_val, maxX_val);
       break;
     }
+    case COMPACT_WEIGHTED_NOTIME: {
+      filterEventsHelper(el.getCompactWeightedEventsNoTime(), minX_val,
+                         maxX_val);
+      break;
+    }
     }
 
     // If the X axis is NOT common, then keep the initial X axis, just clear the
@@ -343,15 +343,12 @@ void FilterEvents::examineAndSortEventWS() {
 
   } // END-IF-ELSE
 
-  // sort events
-  DataObjects::EventSortType sortType = DataObjects::TOF_SORT;
-  if (m_filterByPulseTime)
-    sortType = DataObjects::PULSETIME_SORT;
-  else
-    sortType = DataObjects::PULSETIMETOF_SORT;
-
-  // This runs the SortEvents algorithm in parallel
-  m_eventWS->sortAll(sortType, nullptr);
+  // sort events. Splitting by full time sorts each spectrum by the time at
+  // the sample, which depends on its TOF correction, as it is split.
+  if (m_filterByPulseTime) {
+    // This runs the SortEvents algorithm in parallel
+    m_eventWS->sortAll(DataObjects::PULSETIME_SORT, nullptr);
+  }
 
   return;
 }
@@ -1595,12 +1592,11 @@ void FilterEvents::filterEventsBySplitters(double progressamount) {
     if (!m_vecSkip[iws]) {
       // Get the output event lists (should be empty) to be a map
       std::map<int, DataObjects::EventList *> outputs;
-      PARALLEL_CRITICAL(build_elist) {
-        for (auto &ws : m_outputWorkspacesMap) {
-          int index = ws.first;
-          auto &output_el = ws.second->getSpectrum(iws);
-          outputs.emplace(index, &output_el);
-        }
+      // No locking needed: spectrum iws is only touched by this thread
+      for (auto &ws : m_outputWorkspacesMap) {
+        int index = ws.first;
+        auto &output_el = ws.second->getSpectrum(iws);
+        outputs.emplace(index, &output_el);
       }
       // Get a holder on input workspace's event list of this spectrum
       const DataObjects::EventList &input_el = m_eventWS->getSpectrum(iws);
@@ -1667,12 +1663,11 @@ void FilterEvents::filterEventsByVectorSplitters(double progressamount) {
     if (!m_vecSkip[iws]) {
       // Get the output event lists (should be empty) to be a map
       map<int, DataObjects::EventList *> outputs;
-      PARALLEL_CRITICAL(build_elist) {
-        for (auto &ws : m_outputWorkspacesMap) {
-          int index = ws.first;
-          auto &output_el = ws.second->getSpectrum(iws);
-          outputs.emplace(index, &output_el);
-        }
+      // No locking needed: spectrum iws is only touched by this thread
+      for (auto &ws : m_outputWorkspacesMap) {
+        int index = ws.first;
+        auto &output_el = ws.second->getSpectrum(iws);
+        outputs.emplace(index, &output_el);
       }
 
       // Get a holder on input workspace's event list of this spectrum
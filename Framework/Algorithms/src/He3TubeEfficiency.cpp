@@ -455,6 +455,9 @@ void He3TubeEfficiency::execEvent() {
     case API::WEIGHTED_NOTIME:
       eventHelper(evlist.getWeightedEventsNoTime(), exp_constant);
       break;
+    case API::COMPACT_WEIGHTED_NOTIME:
+      eventHelper(evlist.getCompactWeightedEventsNoTime(), exp_constant);
+      break;
     }
 
     m_progress->report();
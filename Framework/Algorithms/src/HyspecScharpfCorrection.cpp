@@ -202,6 +202,10 @@ void HyspecScharpfCorrection::execEvent() {
     case Mantid::API::WEIGHTED_NOTIME:
       ScharpfEventHelper(evlist.getWeightedEventsNoTime(), thPlane);
       break;
+
+    case Mantid::API::COMPACT_WEIGHTED_NOTIME:
+      ScharpfEventHelper(evlist.getCompactWeightedEventsNoTime(), thPlane);
+      break;
     }
     PARALLEL_END_INTERUPT_REGION
   } // end for i
@@ -4,6 +4,7 @@
 #include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
 #include "MantidKernel/BoundedValidator.h"
+#include "MantidKernel/PerThread.h"
 #include "MantidTypes/SpectrumDefinition.h"
 
 #include <gsl/gsl_statistics.h>
@@ -78,7 +79,7 @@ void IntegrateByComponent::exec() {
     const auto &spectrumInfo = integratedWS->spectrumInfo();
     for (auto hists : specmap) {
       prog.report();
-      std::vector<double> averageYInput, averageEInput;
+      PerThread<std::vector<double>> threadYInput, threadEInput;
 
       PARALLEL_FOR_IF(Kernel::threadSafe(*integratedWS))
       for (int i = 0; i < static_cast<int>(hists.size()); ++i) { // NOLINT
@@ -96,15 +97,20 @@ void IntegrateByComponent::exec() {
           continue;
 
         // Now we have a good value
-        PARALLEL_CRITICAL(IntegrateByComponent_good) {
-          averageYInput.push_back(yValue);
-          averageEInput.push_back(eValue * eValue);
-        }
+        threadYInput.local().push_back(yValue);
+        threadEInput.local().push_back(eValue * eValue);
 
         PARALLEL_END_INTERUPT_REGION
       }
       PARALLEL_CHECK_INTERUPT_REGION
 
+      const auto append = [](std::vector<double> &total,
+                             const std::vector<double> &part) {
+        total.insert(total.end(), part.begin(), part.end());
+      };
+      const auto &averageYInput = threadYInput.reduce(append);
+      const auto &averageEInput = threadEInput.reduce(append);
+
       double averageY, averageE;
       if (averageYInput.empty()) {
         g_log.information(
@@ -130,11 +136,9 @@ void IntegrateByComponent::exec() {
         if (!std::isfinite(yValue) || !std::isfinite(eValue)) // NaNs/Infs
           continue;
 
-        // Now we have a good value
-        PARALLEL_CRITICAL(IntegrateByComponent_setaverage) {
-          integratedWS->dataY(hists[i])[0] = averageY;
-          integratedWS->dataE(hists[i])[0] = averageE;
-        }
+        // Now we have a good value. Each index is only written by one thread.
+        integratedWS->mutableY(hists[i])[0] = averageY;
+        integratedWS->mutableE(hists[i])[0] = averageE;
 
         PARALLEL_END_INTERUPT_REGION
       }
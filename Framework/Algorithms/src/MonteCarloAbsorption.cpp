@@ -143,6 +143,11 @@ void MonteCarloAbsorption::init() {
                   "If a scattering point cannot be generated by increasing "
                   "this value then there is most likely a problem with "
                   "the sample geometry.");
+  declareProperty("ResimulateTracksForDifferentWavelengths", true,
+                  "Generate new neutron tracks for every simulated wavelength "
+                  "point. If false, each generated track is used for all of "
+                  "the wavelength points of a spectrum, which is much faster "
+                  "when many wavelength points are simulated.");
 }
 
 /**
@@ -157,9 +162,12 @@ void MonteCarloAbsorption::exec() {
   interpolateOpt.set(getPropertyValue("Interpolation"));
   const bool useSparseInstrument = getProperty("SparseInstrument");
   const int maxScatterPtAttempts = getProperty("MaxScatterPtAttempts");
+  const bool resimulateTracks =
+      getProperty("ResimulateTracksForDifferentWavelengths");
   auto outputWS = doSimulation(*inputWS, static_cast<size_t>(nevents), nlambda,
                                seed, interpolateOpt, useSparseInstrument,
-                               static_cast<size_t>(maxScatterPtAttempts));
+                               static_cast<size_t>(maxScatterPtAttempts),
+                               resimulateTracks);
 
   setProperty("OutputWorkspace", std::move(outputWS));
 }
@@ -192,12 +200,16 @@ std::map<std::string, std::string> MonteCarloAbsorption::validateInputs() {
  * @param useSparseInstrument If true, use sparse instrument in simulation
  * @param maxScatterPtAttempts The maximum number of tries to generate a
  * scatter point within the object
+ * @param resimulateTracksForDiffWavelengths If true, generate new tracks for
+ * every wavelength point, otherwise use the same tracks for all points of a
+ * spectrum
  * @return A new workspace containing the correction factors & errors
  */
 MatrixWorkspace_uptr MonteCarloAbsorption::doSimulation(
     const MatrixWorkspace &inputWS, const size_t nevents, int nlambda,
     const int seed, const InterpolationOption &interpolateOpt,
-    const bool useSparseInstrument, const size_t maxScatterPtAttempts) {
+    const bool useSparseInstrument, const size_t maxScatterPtAttempts,
+    const bool resimulateTracksForDiffWavelengths) {
   auto outputWS = createOutputWorkspace(inputWS);
   const auto inputNbins = static_cast<int>(inputWS.blocksize());
   if (isEmpty(nlambda) || nlambda > inputNbins) {
@@ -260,9 +272,10 @@ MatrixWorkspace_uptr MonteCarloAbsorption::doSimulation(
 
     auto &outY = simulationWS.mutableY(i);
     const auto lambdas = simulationWS.points(i);
-    // Simulation for each requested wavelength point
+    // Collect the requested wavelength points
+    std::vector<int> indices;
+    std::vector<double> lambdasIn, lambdasOut;
     for (int j = 0; j < nbins; j += lambdaStepSize) {
-      prog.report(reportMsg);
       const double lambdaStep = lambdas[j];
       double lambdaIn(lambdaStep), lambdaOut(lambdaStep);
       if (efixed.emode() == DeltaEMode::Direct) {
@@ -272,8 +285,9 @@ MatrixWorkspace_uptr MonteCarloAbsorption::doSimulation(
       } else {
         // elastic case already initialized
       }
-      std::tie(outY[j], std::ignore) =
-          strategy.calculate(rng, detPos, lambdaIn, lambdaOut);
+      indices.push_back(j);
+      lambdasIn.push_back(lambdaIn);
+      lambdasOut.push_back(lambdaOut);
 
       // Ensure we have the last point for the interpolation
       if (lambdaStepSize > 1 && j + lambdaStepSize >= nbins && j + 1 != nbins) {
@@ -281,6 +295,22 @@ MatrixWorkspace_uptr MonteCarloAbsorption::doSimulation(
       }
     }
 
+    // Simulation for each requested wavelength point
+    if (resimulateTracksForDiffWavelengths) {
+      for (size_t k = 0; k < indices.size(); ++k) {
+        prog.report(reportMsg);
+        std::tie(outY[indices[k]], std::ignore) =
+            strategy.calculate(rng, detPos, lambdasIn[k], lambdasOut[k]);
+      }
+    } else {
+      std::vector<double> factors;
+      strategy.calculate(rng, detPos, lambdasIn, lambdasOut, factors);
+      for (size_t k = 0; k < indices.size(); ++k) {
+        outY[indices[k]] = factors[k];
+      }
+      prog.reportIncrement(indices.size(), reportMsg);
+    }
+
     // Interpolate through points not simulated
     if (!useSparseInstrument && lambdaStepSize > 1) {
       auto histnew = simulationWS.histogram(i);
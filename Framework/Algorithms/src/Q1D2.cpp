@@ -18,6 +18,7 @@
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/CompositeValidator.h"
+#include "MantidKernel/PerThread.h"
 #include "MantidKernel/RebinParamsValidator.h"
 #include "MantidKernel/UnitFactory.h"
 #include "MantidKernel/VectorHelper.h"
@@ -157,6 +158,22 @@ void Q1D2::exec() {
   // the averaged Q resolution.
   HistogramData::HistogramDx qResolutionOut(YOut.size(), 0.0);
 
+  // Each thread sums into its own copy of the output arrays, which are added
+  // together once all of the spectra have been processed
+  struct QSums {
+    explicit QSums(const size_t numBins)
+        : counts(numBins, 0.0), countsError2(numBins, 0.0),
+          norm(numBins, 0.0), normError2(numBins, 0.0),
+          qResolution(numBins, 0.0) {}
+    std::vector<double> counts;
+    std::vector<double> countsError2;
+    std::vector<double> norm;
+    std::vector<double> normError2;
+    std::vector<double> qResolution;
+    std::set<detid_t> detectorIDs;
+  };
+  PerThread<QSums> threadSums(QSums(YOut.size()));
+
   const int numSpec = static_cast<int>(m_dataWS->getNumberHistograms());
   Progress progress(this, 0.05, 1.0, numSpec + 1);
 
@@ -219,6 +236,8 @@ void Q1D2::exec() {
     auto QResIn =
         useQResolution ? (qResolution->y(i).cbegin() + wavStart) : YIn;
 
+    auto &sums = threadSums.local();
+
     // when finding the output Q bin remember that the input Q bins (from the
     // convert to wavelength) start high and reduce
     auto loc = QOut.cend();
@@ -233,21 +252,19 @@ void Q1D2::exec() {
       if ((loc != QOut.begin()) && (loc != QOut.end())) {
         // the actual Q-bin to add something to
         const size_t bin = loc - QOut.begin() - 1;
-        PARALLEL_CRITICAL(q1d_counts_sum) {
-          YOut[bin] += *YIn;
-          normSum[bin] += *norms;
-          // these are the errors squared which will be summed and square rooted
-          // at the end
-          EOutTo2[bin] += (*EIn) * (*EIn);
-          normError2[bin] += *normETo2s;
-          if (useQResolution) {
-            auto QBin = (QOut[bin + 1] - QOut[bin]);
-            // Here we need to take into account the Bin width and the count
-            // weigthing. The
-            // formula should be YIN* sqrt(QResIn^2 + (QBin/sqrt(12))^2)
-            qResolutionOut[bin] +=
-                (*YIn) * std::sqrt((*QResIn) * (*QResIn) + QBin * QBin / 12.0);
-          }
+        sums.counts[bin] += *YIn;
+        sums.norm[bin] += *norms;
+        // these are the errors squared which will be summed and square rooted
+        // at the end
+        sums.countsError2[bin] += (*EIn) * (*EIn);
+        sums.normError2[bin] += *normETo2s;
+        if (useQResolution) {
+          auto QBin = (QOut[bin + 1] - QOut[bin]);
+          // Here we need to take into account the Bin width and the count
+          // weigthing. The
+          // formula should be YIN* sqrt(QResIn^2 + (QBin/sqrt(12))^2)
+          sums.qResolution[bin] +=
+              (*YIn) * std::sqrt((*QResIn) * (*QResIn) + QBin * QBin / 12.0);
         }
       }
 
@@ -257,18 +274,24 @@ void Q1D2::exec() {
       }
     }
 
-    PARALLEL_CRITICAL(q1d_spectra_map) {
-      progress.report("Computing I(Q)");
-      // Add up the detector IDs in the output spectrum at workspace index 0
-      const auto &inSpec = m_dataWS->getSpectrum(i);
-      auto &outSpec = outputWS->getSpectrum(0);
-      outSpec.addDetectorIDs(inSpec.getDetectorIDs());
-    }
+    // Collect the detector IDs for the output spectrum at workspace index 0
+    const auto &detectorIDs = m_dataWS->getSpectrum(i).getDetectorIDs();
+    sums.detectorIDs.insert(detectorIDs.begin(), detectorIDs.end());
+    progress.report("Computing I(Q)");
 
     PARALLEL_END_INTERUPT_REGION
   }
   PARALLEL_CHECK_INTERUPT_REGION
 
+  for (const auto &sums : threadSums) {
+    AddElementwise()(YOut, sums.counts);
+    AddElementwise()(EOutTo2, sums.countsError2);
+    AddElementwise()(normSum, sums.norm);
+    AddElementwise()(normError2, sums.normError2);
+    AddElementwise()(qResolutionOut, sums.qResolution);
+    outputWS->getSpectrum(0).addDetectorIDs(sums.detectorIDs);
+  }
+
   if (communicator().size() > 1) {
     int tag = 0;
     auto size = static_cast<int>(YOut.size());
@@ -12,6 +12,7 @@
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/CompositeValidator.h"
+#include "MantidKernel/PerThread.h"
 #include "MantidKernel/PhysicalConstants.h"
 #include "MantidKernel/RebinParamsValidator.h"
 #include "MantidKernel/UnitFactory.h"
@@ -170,6 +171,23 @@ void Q1DWeighted::exec() {
   std::vector<std::vector<double>> wedgeXNormLambda(
       nWedges, std::vector<double>(sizeOut - 1, 0.0));
 
+  // Each thread adds the I(Q) of its wavelength channels to its own copy of
+  // the output arrays, these are summed up once all channels are done
+  struct IQSums {
+    IQSums(const int numBins, const int numWedges)
+        : y(numBins, 0.0), e2(numBins, 0.0), norm(numBins, 0.0),
+          wedgeY(numWedges, std::vector<double>(numBins, 0.0)),
+          wedgeE2(numWedges, std::vector<double>(numBins, 0.0)),
+          wedgeNorm(numWedges, std::vector<double>(numBins, 0.0)) {}
+    std::vector<double> y;
+    std::vector<double> e2;
+    std::vector<double> norm;
+    std::vector<std::vector<double>> wedgeY;
+    std::vector<std::vector<double>> wedgeE2;
+    std::vector<std::vector<double>> wedgeNorm;
+  };
+  PerThread<IQSums> threadSums(IQSums(sizeOut - 1, nWedges));
+
   const auto &spectrumInfo = inputWS->spectrumInfo();
 
   PARALLEL_FOR_IF(Kernel::threadSafe(*inputWS, *outputWS))
@@ -265,29 +283,26 @@ void Q1DWeighted::exec() {
             w = 1.0 / (nSubPixels * nSubPixels * err * err);
           }
 
-          PARALLEL_CRITICAL(iqnorm) /* Write to shared memory - must protect */
-          {
-            lambdaIq[iq] += YIn[j] * w;
-            lambdaIqErr[iq] += w * w * EIn[j] * EIn[j];
-            XNorm[iq] += w;
-
-            // Fill in the wedge data
-            for (int iWedge = 0; iWedge < nWedges; iWedge++) {
-              double centerAngle = M_PI / nWedges * iWedge;
-              if (asymmWedges) {
-                centerAngle *= 2;
-              }
-              centerAngle += deg2rad * wedgeOffset;
-              V3D subPix = V3D(pos.X(), pos.Y(), 0.0);
-              double angle = fabs(
-                  subPix.angle(V3D(cos(centerAngle), sin(centerAngle), 0.0)));
-              if (angle < deg2rad * wedgeAngle * 0.5 ||
-                  (!asymmWedges &&
-                   fabs(M_PI - angle) < deg2rad * wedgeAngle * 0.5)) {
-                wedgeLambdaIq[iWedge][iq] += YIn[j] * w;
-                wedgeLambdaIqErr[iWedge][iq] += w * w * EIn[j] * EIn[j];
-                wedgeXNorm[iWedge][iq] += w;
-              }
+          lambdaIq[iq] += YIn[j] * w;
+          lambdaIqErr[iq] += w * w * EIn[j] * EIn[j];
+          XNorm[iq] += w;
+
+          // Fill in the wedge data
+          for (int iWedge = 0; iWedge < nWedges; iWedge++) {
+            double centerAngle = M_PI / nWedges * iWedge;
+            if (asymmWedges) {
+              centerAngle *= 2;
+            }
+            centerAngle += deg2rad * wedgeOffset;
+            V3D subPix = V3D(pos.X(), pos.Y(), 0.0);
+            double angle = fabs(
+                subPix.angle(V3D(cos(centerAngle), sin(centerAngle), 0.0)));
+            if (angle < deg2rad * wedgeAngle * 0.5 ||
+                (!asymmWedges &&
+                 fabs(M_PI - angle) < deg2rad * wedgeAngle * 0.5)) {
+              wedgeLambdaIq[iWedge][iq] += YIn[j] * w;
+              wedgeLambdaIqErr[iWedge][iq] += w * w * EIn[j] * EIn[j];
+              wedgeXNorm[iWedge][iq] += w;
             }
           }
         }
@@ -295,25 +310,23 @@ void Q1DWeighted::exec() {
       progress.report("Computing I(Q)");
     }
     // Normalize according to the chosen weighting scheme
-    PARALLEL_CRITICAL(iq) /* Write to shared memory - must protect */
-    {
-      for (int k = 0; k < sizeOut - 1; k++) {
-        if (XNorm[k] > 0) {
-          YOut[k] += lambdaIq[k] / XNorm[k];
-          EOut[k] += lambdaIqErr[k] / XNorm[k] / XNorm[k];
-          XNormLambda[k] += 1.0;
-        }
+    auto &sums = threadSums.local();
+    for (int k = 0; k < sizeOut - 1; k++) {
+      if (XNorm[k] > 0) {
+        sums.y[k] += lambdaIq[k] / XNorm[k];
+        sums.e2[k] += lambdaIqErr[k] / XNorm[k] / XNorm[k];
+        sums.norm[k] += 1.0;
+      }
 
-        // Normalize wedges
-        for (int iWedge = 0; iWedge < nWedges; iWedge++) {
-          if (wedgeXNorm[iWedge][k] > 0) {
-            auto &wedgeYOut = wedgeWorkspaces[iWedge]->mutableY(0);
-            auto &wedgeEOut = wedgeWorkspaces[iWedge]->mutableE(0);
-            wedgeYOut[k] += wedgeLambdaIq[iWedge][k] / wedgeXNorm[iWedge][k];
-            wedgeEOut[k] += wedgeLambdaIqErr[iWedge][k] /
-                            wedgeXNorm[iWedge][k] / wedgeXNorm[iWedge][k];
-            wedgeXNormLambda[iWedge][k] += 1.0;
-          }
+      // Normalize wedges
+      for (int iWedge = 0; iWedge < nWedges; iWedge++) {
+        if (wedgeXNorm[iWedge][k] > 0) {
+          sums.wedgeY[iWedge][k] +=
+              wedgeLambdaIq[iWedge][k] / wedgeXNorm[iWedge][k];
+          sums.wedgeE2[iWedge][k] += wedgeLambdaIqErr[iWedge][k] /
+                                     wedgeXNorm[iWedge][k] /
+                                     wedgeXNorm[iWedge][k];
+          sums.wedgeNorm[iWedge][k] += 1.0;
         }
       }
     }
@@ -321,6 +334,19 @@ void Q1DWeighted::exec() {
   }
   PARALLEL_CHECK_INTERUPT_REGION
 
+  for (const auto &sums : threadSums) {
+    AddElementwise()(YOut, sums.y);
+    AddElementwise()(EOut, sums.e2);
+    AddElementwise()(XNormLambda, sums.norm);
+    for (int iWedge = 0; iWedge < nWedges; iWedge++) {
+      AddElementwise()(wedgeWorkspaces[iWedge]->mutableY(0),
+                       sums.wedgeY[iWedge]);
+      AddElementwise()(wedgeWorkspaces[iWedge]->mutableE(0),
+                       sums.wedgeE2[iWedge]);
+      AddElementwise()(wedgeXNormLambda[iWedge], sums.wedgeNorm[iWedge]);
+    }
+  }
+
   // Normalize according to the chosen weighting scheme
   for (int i = 0; i < sizeOut - 1; i++) {
     YOut[i] /= XNormLambda[i];
@@ -5,12 +5,91 @@
 
 #include "MantidAlgorithms/SampleCorrections/RectangularBeamProfile.h"
 #include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidGeometry/Objects/Track.h"
+#include "MantidKernel/Material.h"
 
 namespace Mantid {
+using Geometry::IObject;
+using Geometry::Track;
 using Kernel::PseudoRandomNumberGenerator;
 
 namespace Algorithms {
 
+namespace {
+
+/**
+ * Caches the attenuation coefficients of the objects crossed by the tracks
+ * at each wavelength point. The coefficients are computed the first time an
+ * object is met, so that the inner loop over the wavelengths is a plain
+ * multiply and add.
+ */
+class AttenuationTable {
+public:
+  struct Coefficients {
+    const IObject *object;
+    /// 100 * number density * total cross section before scattering
+    std::vector<double> before;
+    /// 100 * number density * total cross section after scattering
+    std::vector<double> after;
+  };
+
+  AttenuationTable(const std::vector<double> &lambdasBefore,
+                   const std::vector<double> &lambdasAfter)
+      : m_lambdasBefore(lambdasBefore), m_lambdasAfter(lambdasAfter) {}
+
+  const Coefficients &coefficients(const IObject &object) {
+    // There are only ever a handful of objects: the sample and the
+    // components of its environment
+    for (const auto &entry : m_table) {
+      if (entry.object == &object)
+        return entry;
+    }
+    const auto &material = object.material();
+    auto coefficientsAt = [&material](const std::vector<double> &lambdas) {
+      std::vector<double> result(lambdas.size());
+      for (size_t i = 0; i < lambdas.size(); ++i) {
+        result[i] = 100 * material.numberDensity() *
+                    (material.totalScatterXSection(lambdas[i]) +
+                     material.absorbXSection(lambdas[i]));
+      }
+      return result;
+    };
+    m_table.push_back(Coefficients{&object, coefficientsAt(m_lambdasBefore),
+                                   coefficientsAt(m_lambdasAfter)});
+    return m_table.back();
+  }
+
+private:
+  const std::vector<double> &m_lambdasBefore;
+  const std::vector<double> &m_lambdasAfter;
+  std::vector<Coefficients> m_table;
+};
+
+/**
+ * Add the exponents of the attenuation along a path for every wavelength
+ * point
+ * @param path The path of the neutron through the objects
+ * @param table The attenuation coefficients of the objects
+ * @param beforeScatter True if the path leads to the scatter point
+ * @param exponents [InOut] The exponents for each wavelength point
+ */
+void addAttenuationExponents(const Track &path, AttenuationTable &table,
+                             const bool beforeScatter,
+                             std::vector<double> &exponents) {
+  const size_t npoints = exponents.size();
+  for (const auto &segment : path) {
+    const auto &coefficients = table.coefficients(*segment.object);
+    const double *mu = beforeScatter ? coefficients.before.data()
+                                     : coefficients.after.data();
+    const double length = segment.distInsideObject;
+    double *exponent = exponents.data();
+    for (size_t i = 0; i < npoints; ++i) {
+      exponent[i] += mu[i] * length;
+    }
+  }
+}
+} // namespace
+
 /**
  * Constructor
  * @param beamProfile A reference to the object the beam profile
@@ -43,19 +122,60 @@ std::tuple<double, double>
 MCAbsorptionStrategy::calculate(Kernel::PseudoRandomNumberGenerator &rng,
                                 const Kernel::V3D &finalPos,
                                 double lambdaBefore, double lambdaAfter) const {
+  std::vector<double> factor;
+  calculate(rng, finalPos, std::vector<double>(1, lambdaBefore),
+            std::vector<double>(1, lambdaAfter), factor);
+  using std::make_tuple;
+  return make_tuple(factor.front(), m_error);
+}
+
+/**
+ * Compute the corrections for a final position of the neutron and a set of
+ * wavelength points. Each generated event is used for every wavelength
+ * point.
+ * @param rng A reference to a PseudoRandomNumberGenerator
+ * @param finalPos Defines the final position of the neutron, assumed to be
+ * where it is detected
+ * @param lambdasBefore Wavelengths, in \f$\\A^-1\f$, before scattering
+ * @param lambdasAfter Wavelengths, in \f$\\A^-1\f$, after scattering. Must
+ * be the same size as lambdasBefore
+ * @param attenuationFactors [Out] The correction factor for each wavelength
+ * point. The associated error is the same for every point.
+ */
+void MCAbsorptionStrategy::calculate(
+    Kernel::PseudoRandomNumberGenerator &rng, const Kernel::V3D &finalPos,
+    const std::vector<double> &lambdasBefore,
+    const std::vector<double> &lambdasAfter,
+    std::vector<double> &attenuationFactors) const {
+  if (lambdasBefore.size() != lambdasAfter.size()) {
+    throw std::invalid_argument("MCAbsorptionStrategy::calculate() - The "
+                                "number of wavelengths before and after "
+                                "scattering must match.");
+  }
+  const size_t npoints = lambdasBefore.size();
+  attenuationFactors.assign(npoints, 0.0);
+  AttenuationTable table(lambdasBefore, lambdasAfter);
+  // Reused by every event to avoid reallocating in the inner loop
+  Track beforeScatter, afterScatter;
+  std::vector<double> exponents(npoints);
+
   const auto scatterBounds = m_scatterVol.getBoundingBox();
-  double factor(0.0);
   for (size_t i = 0; i < m_nevents; ++i) {
     size_t attempts(0);
     do {
       const auto neutron = m_beamProfile.generatePoint(rng, scatterBounds);
 
-      const double wgt = m_scatterVol.calculateAbsorption(
-          rng, neutron.startPos, finalPos, lambdaBefore, lambdaAfter);
-      if (wgt < 0.0) {
+      if (!m_scatterVol.calculateBeforeAfterTrack(rng, neutron.startPos,
+                                                  finalPos, beforeScatter,
+                                                  afterScatter)) {
         ++attempts;
       } else {
-        factor += wgt;
+        std::fill(exponents.begin(), exponents.end(), 0.0);
+        addAttenuationExponents(beforeScatter, table, true, exponents);
+        addAttenuationExponents(afterScatter, table, false, exponents);
+        for (size_t j = 0; j < npoints; ++j) {
+          attenuationFactors[j] += std::exp(-exponents[j]);
+        }
         break;
       }
       if (attempts == m_maxScatterAttempts) {
@@ -68,8 +188,10 @@ MCAbsorptionStrategy::calculate(Kernel::PseudoRandomNumberGenerator &rng,
       }
     } while (true);
   }
-  using std::make_tuple;
-  return make_tuple(factor / static_cast<double>(m_nevents), m_error);
+  const double nevents = static_cast<double>(m_nevents);
+  for (auto &factor : attenuationFactors) {
+    factor /= nevents;
+  }
 }
 
 } // namespace Algorithms
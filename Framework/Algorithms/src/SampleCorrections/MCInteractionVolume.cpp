@@ -81,6 +81,51 @@ const Geometry::BoundingBox &MCInteractionVolume::getBoundingBox() const {
 double MCInteractionVolume::calculateAbsorption(
     Kernel::PseudoRandomNumberGenerator &rng, const Kernel::V3D &startPos,
     const Kernel::V3D &endPos, double lambdaBefore, double lambdaAfter) const {
+  Track beforeScatter, afterScatter;
+  if (!calculateBeforeAfterTrack(rng, startPos, endPos, beforeScatter,
+                                 afterScatter)) {
+    return -1.0;
+  }
+
+  // Function to calculate total attenuation for a track
+  auto calculateAttenuation = [](const Track &path, double lambda) {
+    double factor(1.0);
+    for (const auto &segment : path) {
+      const double length = segment.distInsideObject;
+      const auto &segObj = *(segment.object);
+      const auto &segMat = segObj.material();
+      factor *= attenuation(segMat.numberDensity(),
+                            segMat.totalScatterXSection(lambda) +
+                                segMat.absorbXSection(lambda),
+                            length);
+    }
+    return factor;
+  };
+
+  return calculateAttenuation(beforeScatter, lambdaBefore) *
+         calculateAttenuation(afterScatter, lambdaAfter);
+}
+
+/**
+ * Generate a scatter point in the volume and trace the paths of a neutron
+ * to and from it. The given tracks are reset and refilled so that their
+ * storage can be reused between calls.
+ * @param rng A reference to a PseudoRandomNumberGenerator producing
+ * random number between [0,1]
+ * @param startPos Origin of the initial track
+ * @param endPos Final position of neutron after scattering (assumed to be
+ * outside of the "volume")
+ * @param beforeScatter [Out] The path from the scatter point back towards
+ * the start position
+ * @param afterScatter [Out] The path from the scatter point towards the end
+ * position
+ * @return True if the tracks are valid, false if the track leading to the
+ * scatter point did not intersect anything
+ */
+bool MCInteractionVolume::calculateBeforeAfterTrack(
+    Kernel::PseudoRandomNumberGenerator &rng, const Kernel::V3D &startPos,
+    const Kernel::V3D &endPos, Track &beforeScatter,
+    Track &afterScatter) const {
   // Generate scatter point. If there is an environment present then
   // first select whether the scattering occurs on the sample or the
   // environment. The attenuation for the path leading to the scatter point
@@ -97,7 +142,8 @@ double MCInteractionVolume::calculateAbsorption(
   }
   auto toStart = startPos - scatterPos;
   toStart.normalize();
-  Track beforeScatter(scatterPos, toStart);
+  beforeScatter.reset(scatterPos, toStart);
+  beforeScatter.clearIntersectionResults();
   int nlinks = m_sample->interceptSurface(beforeScatter);
   if (m_env) {
     nlinks += m_env->interceptSurfaces(beforeScatter);
@@ -105,34 +151,19 @@ double MCInteractionVolume::calculateAbsorption(
   // This should not happen but numerical precision means that it can
   // occasionally occur with tracks that are very close to the surface
   if (nlinks == 0) {
-    return -1.0;
+    return false;
   }
 
-  // Function to calculate total attenuation for a track
-  auto calculateAttenuation = [](const Track &path, double lambda) {
-    double factor(1.0);
-    for (const auto &segment : path) {
-      const double length = segment.distInsideObject;
-      const auto &segObj = *(segment.object);
-      const auto &segMat = segObj.material();
-      factor *= attenuation(segMat.numberDensity(),
-                            segMat.totalScatterXSection(lambda) +
-                                segMat.absorbXSection(lambda),
-                            length);
-    }
-    return factor;
-  };
-
   // Now track to final destination
   V3D scatteredDirec = endPos - scatterPos;
   scatteredDirec.normalize();
-  Track afterScatter(scatterPos, scatteredDirec);
+  afterScatter.reset(scatterPos, scatteredDirec);
+  afterScatter.clearIntersectionResults();
   m_sample->interceptSurface(afterScatter);
   if (m_env) {
     m_env->interceptSurfaces(afterScatter);
   }
-  return calculateAttenuation(beforeScatter, lambdaBefore) *
-         calculateAttenuation(afterScatter, lambdaAfter);
+  return true;
 }
 
 } // namespace Algorithms
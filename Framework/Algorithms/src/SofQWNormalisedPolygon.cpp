@@ -10,6 +10,7 @@
 #include "MantidGeometry/Objects/BoundingBox.h"
 #include "MantidGeometry/Objects/IObject.h"
 #include "MantidIndexing/IndexInfo.h"
+#include "MantidKernel/PerThread.h"
 #include "MantidKernel/PhysicalConstants.h"
 #include "MantidTypes/SpectrumDefinition.h"
 
@@ -75,8 +76,9 @@ void SofQWNormalisedPolygon::exec() {
   const size_t nEnergyBins = inputWS->blocksize();
   const size_t nHistos = inputWS->getNumberHistograms();
 
-  // Holds the spectrum-detector mapping
-  std::vector<SpectrumDefinition> detIDMapping(outputWS->getNumberHistograms());
+  // Holds the spectrum-detector mapping, built up separately by each thread
+  PerThread<std::vector<SpectrumDefinition>> threadDetIDMapping(
+      std::vector<SpectrumDefinition>(outputWS->getNumberHistograms()));
 
   // Progress reports & cancellation
   const size_t nreports(nHistos * nEnergyBins);
@@ -108,6 +110,7 @@ void SofQWNormalisedPolygon::exec() {
     if (spectrumInfo.isMasked(i) || spectrumInfo.isMonitor(i)) {
       continue;
     }
+    auto &detIDMapping = threadDetIDMapping.local();
     const auto *det =
         m_EmodeProperties.m_emode == 1 ? nullptr : &spectrumInfo.detector(i);
 
@@ -153,14 +156,12 @@ void SofQWNormalisedPolygon::exec() {
       const MantidVec::difference_type qIndex =
           std::upper_bound(m_Qout.begin(), m_Qout.end(), lrQ) - m_Qout.begin();
       if (qIndex != 0 && qIndex < static_cast<int>(m_Qout.size())) {
-        // Add this spectra-detector pair to the mapping
-        PARALLEL_CRITICAL(SofQWNormalisedPolygon_spectramap) {
-          // Could do a more complete merge of spectrum definitions here, but
-          // historically only the ID of the first detector in the spectrum is
-          // used, so I am keeping that for now.
-          detIDMapping[qIndex - 1].add(
-              spectrumInfo.spectrumDefinition(i)[0].first);
-        }
+        // Add this spectra-detector pair to the mapping.
+        // Could do a more complete merge of spectrum definitions here, but
+        // historically only the ID of the first detector in the spectrum is
+        // used, so I am keeping that for now.
+        detIDMapping[qIndex - 1].add(
+            spectrumInfo.spectrumDefinition(i)[0].first);
       }
     }
     if (g_log.is(Logger::Priority::PRIO_DEBUG)) {
@@ -175,6 +176,13 @@ void SofQWNormalisedPolygon::exec() {
   FractionalRebinning::normaliseOutput(outputWS, inputWS, m_progress);
 
   // Set the output spectrum-detector mapping
+  auto &detIDMapping = threadDetIDMapping.reduce(
+      [](std::vector<SpectrumDefinition> &total,
+         const std::vector<SpectrumDefinition> &part) {
+        for (size_t q = 0; q < total.size(); ++q)
+          for (const auto &index : part[q])
+            total[q].add(index.first, index.second);
+      });
   auto outputIndices = outputWS->indexInfo();
   outputIndices.setSpectrumDefinitions(std::move(detIDMapping));
   outputWS->setIndexInfo(outputIndices);
@@ -35,6 +35,15 @@ void SortEvents::init() {
                   "(typically Time of Flight).\n"
                   "  Pulse Time: the wall-clock time of the pulse that "
                   "produced the event.");
+
+  std::vector<std::string> methodOptions{"Comparison", "Radix"};
+  declareProperty("SortMethod", "Comparison",
+                  boost::make_shared<StringListValidator>(methodOptions),
+                  "Sorting algorithm to use:\n"
+                  "  Comparison: a comparison sort, parallel within each "
+                  "event list.\n"
+                  "  Radix: a radix sort, single threaded within each event "
+                  "list and needing extra memory as large as the list.");
 }
 
 /** Executes the rebin algorithm
@@ -47,6 +56,7 @@ void SortEvents::exec() {
   EventWorkspace_sptr eventW = getProperty("InputWorkspace");
   // And other properties
   std::string sortoption = getPropertyValue("SortBy");
+  const std::string methodOption = getPropertyValue("SortMethod");
 
   //------- EventWorkspace ---------------------------
   const size_t histnumber = eventW->getNumberHistograms();
@@ -60,8 +70,12 @@ void SortEvents::exec() {
   else if (sortoption == "Pulse Time + TOF")
     sortType = DataObjects::PULSETIMETOF_SORT;
 
+  DataObjects::EventSortMethod sortMethod = DataObjects::COMPARISON_SORT;
+  if (methodOption == "Radix")
+    sortMethod = DataObjects::RADIX_SORT;
+
   // This runs the SortEvents algorithm in parallel
-  eventW->sortAll(sortType, &prog);
+  eventW->sortAll(sortType, &prog, sortMethod);
 }
 
 } // namespace Algorithms
@@ -9,6 +9,7 @@
 #include "MantidGeometry/Instrument.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
+#include "MantidKernel/PerThread.h"
 #include "MantidKernel/RebinParamsValidator.h"
 #include "MantidKernel/VectorHelper.h"
 
@@ -131,6 +132,19 @@ void TOFSANSResolution::exec() {
   const auto &spectrumInfo = reducedWS->spectrumInfo();
   const double L1 = spectrumInfo.l1();
 
+  // Each thread sums the distributions of its pixels into its own arrays,
+  // these are added up once all pixels are done
+  struct ResolutionSums {
+    explicit ResolutionSums(const size_t numBins)
+        : dx(numBins, 0.0), norm(numBins, 0.0), tofy(numBins, 0.0),
+          thetay(numBins, 0.0) {}
+    std::vector<double> dx;
+    std::vector<double> norm;
+    std::vector<double> tofy;
+    std::vector<double> thetay;
+  };
+  PerThread<ResolutionSums> threadSums(ResolutionSums(xLength - 1));
+
   PARALLEL_FOR_IF(Kernel::threadSafe(*reducedWS, *iqWS))
   for (int i = 0; i < numberOfSpectra; i++) {
     PARALLEL_START_INTERUPT_REGION
@@ -154,10 +168,7 @@ void TOFSANSResolution::exec() {
     const auto &YIn = reducedWS->y(i);
     const int wlLength = static_cast<int>(XIn.size());
 
-    std::vector<double> _dx(xLength - 1, 0.0);
-    std::vector<double> _norm(xLength - 1, 0.0);
-    std::vector<double> _tofy(xLength - 1, 0.0);
-    std::vector<double> _thetay(xLength - 1, 0.0);
+    auto &sums = threadSums.local();
 
     for (int j = 0; j < wlLength - 1; j++) {
       const double wl = (XIn[j + 1] + XIn[j]) / 2.0;
@@ -201,28 +212,26 @@ void TOFSANSResolution::exec() {
       // Note: we are looping over bins, therefore the xLength-1.
       if (iq >= 0 && iq < xLength - 1 && !std::isnan(dq_over_q) &&
           dq_over_q > 0 && YIn[j] > 0) {
-        _dx[iq] += q * dq_over_q * YIn[j];
-        _norm[iq] += YIn[j];
-        _tofy[iq] += q * std::fabs(dwl_over_wl) * YIn[j];
-        _thetay[iq] += q * std::sqrt(dTheta2) / theta * YIn[j];
+        sums.dx[iq] += q * dq_over_q * YIn[j];
+        sums.norm[iq] += YIn[j];
+        sums.tofy[iq] += q * std::fabs(dwl_over_wl) * YIn[j];
+        sums.thetay[iq] += q * std::sqrt(dTheta2) / theta * YIn[j];
       }
     }
 
-    // Move over the distributions for that pixel
-    // Note: we are looping over bins, therefore the xLength-1.
-    PARALLEL_CRITICAL(iq) /* Write to shared memory - must protect */
-    for (int iq = 0; iq < xLength - 1; iq++) {
-      DxOut[iq] += _dx[iq];
-      XNorm[iq] += _norm[iq];
-      TOFY[iq] += _tofy[iq];
-      ThetaY[iq] += _thetay[iq];
-    }
-
     progress.report("Computing Q resolution");
     PARALLEL_END_INTERUPT_REGION
   }
   PARALLEL_CHECK_INTERUPT_REGION
 
+  // Move over the distributions of all pixels
+  for (const auto &sums : threadSums) {
+    AddElementwise()(DxOut, sums.dx);
+    AddElementwise()(XNorm, sums.norm);
+    AddElementwise()(TOFY, sums.tofy);
+    AddElementwise()(ThetaY, sums.thetay);
+  }
+
   // Normalize according to the chosen weighting scheme
   // Note: we are looping over bins, therefore the xLength-1.
   for (int i = 0; i < xLength - 1; i++) {
@@ -127,6 +127,10 @@ void UnaryOperation::execEvent() {
     case WEIGHTED_NOTIME:
       unaryOperationEventHelper(evlist.getWeightedEventsNoTime());
       break;
+
+    case COMPACT_WEIGHTED_NOTIME:
+      unaryOperationEventHelper(evlist.getCompactWeightedEventsNoTime());
+      break;
     }
 
     prog.report();
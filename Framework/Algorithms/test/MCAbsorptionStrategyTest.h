@@ -57,10 +57,68 @@ public:
     TS_ASSERT_DELTA(1.0 / std::sqrt(nevents), error, 1e-08);
   }
 
+  void test_Simulation_Uses_Each_Event_For_All_Wavelengths() {
+    using Mantid::Kernel::V3D;
+    using namespace MonteCarloTesting;
+    using namespace ::testing;
+
+    auto testSampleSphere = MonteCarloTesting::createTestSample(
+        MonteCarloTesting::TestSampleType::SolidSphere);
+    MockBeamProfile testBeamProfile;
+    EXPECT_CALL(testBeamProfile, defineActiveRegion(_))
+        .WillOnce(Return(testSampleSphere.getShape().getBoundingBox()));
+    const size_t nevents(10), maxTries(100);
+    MCAbsorptionStrategy mcabsorb(testBeamProfile, testSampleSphere, nevents,
+                                  maxTries);
+    // 3 random numbers per event expected, independent of the number of
+    // wavelengths
+    MockRNG rng;
+    EXPECT_CALL(rng, nextValue())
+        .Times(Exactly(30))
+        .WillRepeatedly(Return(0.5));
+    const Mantid::Algorithms::IBeamProfile::Ray testRay = {V3D(-2, 0, 0),
+                                                           V3D(1, 0, 0)};
+    EXPECT_CALL(testBeamProfile, generatePoint(_, _))
+        .Times(Exactly(static_cast<int>(nevents)))
+        .WillRepeatedly(Return(testRay));
+    const V3D endPos(0.7, 0.7, 1.4);
+    const std::vector<double> lambdasBefore{2.5, 2.5, 3.5};
+    const std::vector<double> lambdasAfter{3.5, 3.5, 4.5};
+
+    std::vector<double> factors;
+    mcabsorb.calculate(rng, endPos, lambdasBefore, lambdasAfter, factors);
+    TS_ASSERT_EQUALS(factors.size(), 3);
+    TS_ASSERT_DELTA(0.0043828472, factors[0], 1e-08);
+    TS_ASSERT_EQUALS(factors[0], factors[1]);
+    // Absorption increases with wavelength
+    TS_ASSERT_LESS_THAN(factors[2], factors[0]);
+  }
+
   //----------------------------------------------------------------------------
   // Failure cases
   //----------------------------------------------------------------------------
 
+  void test_mismatched_wavelength_counts_throw() {
+    using Mantid::Algorithms::RectangularBeamProfile;
+    using namespace Mantid::Geometry;
+    using namespace Mantid::Kernel;
+    using namespace MonteCarloTesting;
+    using namespace ::testing;
+
+    auto testSampleSphere = MonteCarloTesting::createTestSample(
+        MonteCarloTesting::TestSampleType::SolidSphere);
+    RectangularBeamProfile testBeamProfile(
+        ReferenceFrame(Y, Z, Right, "source"), V3D(), 1, 1);
+    MCAbsorptionStrategy mcabs(testBeamProfile, testSampleSphere, 10, 100);
+    MockRNG rng;
+    EXPECT_CALL(rng, nextValue()).Times(0);
+    std::vector<double> factors;
+    TS_ASSERT_THROWS(mcabs.calculate(rng, V3D(0.7, 0.7, 1.4),
+                                     std::vector<double>(2, 2.5),
+                                     std::vector<double>(3, 3.5), factors),
+                     std::invalid_argument)
+  }
+
   void test_thin_object_fails_to_generate_point_in_sample() {
     using Mantid::Algorithms::RectangularBeamProfile;
     using namespace Mantid::Geometry;
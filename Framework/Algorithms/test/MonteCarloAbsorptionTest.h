@@ -183,6 +183,34 @@ public:
     TS_ASSERT_DELTA(0.0000046103, outputWS->y(0).back(), delta2);
   }
 
+  void test_Tracks_Shared_Between_Wavelengths() {
+    using Mantid::Kernel::DeltaEMode;
+    TestWorkspaceDescriptor wsProps = {
+        5, 10, Environment::SampleOnly, DeltaEMode::Elastic, -1, -1};
+    auto inputWS = setUpWS(wsProps);
+    auto mcabs = createAlgorithm();
+    TS_ASSERT_THROWS_NOTHING(mcabs->setProperty("InputWorkspace", inputWS));
+    TS_ASSERT_THROWS_NOTHING(
+        mcabs->setProperty("ResimulateTracksForDifferentWavelengths", false));
+    mcabs->execute();
+    auto outputWS = getOutputWorkspace(mcabs);
+
+    verifyDimensions(wsProps, outputWS);
+    // The first point uses the same events as when the tracks are
+    // resimulated
+    const double delta(1e-05);
+    TS_ASSERT_DELTA(0.006335, outputWS->y(0).front(), delta);
+    TS_ASSERT_DELTA(0.006265, outputWS->y(2).front(), delta);
+    // With the same tracks for every wavelength the attenuation factor falls
+    // strictly with increasing wavelength
+    for (size_t i = 0; i < outputWS->getNumberHistograms(); ++i) {
+      const auto &y = outputWS->y(i);
+      for (size_t j = 1; j < y.size(); ++j) {
+        TS_ASSERT_LESS_THAN(y[j], y[j - 1]);
+      }
+    }
+  }
+
   void test_Linear_Interpolation() {
     using Mantid::Kernel::DeltaEMode;
     TestWorkspaceDescriptor wsProps = {
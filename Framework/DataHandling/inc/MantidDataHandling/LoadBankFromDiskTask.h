@@ -51,6 +51,7 @@ public:
                        const std::vector<int> &framePeriodNumbers);
 
   void run() override;
+  const char *name() const override { return "LoadBankFromDisk"; }
 
 private:
   void loadPulseTimes(::NeXus::File &file);
@@ -59,6 +60,7 @@ private:
                       int64_t &stop_event,
                       const std::vector<uint64_t> &event_index);
   std::unique_ptr<uint32_t[]> loadEventId(::NeXus::File &file);
+  bool restrictIdRangeToRequestedSpectra();
   std::unique_ptr<float[]> loadTof(::NeXus::File &file);
   std::unique_ptr<float[]> loadEventWeights(::NeXus::File &file);
   int64_t recalculateDataSize(const int64_t &size);
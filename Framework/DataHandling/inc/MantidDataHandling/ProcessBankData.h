@@ -47,6 +47,7 @@ public:
                   detid_t min_event_id, detid_t max_event_id);
 
   void run() override;
+  const char *name() const override { return "ProcessBankData"; }
 
 private:
   size_t getWorkspaceIndexFromPixelID(const detid_t pixID);
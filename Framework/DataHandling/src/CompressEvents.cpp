@@ -56,6 +56,12 @@ void CompressEvents::init() {
       "starting filtering. Ignored if WallClockTolerance is not specified. "
       "Default is start of run",
       Direction::Input);
+
+  declareProperty("SinglePrecisionTof", false,
+                  "Store the compressed events with a single precision X "
+                  "value, using 12 bytes per event instead of 16. This keeps "
+                  "about 7 significant digits of the X value. Ignored if "
+                  "WallClockTolerance is specified.");
 }
 
 void CompressEvents::exec() {
@@ -65,6 +71,7 @@ void CompressEvents::exec() {
   const double toleranceTof = getProperty("Tolerance");
   const double toleranceWallClock = getProperty("WallClockTolerance");
   const bool compressFat = !isEmpty(toleranceWallClock);
+  const bool compact = getProperty("SinglePrecisionTof");
   Types::Core::DateAndTime startTime;
 
   if (compressFat) {
@@ -94,8 +101,8 @@ void CompressEvents::exec() {
     // Loop over the histograms (detector spectra)
     tbb::parallel_for(
         tbb::blocked_range<size_t>(0, noSpectra),
-        [compressFat, toleranceTof, startTime, toleranceWallClock, &inputWS,
-         &outputWS, &prog](const tbb::blocked_range<size_t> &range) {
+        [compressFat, compact, toleranceTof, startTime, toleranceWallClock,
+         &inputWS, &outputWS, &prog](const tbb::blocked_range<size_t> &range) {
           for (size_t index = range.begin(); index < range.end(); ++index) {
             // The input event list
             EventList &input_el = inputWS->getSpectrum(index);
@@ -108,15 +115,15 @@ void CompressEvents::exec() {
               input_el.compressFatEvents(toleranceTof, startTime,
                                          toleranceWallClock, &output_el);
             else
-              input_el.compressEvents(toleranceTof, &output_el);
+              input_el.compressEvents(toleranceTof, &output_el, compact);
             prog.report("Compressing");
           }
         });
   } else { // inplace
     tbb::parallel_for(
         tbb::blocked_range<size_t>(0, noSpectra),
-        [compressFat, toleranceTof, startTime, toleranceWallClock, &outputWS,
-         &prog](const tbb::blocked_range<size_t> &range) {
+        [compressFat, compact, toleranceTof, startTime, toleranceWallClock,
+         &outputWS, &prog](const tbb::blocked_range<size_t> &range) {
           for (size_t index = range.begin(); index < range.end(); ++index) {
             // The input (also output) event list
             auto &output_el = outputWS->getSpectrum(index);
@@ -125,7 +132,7 @@ void CompressEvents::exec() {
               output_el.compressFatEvents(toleranceTof, startTime,
                                           toleranceWallClock, &output_el);
             else
-              output_el.compressEvents(toleranceTof, &output_el);
+              output_el.compressEvents(toleranceTof, &output_el, compact);
             prog.report("Compressing");
           }
         });
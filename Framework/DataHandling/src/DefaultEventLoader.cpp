@@ -24,8 +24,10 @@ void DefaultEventLoader::load(LoadEventNexus *alg, EventWorkspaceCollection &ws,
 
   auto bankRange = loader.setupChunking(bankNames, bankNumEvents);
 
-  // Make the thread pool
-  auto scheduler = new ThreadSchedulerMutexes;
+  // Make the thread pool. Disk reads are serialised by the disk mutex; threads
+  // that cannot read are not parked on that mutex but stay free to process
+  // the banks that have already been read, so reading and processing overlap.
+  auto scheduler = new ThreadSchedulerMutexes(false);
   ThreadPool pool(scheduler);
   auto diskIOMutex = boost::make_shared<std::mutex>();
 
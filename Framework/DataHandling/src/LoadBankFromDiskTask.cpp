@@ -246,6 +246,41 @@ LoadBankFromDiskTask::loadEventId(::NeXus::File &file) {
   return event_id;
 }
 
+/** Restrict the range of pixel ids to process to the spectra requested with
+ * SpectrumMin and SpectrumMax. This is checked as soon as the event ids are
+ * known so that the remaining fields of a bank that is entirely outside the
+ * requested range are not read from disk.
+ * @returns false if none of the pixels in the bank were requested
+ */
+bool LoadBankFromDiskTask::restrictIdRangeToRequestedSpectra() {
+  const uint32_t minSpectraToLoad =
+      static_cast<uint32_t>(m_loader.alg->m_specMin);
+  const uint32_t maxSpectraToLoad =
+      static_cast<uint32_t>(m_loader.alg->m_specMax);
+  const uint32_t emptyInt = static_cast<uint32_t>(EMPTY_INT());
+  // check that if a range of spectra were requested that these fit within
+  // this bank
+  if (minSpectraToLoad != emptyInt && m_min_id < minSpectraToLoad) {
+    if (minSpectraToLoad > m_max_id) { // the minimum spectra to load is more
+                                       // than the max of this bank
+      return false;
+    }
+    // the min spectra to load is higher than the min for this bank
+    m_min_id = minSpectraToLoad;
+  }
+  if (maxSpectraToLoad != emptyInt && m_max_id > maxSpectraToLoad) {
+    if (maxSpectraToLoad < m_min_id) {
+      // the maximum spectra to load is less than the minimum of this bank
+      return false;
+    }
+    // the max spectra to load is lower than the max for this bank
+    m_max_id = maxSpectraToLoad;
+  }
+  // if the min is now larger than the max, the entire block of spectra to
+  // load is outside this bank
+  return m_min_id <= m_max_id;
+}
+
 /** Open and load the times-of-flight data
  * @param file An NeXus::File object opened at the correct group
  * @returns A new array containing the time of flights for this bank
@@ -360,6 +395,11 @@ void LoadBankFromDiskTask::run() {
   std::unique_ptr<float[]> event_weight;
   std::vector<uint64_t> event_index;
 
+  // Stays true unless the bank is outside the requested spectra
+  bool bankInRange = true;
+  // The pixel id range of the whole bank, before applying the spectra range
+  uint32_t bank_size = 0;
+
   // Open the file
   ::NeXus::File file(m_loader.alg->m_filename);
   try {
@@ -401,8 +441,13 @@ void LoadBankFromDiskTask::run() {
           m_loadError = true; // To allow cancelling the algorithm
         }
 
+        bank_size = m_max_id - m_min_id;
+        // Don't read the rest of the bank if none of its pixels are needed
+        if (!m_loadError)
+          bankInRange = this->restrictIdRangeToRequestedSpectra();
+
         // And TOF.
-        if (!m_loadError) {
+        if (!m_loadError && bankInRange) {
           event_time_of_flight = this->loadTof(file);
           if (m_have_weight) {
             event_weight = this->loadEventWeights(file);
@@ -437,38 +482,8 @@ void LoadBankFromDiskTask::run() {
   file.closeGroup();
   file.close();
 
-  // Abort if anything failed
-  if (m_loadError) {
-    return;
-  }
-
-  const auto bank_size = m_max_id - m_min_id;
-  const uint32_t minSpectraToLoad =
-      static_cast<uint32_t>(m_loader.alg->m_specMin);
-  const uint32_t maxSpectraToLoad =
-      static_cast<uint32_t>(m_loader.alg->m_specMax);
-  const uint32_t emptyInt = static_cast<uint32_t>(EMPTY_INT());
-  // check that if a range of spectra were requested that these fit within
-  // this bank
-  if (minSpectraToLoad != emptyInt && m_min_id < minSpectraToLoad) {
-    if (minSpectraToLoad > m_max_id) { // the minimum spectra to load is more
-                                       // than the max of this bank
-      return;
-    }
-    // the min spectra to load is higher than the min for this bank
-    m_min_id = minSpectraToLoad;
-  }
-  if (maxSpectraToLoad != emptyInt && m_max_id > maxSpectraToLoad) {
-    if (maxSpectraToLoad < m_min_id) {
-      // the maximum spectra to load is less than the minimum of this bank
-      return;
-    }
-    // the max spectra to load is lower than the max for this bank
-    m_max_id = maxSpectraToLoad;
-  }
-  if (m_min_id > m_max_id) {
-    // the min is now larger than the max, this means the entire block of
-    // spectra to load is outside this bank
+  // Abort if anything failed or there is nothing to load
+  if (m_loadError || !bankInRange) {
     return;
   }
 
@@ -50,7 +50,8 @@ using Types::Core::DateAndTime;
 LoadEventNexus::LoadEventNexus()
     : filter_tof_min(0), filter_tof_max(0), m_specMin(0), m_specMax(0),
       longest_tof(0), shortest_tof(0), bad_tofs(0), discarded_events(0),
-      compressTolerance(0), m_instrument_loaded_correctly(false),
+      compressTolerance(0), compressSinglePrecisionTof(false),
+      m_instrument_loaded_correctly(false),
       loadlogs(false), m_logs_loaded_correctly(false), event_id_is_spec(false) {
 }
 
@@ -159,6 +160,13 @@ void LoadEventNexus::init() {
                   "This specified the tolerance to use (in microseconds) when "
                   "compressing.");
 
+  declareProperty(make_unique<PropertyWithValue<bool>>(
+                      "CompressSinglePrecisionTof", false, Direction::Input),
+                  "Store the compressed events with a single precision "
+                  "time-of-flight, using 12 bytes per event instead of 16 "
+                  "(optional, default False). Only used with "
+                  "CompressTolerance.");
+
   auto mustBePositive = boost::make_shared<BoundedValidator<int>>();
   mustBePositive->setLower(1);
   declareProperty("ChunkNumber", EMPTY_INT(), mustBePositive,
@@ -176,6 +184,7 @@ void LoadEventNexus::init() {
   std::string grp3 = "Reduce Memory Use";
   setPropertyGroup("Precount", grp3);
   setPropertyGroup("CompressTolerance", grp3);
+  setPropertyGroup("CompressSinglePrecisionTof", grp3);
   setPropertyGroup("ChunkNumber", grp3);
   setPropertyGroup("TotalChunks", grp3);
 
@@ -332,6 +341,7 @@ void LoadEventNexus::exec() {
   m_filename = getPropertyValue("Filename");
 
   compressTolerance = getProperty("CompressTolerance");
+  compressSinglePrecisionTof = getProperty("CompressSinglePrecisionTof");
 
   loadlogs = getProperty("LoadLogs");
 
@@ -171,9 +171,9 @@ void LoadInstrument::exec() {
       instrument =
           InstrumentDataService::Instance().retrieve(instrumentNameMangled);
     } else {
-      // Really create the instrument
+      // Really create the instrument, or read it from the instrument cache
       Progress prog(this, 0.0, 1.0, 100);
-      instrument = parser.parseXML(&prog);
+      instrument = parser.parseXMLOrReadCache(&prog);
       // Parse the instrument tree (internally create ComponentInfo and
       // DetectorInfo). This is an optimization that avoids duplicate parsing of
       // the instrument tree when loading multiple workspaces with the same
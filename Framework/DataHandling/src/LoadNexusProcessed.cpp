@@ -741,6 +741,10 @@ LoadNexusProcessed::loadEventEntry(NXData &wksp_cls, NXDouble &xbins,
           el.addEventQuickly(
               WeightedEventNoTime(tofs[i], weights[i], error_squareds[i]));
           break;
+        case COMPACT_WEIGHTED_NOTIME:
+          el.addEventQuickly(CompactWeightedEventNoTime(tofs[i], weights[i],
+                                                        error_squareds[i]));
+          break;
         }
 
       // Set the X axis
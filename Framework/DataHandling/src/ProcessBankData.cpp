@@ -205,7 +205,8 @@ void ProcessBankData::run() { // override {
         size_t wi = getWorkspaceIndexFromPixelID(pixID);
         auto &el = outputWS.getSpectrum(wi);
         if (compress)
-          el.compressEvents(alg->compressTolerance, &el);
+          el.compressEvents(alg->compressTolerance, &el,
+                            alg->compressSinglePrecisionTof);
         else {
           if (pulsetimesincreasing)
             el.setSortOrder(DataObjects::PULSETIME_SORT);
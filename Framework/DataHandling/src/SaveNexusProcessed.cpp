@@ -79,7 +79,7 @@ void SaveNexusProcessed::init() {
   declareProperty(
       "CompressNexus", false,
       "For EventWorkspaces, compress the Nexus data field (default False).\n"
-      "This will make smaller files but takes much longer.");
+      "This will make smaller files but takes longer.");
   setPropertySettings("CompressNexus",
                       make_unique<EnabledWhenWorkspaceIsType<EventWorkspace>>(
                           "InputWorkspace", true));
@@ -407,6 +407,7 @@ void SaveNexusProcessed::execEvent(Mantid::NeXus::NexusFileIO *nexusFile,
     writeError = true;
     break;
   case WEIGHTED_NOTIME:
+  case COMPACT_WEIGHTED_NOTIME:
     writeWeight = true;
     writeError = true;
     break;
@@ -446,6 +447,10 @@ void SaveNexusProcessed::execEvent(Mantid::NeXus::NexusFileIO *nexusFile,
       appendEventListData(el.getWeightedEventsNoTime(), offset, tofs, weights,
                           errorSquareds, pulsetimes);
       break;
+    case COMPACT_WEIGHTED_NOTIME:
+      appendEventListData(el.getCompactWeightedEventsNoTime(), offset, tofs,
+                          weights, errorSquareds, pulsetimes);
+      break;
     }
     m_progress->reportIncrement(el.getNumberEvents(), "Copying EventList");
 
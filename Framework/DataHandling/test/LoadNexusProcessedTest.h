@@ -233,14 +233,16 @@ public:
       Poco::File(filename).remove();
   }
 
-  void dotest_LoadAnEventFile(EventType type) {
-    std::string filename_root = "LoadNexusProcessed_ExecEvent_";
+  void dotest_LoadAnEventFile(EventType type, bool compress = false) {
+    std::string filename_root = compress
+                                    ? "LoadNexusProcessed_ExecEventCompressed_"
+                                    : "LoadNexusProcessed_ExecEvent_";
 
     // Call a function that writes out the file
     std::string outputFile;
     EventWorkspace_sptr origWS =
         SaveNexusProcessedTest::do_testExec_EventWorkspaces(
-            filename_root, type, outputFile, false, false);
+            filename_root, type, outputFile, false, false, true, compress);
 
     LoadNexusProcessed alg;
     TS_ASSERT_THROWS_NOTHING(alg.initialize());
@@ -309,6 +311,14 @@ public:
     dotest_LoadAnEventFile(WEIGHTED_NOTIME);
   }
 
+  void test_LoadEventNexus_TOF_compressed() {
+    dotest_LoadAnEventFile(TOF, true);
+  }
+
+  void test_LoadEventNexus_WEIGHTED_compressed() {
+    dotest_LoadAnEventFile(WEIGHTED, true);
+  }
+
   void test_loadEventNexus_Min() {
     writeTmpEventNexus();
 
@@ -341,6 +341,42 @@ public:
         true /* DONT preserve events */, true /* Compress */);
   }
 
+  void testExec_EventWorkspace_Empty_CompressNexus() {
+    std::vector<std::vector<int>> groups{{10}, {20}};
+    EventWorkspace_sptr WS =
+        WorkspaceCreationHelper::createGroupedEventWorkspace(groups, 100, 1.0,
+                                                             1.0);
+    for (size_t wi = 0; wi < WS->getNumberHistograms(); wi++)
+      WS->getSpectrum(wi).clear(false);
+
+    SaveNexusProcessed alg;
+    alg.initialize();
+    alg.setProperty("InputWorkspace",
+                    boost::dynamic_pointer_cast<Workspace>(WS));
+    alg.setPropertyValue("Filename", "SaveNexusProcessed_EmptyEvents.nxs");
+    alg.setProperty("CompressNexus", true);
+    const std::string outputFile = alg.getPropertyValue("Filename");
+    if (Poco::File(outputFile).exists())
+      Poco::File(outputFile).remove();
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+
+    // The event fields are written as empty datasets
+    ::NeXus::File file(outputFile);
+    for (const std::string field : {"tof", "pulsetime"}) {
+      TS_ASSERT_THROWS_NOTHING(
+          file.openPath("/mantid_workspace_1/event_workspace/" + field));
+      const auto info = file.getInfo();
+      TS_ASSERT_EQUALS(info.dims.size(), 1);
+      TS_ASSERT_EQUALS(info.dims[0], 0);
+      file.closeData();
+    }
+    file.close();
+
+    if (clearfiles)
+      Poco::File(outputFile).remove();
+  }
+
   void testExecSaveLabel() {
     SaveNexusProcessed alg;
     if (!alg.isInitialized())
@@ -48,6 +48,8 @@ public:
                           const Mantid::Kernel::VMD &scaling);
 
   void apply(const coord_t *inputVector, coord_t *outVector) const override;
+  void applyMany(const coord_t *inputCoords, coord_t *outCoords,
+                 const size_t count) const override;
 
   static CoordTransformAffine *combineTransformations(CoordTransform *first,
                                                       CoordTransform *second);
@@ -66,6 +66,8 @@ public:
   std::string toXMLString() const override;
   std::string id() const override;
   void apply(const coord_t *inputVector, coord_t *outVector) const override;
+  void applyMany(const coord_t *inputCoords, coord_t *outCoords,
+                 const size_t count) const override;
   Mantid::Kernel::Matrix<coord_t> makeAffineMatrix() const override;
 
 protected:
@@ -33,6 +33,10 @@ enum EventSortType {
   TIMEATSAMPLE_SORT
 };
 
+/// How the events are sorted: a parallel comparison sort, or a single
+/// threaded radix sort which needs buffers as large as the list.
+enum EventSortMethod { COMPARISON_SORT, RADIX_SORT };
+
 //==========================================================================================
 /** @class Mantid::DataObjects::EventList
 
@@ -83,6 +87,8 @@ public:
 
   EventList(const std::vector<WeightedEventNoTime> &events);
 
+  EventList(const std::vector<CompactWeightedEventNoTime> &events);
+
   ~EventList() override;
 
   void copyDataFrom(const ISpectrum &source) override;
@@ -102,6 +108,9 @@ public:
 
   EventList &operator+=(const std::vector<WeightedEventNoTime> &more_events);
 
+  EventList &
+  operator+=(const std::vector<CompactWeightedEventNoTime> &more_events);
+
   EventList &operator+=(const EventList &more_events);
 
   EventList &operator-=(const EventList &more_events);
@@ -143,6 +152,16 @@ public:
     this->order = UNSORTED;
   }
 
+  // --------------------------------------------------------------------------
+  /** Append an event to the histogram, without clearing the cache, to make it
+   * faster.
+   * @param event :: CompactWeightedEventNoTime to add at the end of the list.
+   * */
+  inline void addEventQuickly(const CompactWeightedEventNoTime &event) {
+    this->compactEvents.push_back(event);
+    this->order = UNSORTED;
+  }
+
   Mantid::API::EventType getEventType() const override;
 
   void switchTo(Mantid::API::EventType newType) override;
@@ -158,6 +177,10 @@ public:
   std::vector<WeightedEventNoTime> &getWeightedEventsNoTime();
   const std::vector<WeightedEventNoTime> &getWeightedEventsNoTime() const;
 
+  std::vector<CompactWeightedEventNoTime> &getCompactWeightedEventsNoTime();
+  const std::vector<CompactWeightedEventNoTime> &
+  getCompactWeightedEventsNoTime() const;
+
   void clear(const bool removeDetIDs = true) override;
   void clearUnused();
 
@@ -167,14 +190,15 @@ public:
 
   void reserve(size_t num) override;
 
-  void sort(const EventSortType order) const;
+  void sort(const EventSortType order,
+            const EventSortMethod method = COMPARISON_SORT) const;
 
   void setSortOrder(const EventSortType order) const;
 
-  void sortTof() const;
+  void sortTof(const EventSortMethod method = COMPARISON_SORT) const;
 
-  void sortPulseTime() const;
-  void sortPulseTimeTOF() const;
+  void sortPulseTime(const EventSortMethod method = COMPARISON_SORT) const;
+  void sortPulseTimeTOF(const EventSortMethod method = COMPARISON_SORT) const;
   void sortTimeAtSample(const double &tofFactor, const double &tofShift,
                         bool forceResort = false) const;
 
@@ -224,7 +248,8 @@ public:
 
   virtual size_t histogram_size() const;
 
-  void compressEvents(double tolerance, EventList *destination);
+  void compressEvents(double tolerance, EventList *destination,
+                      const bool compact = false);
   void compressFatEvents(const double tolerance,
                          const Types::Core::DateAndTime &timeStart,
                          const double seconds, EventList *destination);
@@ -389,6 +414,9 @@ private:
   /// List of WeightedEvent's
   mutable std::vector<WeightedEventNoTime> weightedEventsNoTime;
 
+  /// List of CompactWeightedEventNoTime's
+  mutable std::vector<CompactWeightedEventNoTime> compactEvents;
+
   /// What type of event is in our list.
   Mantid::API::EventType eventType;
 
@@ -424,6 +452,7 @@ private:
 
   void switchToWeightedEvents();
   void switchToWeightedEventsNoTime();
+  void switchToCompactWeightedEventsNoTime();
   // should not be called externally
   void sortPulseTimeTOFDelta(const Types::Core::DateAndTime &start,
                              const double seconds) const;
@@ -432,10 +461,11 @@ private:
   template <class T1, class T2>
   static void minusHelper(std::vector<T1> &events,
                           const std::vector<T2> &more_events);
-  template <class T>
+  template <class OUT>
+  void compressEventsInto(std::vector<OUT> &out, double tolerance) const;
+  template <class T, class OUT>
   static void compressEventsHelper(const std::vector<T> &events,
-                                   std::vector<WeightedEventNoTime> &out,
-                                   double tolerance);
+                                   std::vector<OUT> &out, double tolerance);
   template <class T>
   void compressEventsParallelHelper(const std::vector<T> &events,
                                     std::vector<WeightedEventNoTime> &out,
@@ -503,11 +533,6 @@ private:
   void splitByTimeHelper(Kernel::TimeSplitterType &splitter,
                          std::vector<EventList *> outputs,
                          typename std::vector<T> &events) const;
-  template <class T>
-  void splitByFullTimeHelper(Kernel::TimeSplitterType &splitter,
-                             std::map<int, EventList *> outputs,
-                             typename std::vector<T> &events, bool docorrection,
-                             double toffactor, double tofshift) const;
   /// Split events by pulse time
   template <class T>
   void splitByPulseTimeHelper(Kernel::TimeSplitterType &splitter,
@@ -522,17 +547,18 @@ private:
                                    std::map<int, EventList *> outputs,
                                    typename std::vector<T> &events) const;
 
+  /// Split events sorted by time at sample into consecutive time ranges
+  std::string splitByFullTimeSorted(const std::vector<int64_t> &vectimes,
+                                    const std::vector<int> &vecgroups,
+                                    const std::map<int, EventList *> &outputs,
+                                    bool docorrection, double toffactor,
+                                    double tofshift) const;
   template <class T>
-  std::string splitByFullTimeVectorSplitterHelper(
-      const std::vector<int64_t> &vectimes, const std::vector<int> &vecgroups,
-      std::map<int, EventList *> outputs, typename std::vector<T> &vecEvents,
-      bool docorrection, double toffactor, double tofshift) const;
-
-  template <class T>
-  std::string splitByFullTimeSparseVectorSplitterHelper(
+  std::string splitByFullTimeSortedHelper(
       const std::vector<int64_t> &vectimes, const std::vector<int> &vecgroups,
-      std::map<int, EventList *> outputs, typename std::vector<T> &vecEvents,
-      bool docorrection, double toffactor, double tofshift) const;
+      const std::map<int, EventList *> &outputs,
+      const typename std::vector<T> &events, double toffactor,
+      double tofshift) const;
 
   template <class T>
   static void multiplyHelper(std::vector<T> &events, const double value,
@@ -567,6 +593,11 @@ DLLExport void getEventsFrom(EventList &el,
                              std::vector<WeightedEventNoTime> *&events);
 DLLExport void getEventsFrom(const EventList &el,
                              std::vector<WeightedEventNoTime> const *&events);
+DLLExport void getEventsFrom(EventList &el,
+                             std::vector<CompactWeightedEventNoTime> *&events);
+DLLExport void
+getEventsFrom(const EventList &el,
+              std::vector<CompactWeightedEventNoTime> const *&events);
 
 } // namespace DataObjects
 } // namespace Mantid
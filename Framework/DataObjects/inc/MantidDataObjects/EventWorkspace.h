@@ -137,7 +137,8 @@ public:
   EventSortType getSortType() const;
 
   // Sort all event lists. Uses a parallelized algorithm
-  void sortAll(EventSortType sortType, Mantid::API::Progress *prog) const;
+  void sortAll(EventSortType sortType, Mantid::API::Progress *prog,
+               EventSortMethod method = COMPARISON_SORT) const;
   void sortAllOld(EventSortType sortType, Mantid::API::Progress *prog) const;
 
   void getIntegratedSpectra(std::vector<double> &out, const double minX,
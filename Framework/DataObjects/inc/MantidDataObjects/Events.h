@@ -22,6 +22,8 @@ class LoadEventNexus;
 }
 
 namespace DataObjects {
+class CompactWeightedEventNoTime;
+
 //==========================================================================================
 /** Info about a single neutron detection event, including a weight and error
  *value:
@@ -90,6 +92,7 @@ class DLLExport WeightedEventNoTime {
 
   /// EventList has the right to mess with this
   friend class EventList;
+  friend class CompactWeightedEventNoTime;
   friend class tofGreaterOrEqual;
   friend class tofGreater;
 
@@ -126,6 +129,8 @@ public:
 
   WeightedEventNoTime(const WeightedEvent &);
 
+  WeightedEventNoTime(const CompactWeightedEventNoTime &);
+
   WeightedEventNoTime(const Types::Event::TofEvent &);
 
   WeightedEventNoTime();
@@ -161,6 +166,89 @@ public:
 };
 #pragma pack(pop)
 
+//==========================================================================================
+/** Info about a single neutron detection event, including a weight and error
+ * value, but excluding the pulsetime and with the time-of-flight stored in
+ * single precision (about 7 significant digits) to save memory. At 12 bytes
+ * this is the smallest event type, meant for large weighted workspaces such
+ * as the sum of many compressed runs.
+ */
+#pragma pack(push, 4) // Ensure the structure is no larger than it needs to
+class DLLExport CompactWeightedEventNoTime {
+
+  /// EventList has the right to mess with this
+  friend class EventList;
+  friend class WeightedEventNoTime;
+  friend class tofGreaterOrEqual;
+  friend class tofGreater;
+
+protected:
+  /// The 'x value' (e.g. time-of-flight) of this neutron
+  float m_tof;
+
+public:
+  /// The weight of this neutron.
+  float m_weight;
+
+  /// The SQUARE of the error that this neutron contributes.
+  float m_errorSquared;
+
+public:
+  /// Constructor, specifying only the time of flight
+  CompactWeightedEventNoTime(double time_of_flight);
+
+  /// Constructor, full
+  CompactWeightedEventNoTime(double tof, double weight, double errorSquared);
+  CompactWeightedEventNoTime(double tof, float weight, float errorSquared);
+
+  CompactWeightedEventNoTime(double tof,
+                             const Mantid::Types::Core::DateAndTime pulsetime,
+                             double weight, double errorSquared);
+  CompactWeightedEventNoTime(double tof,
+                             const Mantid::Types::Core::DateAndTime pulsetime,
+                             float weight, float errorSquared);
+
+  CompactWeightedEventNoTime(const Types::Event::TofEvent &, double weight,
+                             double errorSquared);
+  CompactWeightedEventNoTime(const Types::Event::TofEvent &, float weight,
+                             float errorSquared);
+
+  CompactWeightedEventNoTime(const WeightedEvent &);
+
+  CompactWeightedEventNoTime(const WeightedEventNoTime &);
+
+  CompactWeightedEventNoTime(const Types::Event::TofEvent &);
+
+  CompactWeightedEventNoTime();
+
+  bool operator==(const CompactWeightedEventNoTime &rhs) const;
+
+  /** < comparison operator, using the TOF to do the comparison.
+   * @param rhs: the other CompactWeightedEventNoTime to compare.
+   * @return true if this->m_tof < rhs.m_tof
+   */
+  bool operator<(const CompactWeightedEventNoTime &rhs) const {
+    return (this->m_tof < rhs.m_tof);
+  }
+
+  /** < comparison operator, using the TOF to do the comparison.
+   * @param rhs_tof: the other time of flight to compare.
+   * @return true if this->m_tof < rhs.m_tof
+   */
+  bool operator<(const double rhs_tof) const { return (this->m_tof < rhs_tof); }
+
+  bool equals(const CompactWeightedEventNoTime &rhs, const double tolTof,
+              const double tolWeight) const;
+
+  double operator()() const;
+  double tof() const;
+  Mantid::Types::Core::DateAndTime pulseTime() const;
+  double weight() const;
+  double error() const;
+  double errorSquared() const;
+};
+#pragma pack(pop)
+
 //==========================================================================================
 // WeightedEvent inlined member function definitions
 //==========================================================================================
@@ -211,6 +299,36 @@ inline double WeightedEventNoTime::errorSquared() const {
   return m_errorSquared;
 }
 
+//==========================================================================================
+// CompactWeightedEventNoTime inlined member function definitions
+//==========================================================================================
+
+inline double CompactWeightedEventNoTime::operator()() const { return m_tof; }
+
+/// Return the time-of-flight of the neutron, as a double (it is saved as a
+/// float).
+inline double CompactWeightedEventNoTime::tof() const { return m_tof; }
+
+/** Return the pulse time; this returns 0 since this
+ *  type of Event has no time associated.
+ */
+inline Types::Core::DateAndTime CompactWeightedEventNoTime::pulseTime() const {
+  return 0;
+}
+
+/// Return the weight of the neutron, as a double (it is saved as a float).
+inline double CompactWeightedEventNoTime::weight() const { return m_weight; }
+
+/// Return the error of the neutron, as a double (it is saved as a float).
+inline double CompactWeightedEventNoTime::error() const {
+  return std::sqrt(double(m_errorSquared));
+}
+
+/// Return the squared error of the neutron, as a double
+inline double CompactWeightedEventNoTime::errorSquared() const {
+  return m_errorSquared;
+}
+
 } // namespace DataObjects
 } // namespace Mantid
 #endif /// MANTID_DATAOBJECTS_EVENTS_H_
@@ -133,6 +133,7 @@ public:
   void getEventsData(std::vector<coord_t> &coordTable,
                      size_t &nColumns) const override;
   void setEventsData(const std::vector<coord_t> &coordTable) override;
+  void addEventsData(const std::vector<coord_t> &coordTable) override;
 
   size_t addEvent(const MDE &Evnt) override;
   size_t addEventUnsafe(const MDE &Evnt) override;
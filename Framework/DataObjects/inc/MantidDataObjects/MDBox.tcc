@@ -222,12 +222,16 @@ TMDE(std::vector<MDE> &MDBox)::getEvents() {
   if (!m_Saveable)
     return data;
   else {
+    {
+      // The data vector is busy - can't release the memory yet. Marked under
+      // the data lock so the disk buffer is not writing it out meanwhile
+      std::lock_guard<std::mutex> _lock(this->m_dataMutex);
+      m_Saveable->setBusy(true);
+    }
     if (m_Saveable->wasSaved()) { // Load and concatenate the events if needed
       m_Saveable
           ->load(); // this will set isLoaded to true if not already loaded;
     }
-    // The data vector is busy - can't release the memory yet
-    m_Saveable->setBusy(true);
     // the non-const access to events assumes that the data will be modified;
     m_Saveable->setDataChanged();
 
@@ -251,14 +255,18 @@ TMDE(const std::vector<MDE> &MDBox)::getConstEvents() const {
   if (!m_Saveable)
     return data;
   else {
+    {
+      // The data vector is busy - can't release the memory yet. Marked under
+      // the data lock so the disk buffer is not writing it out meanwhile
+      std::lock_guard<std::mutex> _lock(this->m_dataMutex);
+      m_Saveable->setBusy(true);
+    }
     if (m_Saveable->wasSaved()) {
       // Load and concatenate the events if needed
       m_Saveable
           ->load(); // this will set isLoaded to true if not already loaded;
       // This access to data was const. Don't change the m_dataModified flag.
     }
-    // The data vector is busy - can't release the memory yet
-    m_Saveable->setBusy(true);
 
     // Tell the to-write buffer to discard the object (when no longer busy) as
     // it has not been modified
@@ -306,6 +314,16 @@ TMDE(void MDBox)::getEventsData(std::vector<coord_t> &coordTable,
 TMDE(void MDBox)::setEventsData(const std::vector<coord_t> &coordTable) {
   MDE::dataToEvents(coordTable, this->data);
 }
+/** The method to convert the table of data into events, which are appended to
+ * the events already in the box. Reserve the memory for all of the events
+ * with reserveMemoryForLoad first when adding several tables.
+ *   @param coordTable -- vector of events parameters, which will be converted
+ into events
+ */
+TMDE(void MDBox)::addEventsData(const std::vector<coord_t> &coordTable) {
+  std::lock_guard<std::mutex> _lock(this->m_dataMutex);
+  MDE::dataToEvents(coordTable, this->data, false);
+}
 
 //-----------------------------------------------------------------------------------------------
 /** Allocate and return a vector with a copy of all events contained
@@ -827,7 +845,7 @@ TMDE(size_t MDBox)::addEvents(const std::vector<MDE> &events) {
 TMDE(void MDBox)::setFileBacked(const uint64_t fileLocation,
                                 const size_t fileSize, const bool markSaved) {
   if (!m_Saveable)
-    m_Saveable = new MDBoxSaveable(this);
+    m_Saveable = new MDBoxSaveable(this, &this->m_dataMutex);
 
   m_Saveable->setFilePosition(fileLocation, fileSize, markSaved);
 }
@@ -10,6 +10,7 @@
 #include "MantidGeometry/MDGeometry/MDDimensionExtents.h"
 #include "MantidGeometry/MDGeometry/MDImplicitFunction.h"
 #include "MantidKernel/ISaveable.h"
+#include "MantidKernel/SlabAllocator.h"
 #include "MantidKernel/System.h"
 #include "MantidKernel/VMD.h"
 #include <iosfwd>
@@ -57,6 +58,30 @@ public:
   MDBoxBase(const MDBoxBase<MDE, nd> &box,
             Mantid::API::BoxController *const otherBC);
 
+  // -------------------------------- Allocation ----------------------------
+  /// Allocate a box from the heap
+  static void *operator new(size_t size) {
+    return Kernel::SlabAllocator::allocateUnpooled(size);
+  }
+  /** Allocate a box from the allocator of a box controller, usually the one
+   * of the box itself: new (bc) MDBox<MDE, nd>(bc, ...)
+   * @param size :: size of the box
+   * @param bc :: the box controller. If null the box is allocated from the
+   *        heap.
+   * @return memory for the box */
+  static void *operator new(size_t size, API::BoxController *bc) {
+    return bc ? bc->getBoxAllocator().allocate(size)
+              : Kernel::SlabAllocator::allocateUnpooled(size);
+  }
+  /// Return the memory of a box to where it came from
+  static void operator delete(void *ptr) {
+    Kernel::SlabAllocator::deallocate(ptr);
+  }
+  /// Called if the constructor of a box allocated with a box controller throws
+  static void operator delete(void *ptr, API::BoxController *) {
+    Kernel::SlabAllocator::deallocate(ptr);
+  }
+
   ///@return the type of the event this box contains
   std::string getEventType() const override { return MDE::getTypeName(); }
   ///@return the length of the coordinates (in bytes), the events in the box
@@ -100,6 +125,7 @@ public:
            Does nothing for GridBox (may be temporary) -- can be combined with
    build and add events	 */
   void setEventsData(const std::vector<coord_t> & /*coordTable*/) override {}
+  void addEventsData(const std::vector<coord_t> & /*coordTable*/) override {}
   /// Return a copy of contained events
   virtual std::vector<MDE> *getEventsCopy() = 0;
 
@@ -367,7 +393,7 @@ protected:
   /// boxes (e.g. on file). Calculated algorithmically
   size_t m_fileID;
   /// Mutex for modifying the event list or box averages
-  std::mutex m_dataMutex;
+  mutable std::mutex m_dataMutex;
 
 private:
   MDBoxBase(const MDBoxBase<MDE, nd> &box);
@@ -97,6 +97,11 @@ private:
 
   void releaseEvents() const;
 
+  void prefetch(size_t index) const;
+
+  /// How far ahead of the current box to load boxes of file-backed workspaces
+  static const size_t PREFETCH_DISTANCE = 4;
+
   /// Current position in the vector of boxes
   size_t m_pos;
 
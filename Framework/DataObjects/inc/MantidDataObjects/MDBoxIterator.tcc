@@ -86,6 +86,8 @@ TMDE(void MDBoxIterator)::commonConstruct(
   // Get the first box
   if (m_max > 0)
     m_current = dynamic_cast<MDBoxBase<MDE, nd> *>(m_boxes[0]);
+  for (size_t i = 0; i <= PREFETCH_DISTANCE; ++i)
+    prefetch(i);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -131,6 +133,8 @@ TMDE(void MDBoxIterator)::init(std::vector<API::IMDNode *> &boxes, size_t begin,
   // Get the first box
   if (m_max > 0)
     m_current = dynamic_cast<MDBoxBase<MDE, nd> *>(m_boxes[0]);
+  for (size_t i = 0; i <= PREFETCH_DISTANCE; ++i)
+    prefetch(i);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -180,6 +184,7 @@ TMDE(inline bool MDBoxIterator)::next(size_t skip) {
   if (m_pos < m_max) {
     // Move up.
     m_current = dynamic_cast<MDBoxBase<MDE, nd> *>(m_boxes[m_pos]);
+    prefetch(m_pos + PREFETCH_DISTANCE * skip);
     return true;
   } else
     // Done - can't iterate
@@ -216,6 +221,20 @@ TMDE(void MDBoxIterator)::releaseEvents() const {
   }
 }
 
+//----------------------------------------------------------------------------------------------
+/** For file-backed workspaces, ask the disk buffer to load a box that the
+ * iterator will reach soon, so that it is in memory when needed.
+ * @param index :: index of the box. Does nothing if out of range.
+ */
+TMDE(void MDBoxIterator)::prefetch(size_t index) const {
+  if (index >= m_max)
+    return;
+  API::IMDNode *box = m_boxes[index];
+  API::IBoxControllerIO *fileIO = box->getBoxController()->getFileIO();
+  if (fileIO && fileIO->hasIOThread())
+    fileIO->prefetch(box->getISaveable());
+}
+
 //----------------------------------------------------------------------------------------------
 /// Returns the number of entries to be iterated against.
 TMDE(size_t MDBoxIterator)::getDataSize() const { return m_max; }
@@ -4,6 +4,8 @@
 #include "MantidAPI/IMDNode.h"
 #include "MantidKernel/ISaveable.h"
 
+#include <mutex>
+
 namespace Mantid {
 namespace DataObjects {
 
@@ -39,7 +41,7 @@ Code Documentation is available at: <http://doxygen.mantidproject.org>
 */
 class DLLExport MDBoxSaveable : public Kernel::ISaveable {
 public:
-  MDBoxSaveable(API::IMDNode *const);
+  MDBoxSaveable(API::IMDNode *const, std::mutex *const dataMutex = nullptr);
 
   /// Save the data to the place, specified by the object
   void save() const override;
@@ -63,9 +65,15 @@ public:
   size_t getDataMemorySize() const override {
     return m_MDNode->getDataInMemorySize();
   }
+  /// @return the mutex guarding the events of the box
+  std::mutex *getDataMutex() const override { return m_dataMutex; }
 
 private:
   API::IMDNode *const m_MDNode;
+  /// Guards the events of the box, if known
+  std::mutex *const m_dataMutex;
+  /// Stops the data being loaded twice when it is prefetched
+  std::mutex m_loadMutex;
 };
 } // namespace DataObjects
 } // namespace Mantid
@@ -49,7 +49,8 @@ TMDE(MDEventWorkspace)::MDEventWorkspace(
       m_displayNormalizationHisto(preferredNormalizationHisto),
       m_coordSystem(Kernel::None) {
   // First box is at depth 0, and has this default boxController
-  data = new MDBox<MDE, nd>(m_BoxController.get(), 0);
+  data =
+      new (m_BoxController.get()) MDBox<MDE, nd>(m_BoxController.get(), 0);
 }
 
 //-----------------------------------------------------------------------------------------------
@@ -67,9 +68,11 @@ TMDE(MDEventWorkspace)::MDEventWorkspace(const MDEventWorkspace<MDE, nd> &other)
   const MDGridBox<MDE, nd> *mdgridbox =
       dynamic_cast<const MDGridBox<MDE, nd> *>(other.data);
   if (mdbox) {
-    data = new MDBox<MDE, nd>(*mdbox, m_BoxController.get());
+    data = new (m_BoxController.get())
+        MDBox<MDE, nd>(*mdbox, m_BoxController.get());
   } else if (mdgridbox) {
-    data = new MDGridBox<MDE, nd>(*mdgridbox, m_BoxController.get());
+    data = new (m_BoxController.get())
+        MDGridBox<MDE, nd>(*mdgridbox, m_BoxController.get());
   } else {
     throw std::runtime_error(
         "MDEventWorkspace::copy_ctor(): unexpected data box type found.");
@@ -604,7 +607,7 @@ TMDE(void MDEventWorkspace)::splitBox() {
     if (!box)
       throw std::runtime_error("MDEventWorkspace::splitBox() expected its data "
                                "to be a MDBox* to split to MDGridBox.");
-    gridBox = new MDGridBox<MDE, nd>(box);
+    gridBox = new (m_BoxController.get()) MDGridBox<MDE, nd>(box);
     delete data;
     data = gridBox;
   }
@@ -104,6 +104,18 @@ TMDE(MDGridBox)::MDGridBox(MDBox<MDE, nd> *box)
   // Prepare to distribute the events that were in the box before, this will
   // load missing events from HDD in file based ws if there are some.
   const std::vector<MDE> &events = box->getConstEvents();
+  // Count the events going to each child first, so that each child allocates
+  // its events once and without spare capacity
+  std::vector<size_t> numChildEvents(numBoxes, 0);
+  for (const auto &evnt : events) {
+    // Events on the upper boundary go to the last box, as in addEvent()
+    const size_t cindex = calculateChildIndex(evnt);
+    if (cindex <= numBoxes)
+      ++numChildEvents[std::min(cindex, numBoxes - 1)];
+  }
+  for (size_t i = 0; i < numBoxes; ++i)
+    if (numChildEvents[i] > 0)
+      m_Children[i]->reserveMemoryForLoad(numChildEvents[i]);
   // just add event to the existing internal box
   for (const auto & evnt : events)
     addEvent(evnt);
@@ -139,8 +151,9 @@ void MDGridBox<MDE, nd>::fillBoxShell(const size_t tot,
   for (size_t i = 0; i < tot; i++) {
     // Create the box
     // (Increase the depth of this box to one more than the parent (this))
-    auto splitBox = new MDBox<MDE, nd>(
-        this->m_BoxController, this->m_depth + 1, UNDEF_SIZET, size_t(ID0 + i));
+    auto splitBox = new (this->m_BoxController)
+        MDBox<MDE, nd>(this->m_BoxController, this->m_depth + 1, UNDEF_SIZET,
+                       size_t(ID0 + i));
     // This MDGridBox is the parent of the new child.
     splitBox->setParent(this);
 
@@ -198,11 +211,12 @@ TMDE(MDGridBox)::MDGridBox(const MDGridBox<MDE, nd> &other,
     const MDGridBox<MDE, nd> *otherMDGridBox =
         dynamic_cast<const MDGridBox<MDE, nd> *>(otherBox);
     if (otherMDBox) {
-      auto newBox = new MDBox<MDE, nd>(*otherMDBox, otherBC);
+      auto newBox = new (otherBC) MDBox<MDE, nd>(*otherMDBox, otherBC);
       newBox->setParent(this);
       m_Children.push_back(newBox);
     } else if (otherMDGridBox) {
-      auto newBox = new MDGridBox<MDE, nd>(*otherMDGridBox, otherBC);
+      auto newBox =
+          new (otherBC) MDGridBox<MDE, nd>(*otherMDGridBox, otherBC);
       newBox->setParent(this);
       m_Children.push_back(newBox);
     } else {
@@ -652,7 +666,7 @@ TMDE(void MDGridBox)::splitContents(size_t index, Kernel::ThreadScheduler *ts) {
   // Track how many MDBoxes there are in the overall workspace
   this->m_BoxController->trackNumBoxes(box->getDepth());
   // Construct the grid box. This should take the object out of the disk MRU
-  auto gridbox = new MDGridBox<MDE, nd>(box);
+  auto gridbox = new (this->m_BoxController) MDGridBox<MDE, nd>(box);
 
   // Delete the old ungridded box
   delete m_Children[index];
@@ -700,7 +714,8 @@ TMDE(void MDGridBox)::splitAllIfNeeded(Kernel::ThreadScheduler *ts) {
         // The MDBox needs to split into a grid box.
         if (!ts) {
           // ------ Perform split serially (no ThreadPool) ------
-          auto gridBox = new MDGridBox<MDE, nd>(box);
+          auto gridBox =
+              new (this->m_BoxController) MDGridBox<MDE, nd>(box);
           // Track how many MDBoxes there are in the overall workspace
           this->m_BoxController->trackNumBoxes(box->getDepth());
           // Replace in the array
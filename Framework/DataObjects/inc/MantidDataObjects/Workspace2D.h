@@ -107,8 +107,8 @@ protected:
   /// a vector holding workspace index of monitors in the workspace
   std::vector<specnum_t> m_monitorList;
 
-  /// A vector that holds the 1D histograms
-  std::vector<Histogram1D *> data;
+  /// A vector that holds the 1D histograms, stored in one block
+  std::vector<Histogram1D> data;
 
 private:
   Workspace2D *doClone() const override;
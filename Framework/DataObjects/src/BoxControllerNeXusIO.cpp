@@ -464,6 +464,8 @@ void BoxControllerNeXusIO::flushData() const {
 /** flush disk buffer data from memory and close underlying NeXus file*/
 void BoxControllerNeXusIO::closeFile() {
   if (m_File) {
+    // nothing else may be written to the file by the disk buffer
+    this->stopIOThread();
     // write all file-backed data still stack in the data buffer into the file.
     this->flushCache();
     // lock file
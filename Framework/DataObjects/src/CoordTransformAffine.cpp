@@ -278,6 +278,35 @@ void CoordTransformAffine::apply(const coord_t *inputVector,
   }
 }
 
+//----------------------------------------------------------------------------------------------
+/** Apply the coordinate transformation to a block of coordinates stored by
+ * dimension (see CoordTransform::applyMany). Each output dimension is built
+ * up one input dimension at a time, so the inner loops run over contiguous
+ * arrays and are vectorized by the compiler.
+ *
+ * @param inputCoords :: inD * count input values, by dimension
+ * @param outCoords :: outD * count output values, by dimension
+ * @param count :: number of coordinates to transform
+ */
+void CoordTransformAffine::applyMany(const coord_t *inputCoords,
+                                     coord_t *outCoords,
+                                     const size_t count) const {
+  for (size_t out = 0; out < outD; ++out) {
+    const coord_t *rawMatrixRow = m_rawMatrix[out];
+    coord_t *outValues = outCoords + out * count;
+    // The translation, from the homogeneous coordinate
+    const coord_t offset = rawMatrixRow[inD];
+    for (size_t i = 0; i < count; ++i)
+      outValues[i] = offset;
+    for (size_t in = 0; in < inD; ++in) {
+      const coord_t factor = rawMatrixRow[in];
+      const coord_t *inValues = inputCoords + in * count;
+      for (size_t i = 0; i < count; ++i)
+        outValues[i] += factor * inValues[i];
+    }
+  }
+}
+
 //----------------------------------------------------------------------------------------------
 /** Serialize the coordinate transform
  *
@@ -133,6 +133,27 @@ void CoordTransformAligned::apply(const coord_t *inputVector,
   }
 }
 
+//----------------------------------------------------------------------------------------------
+/** Apply the coordinate transformation to a block of coordinates stored by
+ * dimension (see CoordTransform::applyMany).
+ *
+ * @param inputCoords :: inD * count input values, by dimension
+ * @param outCoords :: outD * count output values, by dimension
+ * @param count :: number of coordinates to transform
+ */
+void CoordTransformAligned::applyMany(const coord_t *inputCoords,
+                                      coord_t *outCoords,
+                                      const size_t count) const {
+  for (size_t out = 0; out < outD; ++out) {
+    const coord_t *inValues = inputCoords + m_dimensionToBinFrom[out] * count;
+    coord_t *outValues = outCoords + out * count;
+    const coord_t origin = m_origin[out];
+    const coord_t scaling = m_scaling[out];
+    for (size_t i = 0; i < count; ++i)
+      outValues[i] = (inValues[i] - origin) * scaling;
+  }
+}
+
 //----------------------------------------------------------------------------------------------
 /** Create an equivalent affine transformation matrix out of the
  * parameters of this axis-aligned transformation.
@@ -17,10 +17,14 @@
 #pragma warning(default : 4180)
 #endif
 
+#include <algorithm>
+#include <array>
 #include <cfloat>
 #include <cmath>
+#include <cstring>
 #include <functional>
 #include <limits>
+#include <set>
 #include <stdexcept>
 
 using std::ostream;
@@ -85,6 +89,212 @@ public:
     return (tAtSample1 < tAtSample2);
   }
 };
+
+/**
+ * Computes the index of the bin holding a value directly from the bin edges
+ * when they have a constant width (linear binning) or a constant ratio
+ * (logarithmic binning), as produced by the Rebin parameters. The last bin
+ * is allowed to be narrower, as Rebin truncates it at the upper limit.
+ * Irregular bin edges are flagged so that callers can fall back to a search.
+ */
+class DirectBinIndex {
+public:
+  explicit DirectBinIndex(const MantidVec &X)
+      : m_X(X), m_numBins(X.size() > 1 ? X.size() - 1 : 0), m_type(IRREGULAR),
+        m_xMin(0.), m_invStep(0.) {
+    if (m_numBins < 2)
+      return;
+    const auto difference = [](double x0, double x1) { return x1 - x0; };
+    const auto ratio = [](double x0, double x1) { return x1 / x0; };
+    const double linearStep = difference(X[0], X[1]);
+    if (linearStep > 0. && hasConstantStep(linearStep, difference)) {
+      m_type = LINEAR;
+      m_xMin = X[0];
+      m_invStep = 1. / linearStep;
+    } else if (X[0] > 0. && ratio(X[0], X[1]) > 1. &&
+               hasConstantStep(ratio(X[0], X[1]), ratio)) {
+      m_type = LOGARITHMIC;
+      m_xMin = X[0];
+      m_invStep = 1. / std::log(ratio(X[0], X[1]));
+    }
+  }
+
+  /// @return True if the bin index can be calculated without a search
+  bool isDirect() const { return m_type != IRREGULAR; }
+
+  /**
+   * @param x :: The value to look up. It must be in [X.front(), X.back()).
+   * @return The index i of the bin so that X[i] <= x < X[i + 1]
+   */
+  size_t operator()(const double x) const {
+    double estimate = (m_type == LINEAR) ? (x - m_xMin) * m_invStep
+                                         : std::log(x / m_xMin) * m_invStep;
+    estimate = std::min(std::max(estimate, 0.),
+                        static_cast<double>(m_numBins - 1));
+    auto bin = static_cast<size_t>(estimate);
+    // Correct for any rounding of the estimate.
+    while (bin > 0 && x < m_X[bin])
+      --bin;
+    while (bin + 1 < m_numBins && x >= m_X[bin + 1])
+      ++bin;
+    return bin;
+  }
+
+private:
+  enum BinningType { IRREGULAR, LINEAR, LOGARITHMIC };
+
+  /**
+   * Checks that all of the bins, bar the last which may be truncated, have
+   * the given step.
+   * @param step :: The expected step
+   * @param stepOf :: Function returning the step between two edges
+   * @return True if the step is constant within tolerance
+   */
+  template <typename StepFunction>
+  bool hasConstantStep(const double step, StepFunction stepOf) const {
+    const double tolerance = 1e-6 * std::abs(step);
+    for (size_t i = 1; i + 1 < m_numBins; ++i) {
+      if (std::abs(stepOf(m_X[i], m_X[i + 1]) - step) > tolerance)
+        return false;
+    }
+    const double lastStep = stepOf(m_X[m_numBins - 1], m_X[m_numBins]);
+    return lastStep > 0. && lastStep <= step + tolerance;
+  }
+
+  const MantidVec &m_X;
+  const size_t m_numBins;
+  BinningType m_type;
+  double m_xMin;
+  double m_invStep;
+};
+
+/** Generates both the Y and E (error) histograms for bin edges whose bin
+ * index can be computed directly. The events do not need to be sorted.
+ *
+ * @param events: vector of events
+ * @param X: X-bins supplied
+ * @param binIndex: calculates the bin index of an event from X
+ * @param Y: counts returned
+ * @param E: errors returned
+ */
+template <class T>
+void histogramDirectHelper(const std::vector<T> &events, const MantidVec &X,
+                           const DirectBinIndex &binIndex, MantidVec &Y,
+                           MantidVec &E) {
+  const size_t numBins = X.size() - 1;
+  Y.assign(numBins, 0.0);
+  // Note: Errors will be squared until the last step.
+  E.assign(numBins, 0.0);
+
+  const double xMin = X.front();
+  const double xMax = X.back();
+  for (const auto &event : events) {
+    const double tof = event.tof();
+    // This also rejects NaN
+    if (!(tof >= xMin && tof < xMax))
+      continue;
+    const size_t bin = binIndex(tof);
+    Y[bin] += event.weight();
+    E[bin] += event.errorSquared();
+  }
+
+  std::transform(E.begin(), E.end(), E.begin(),
+                 static_cast<double (*)(double)>(sqrt));
+}
+
+constexpr uint64_t SIGN_BIT = uint64_t(1) << 63;
+
+/** Map a double onto an unsigned integer with the same ordering: flip all
+ * bits of negative numbers and only the sign bit of the others.
+ * @param value :: the number to map
+ * @return the radix sort key
+ */
+uint64_t radixKey(const double value) {
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return (bits & SIGN_BIT) ? ~bits : (bits | SIGN_BIT);
+}
+
+/** Map a signed integer onto an unsigned integer with the same ordering.
+ * @param value :: the number to map
+ * @return the radix sort key
+ */
+uint64_t radixKey(const int64_t value) {
+  return static_cast<uint64_t>(value) ^ SIGN_BIT;
+}
+
+/// Radix sort key of the TOF of an event
+struct TofKey {
+  template <class T> uint64_t operator()(const T &event) const {
+    return radixKey(event.tof());
+  }
+};
+
+/// Radix sort key of the pulse time of an event
+struct PulseTimeKey {
+  template <class T> uint64_t operator()(const T &event) const {
+    return radixKey(event.pulseTime().totalNanoseconds());
+  }
+};
+
+/** Stable least-significant-digit radix sort of events on a 64-bit key, one
+ * byte per pass. Passes over bytes that are the same for all of the events
+ * (e.g. the high bytes of pulse times within a run) are skipped.
+ * @param events :: the events to sort
+ * @param keyOf :: function returning the key of an event
+ */
+template <class T, class KeyFunction>
+void radixSort(std::vector<T> &events, KeyFunction keyOf) {
+  const size_t numEvents = events.size();
+  if (numEvents < 2)
+    return;
+
+  // Compute the keys and count the values of each of their bytes in one go
+  std::vector<uint64_t> keys(numEvents);
+  std::vector<std::array<size_t, 256>> counts(sizeof(uint64_t));
+  for (auto &count : counts)
+    count.fill(0);
+  for (size_t i = 0; i < numEvents; ++i) {
+    const uint64_t key = keyOf(events[i]);
+    keys[i] = key;
+    for (size_t byte = 0; byte < sizeof(uint64_t); ++byte)
+      ++counts[byte][(key >> (8 * byte)) & 0xff];
+  }
+
+  std::vector<T> eventBuffer;
+  std::vector<uint64_t> keyBuffer;
+  for (size_t byte = 0; byte < sizeof(uint64_t); ++byte) {
+    const size_t shift = 8 * byte;
+    auto &offsets = counts[byte];
+    if (offsets[(keys.front() >> shift) & 0xff] == numEvents)
+      continue;
+    size_t offset = 0;
+    for (auto &count : offsets) {
+      const size_t numWithValue = count;
+      count = offset;
+      offset += numWithValue;
+    }
+    if (eventBuffer.empty()) {
+      eventBuffer.resize(numEvents);
+      keyBuffer.resize(numEvents);
+    }
+    for (size_t i = 0; i < numEvents; ++i) {
+      const size_t destination = offsets[(keys[i] >> shift) & 0xff]++;
+      eventBuffer[destination] = events[i];
+      keyBuffer[destination] = keys[i];
+    }
+    events.swap(eventBuffer);
+    keys.swap(keyBuffer);
+  }
+}
+
+/**
+ * @param method :: the requested sort method
+ * @return true if the events should be sorted with radixSort()
+ */
+bool useRadixSort(const EventSortMethod method) {
+  return method == RADIX_SORT;
+}
 } // namespace
 //==========================================================================
 /// --------------------- TofEvent Comparators
@@ -201,6 +411,17 @@ EventList::EventList(const std::vector<WeightedEventNoTime> &events)
   this->order = UNSORTED;
 }
 
+/** Constructor, taking a vector of events.
+ * @param events :: Vector of CompactWeightedEventNoTime's */
+EventList::EventList(const std::vector<CompactWeightedEventNoTime> &events)
+    : m_histogram(HistogramData::Histogram::XMode::BinEdges,
+                  HistogramData::Histogram::YMode::Counts),
+      mru(nullptr) {
+  this->compactEvents.assign(events.begin(), events.end());
+  this->eventType = COMPACT_WEIGHTED_NOTIME;
+  this->order = UNSORTED;
+}
+
 /// Destructor
 EventList::~EventList() {
   // Note: These two lines do not seem to have an effect on releasing memory
@@ -224,6 +445,7 @@ void EventList::copyDataInto(EventList &sink) const {
   sink.events = events;
   sink.weightedEvents = weightedEvents;
   sink.weightedEventsNoTime = weightedEventsNoTime;
+  sink.compactEvents = compactEvents;
   sink.eventType = eventType;
   sink.order = order;
 }
@@ -334,6 +556,7 @@ EventList &EventList::operator=(const EventList &rhs) {
   events = rhs.events;
   weightedEvents = rhs.weightedEvents;
   weightedEventsNoTime = rhs.weightedEventsNoTime;
+  compactEvents = rhs.compactEvents;
   eventType = rhs.eventType;
   order = rhs.order;
   return *this;
@@ -359,6 +582,10 @@ EventList &EventList::operator+=(const TofEvent &event) {
   case WEIGHTED_NOTIME:
     this->weightedEventsNoTime.emplace_back(event);
     break;
+
+  case COMPACT_WEIGHTED_NOTIME:
+    this->compactEvents.emplace_back(event);
+    break;
   }
 
   this->order = UNSORTED;
@@ -398,6 +625,13 @@ EventList &EventList::operator+=(const std::vector<TofEvent> &more_events) {
     for (const auto &more_event : more_events)
       this->weightedEventsNoTime.emplace_back(more_event);
     break;
+
+  case COMPACT_WEIGHTED_NOTIME:
+    this->compactEvents.reserve(this->compactEvents.size() +
+                                more_events.size());
+    for (const auto &more_event : more_events)
+      this->compactEvents.emplace_back(more_event);
+    break;
   }
 
   this->order = UNSORTED;
@@ -450,6 +684,14 @@ operator+=(const std::vector<WeightedEvent> &more_events) {
       this->weightedEventsNoTime.emplace_back(event);
     }
     break;
+
+  case COMPACT_WEIGHTED_NOTIME:
+    this->compactEvents.reserve(this->compactEvents.size() +
+                                more_events.size());
+    for (const auto &event : more_events) {
+      this->compactEvents.emplace_back(event);
+    }
+    break;
   }
 
   this->order = UNSORTED;
@@ -478,6 +720,48 @@ operator+=(const std::vector<WeightedEventNoTime> &more_events) {
     this->weightedEventsNoTime.insert(weightedEventsNoTime.end(),
                                       more_events.begin(), more_events.end());
     break;
+
+  case COMPACT_WEIGHTED_NOTIME:
+    // The list was made compact on purpose, so it stays compact
+    this->compactEvents.insert(compactEvents.end(), more_events.begin(),
+                               more_events.end());
+    break;
+  }
+
+  this->order = UNSORTED;
+  return *this;
+}
+
+// --------------------------------------------------------------------------
+/** Append a list of events to the histogram.
+ * A list with time information is switched to WeightedEventNoTime, so that
+ * the full precision of its own time-of-flight values is kept.
+ *
+ * @param more_events :: A vector of events to append.
+ * @return reference to this
+ * */
+EventList &EventList::
+operator+=(const std::vector<CompactWeightedEventNoTime> &more_events) {
+  switch (this->eventType) {
+  case TOF:
+  case WEIGHTED:
+    // Need to switch to weighted with no time
+    this->switchTo(WEIGHTED_NOTIME);
+    // Fall through to the insertion!
+
+  case WEIGHTED_NOTIME:
+    this->weightedEventsNoTime.reserve(this->weightedEventsNoTime.size() +
+                                       more_events.size());
+    for (const auto &event : more_events) {
+      this->weightedEventsNoTime.emplace_back(event);
+    }
+    break;
+
+  case COMPACT_WEIGHTED_NOTIME:
+    // Simple appending of the two lists
+    this->compactEvents.insert(compactEvents.end(), more_events.begin(),
+                               more_events.end());
+    break;
   }
 
   this->order = UNSORTED;
@@ -507,6 +791,10 @@ EventList &EventList::operator+=(const EventList &more_events) {
   case WEIGHTED_NOTIME:
     this->operator+=(more_events.weightedEventsNoTime);
     break;
+
+  case COMPACT_WEIGHTED_NOTIME:
+    this->operator+=(more_events.compactEvents);
+    break;
   }
 
   // No guaranteed order
@@ -581,6 +869,9 @@ EventList &EventList::operator-=(const EventList &more_events) {
       // TODO: Should this throw?
       minusHelper(this->weightedEvents, more_events.weightedEventsNoTime);
       break;
+    case COMPACT_WEIGHTED_NOTIME:
+      minusHelper(this->weightedEvents, more_events.compactEvents);
+      break;
     }
     break;
 
@@ -595,6 +886,26 @@ EventList &EventList::operator-=(const EventList &more_events) {
     case WEIGHTED_NOTIME:
       minusHelper(this->weightedEventsNoTime, more_events.weightedEventsNoTime);
       break;
+    case COMPACT_WEIGHTED_NOTIME:
+      minusHelper(this->weightedEventsNoTime, more_events.compactEvents);
+      break;
+    }
+    break;
+
+  case COMPACT_WEIGHTED_NOTIME:
+    switch (more_events.getEventType()) {
+    case TOF:
+      minusHelper(this->compactEvents, more_events.events);
+      break;
+    case WEIGHTED:
+      minusHelper(this->compactEvents, more_events.weightedEvents);
+      break;
+    case WEIGHTED_NOTIME:
+      minusHelper(this->compactEvents, more_events.weightedEventsNoTime);
+      break;
+    case COMPACT_WEIGHTED_NOTIME:
+      minusHelper(this->compactEvents, more_events.compactEvents);
+      break;
     }
     break;
   }
@@ -623,6 +934,8 @@ bool EventList::operator==(const EventList &rhs) const {
     return false;
   if (weightedEventsNoTime != rhs.weightedEventsNoTime)
     return false;
+  if (compactEvents != rhs.compactEvents)
+    return false;
   return true;
 }
 
@@ -665,6 +978,13 @@ bool EventList::equals(const EventList &rhs, const double tolTof,
         return false;
     }
     break;
+  case COMPACT_WEIGHTED_NOTIME:
+    for (size_t i = 0; i < numEvents; ++i) {
+      if (!this->compactEvents[i].equals(rhs.compactEvents[i], tolTof,
+                                         tolWeight))
+        return false;
+    }
+    break;
   default:
     break;
   }
@@ -680,8 +1000,8 @@ bool EventList::equals(const EventList &rhs, const double tolTof,
 EventType EventList::getEventType() const { return eventType; }
 
 // -----------------------------------------------------------------------------------------------
-/** Switch the EventList to use the given EventType (TOF, WEIGHTED, or
- * WEIGHTED_NOTIME)
+/** Switch the EventList to use the given EventType (TOF, WEIGHTED,
+ * WEIGHTED_NOTIME or COMPACT_WEIGHTED_NOTIME)
  */
 void EventList::switchTo(EventType newType) {
   switch (newType) {
@@ -700,6 +1020,10 @@ void EventList::switchTo(EventType newType) {
   case WEIGHTED_NOTIME:
     switchToWeightedEventsNoTime();
     break;
+
+  case COMPACT_WEIGHTED_NOTIME:
+    switchToCompactWeightedEventsNoTime();
+    break;
   }
   // Make sure to free memory
   this->clearUnused();
@@ -716,6 +1040,7 @@ void EventList::switchToWeightedEvents() {
     return;
 
   case WEIGHTED_NOTIME:
+  case COMPACT_WEIGHTED_NOTIME:
     throw std::runtime_error("EventList::switchToWeightedEvents() called on an "
                              "EventList with WeightedEventNoTime's. It has "
                              "lost the pulse time information and can't go "
@@ -761,9 +1086,47 @@ void EventList::switchToWeightedEventsNoTime() {
     weightedEvents.clear();
     eventType = WEIGHTED_NOTIME;
   } break;
+
+  case COMPACT_WEIGHTED_NOTIME: {
+    // Widen the time-of-flight back to double precision
+    this->weightedEventsNoTime.assign(compactEvents.cbegin(),
+                                      compactEvents.cend());
+    compactEvents.clear();
+    eventType = WEIGHTED_NOTIME;
+  } break;
   }
 }
 
+// -----------------------------------------------------------------------------------------------
+/** Switch the EventList to use CompactWeightedEventNoTime's instead
+ * of any other event type. This drops the pulse times, if any, and rounds
+ * the times-of-flight to single precision.
+ */
+void EventList::switchToCompactWeightedEventsNoTime() {
+  switch (eventType) {
+  case COMPACT_WEIGHTED_NOTIME:
+    // Do nothing if already there
+    return;
+
+  case TOF:
+    this->compactEvents.assign(events.cbegin(), events.cend());
+    events.clear();
+    break;
+
+  case WEIGHTED:
+    this->compactEvents.assign(weightedEvents.cbegin(), weightedEvents.cend());
+    weightedEvents.clear();
+    break;
+
+  case WEIGHTED_NOTIME:
+    this->compactEvents.assign(weightedEventsNoTime.cbegin(),
+                               weightedEventsNoTime.cend());
+    weightedEventsNoTime.clear();
+    break;
+  }
+  eventType = COMPACT_WEIGHTED_NOTIME;
+}
+
 // ==============================================================================================
 // --- Testing functions (mostly)
 // ---------------------------------------------------------------
@@ -785,6 +1148,10 @@ WeightedEvent EventList::getEvent(size_t event_number) {
     return WeightedEvent(weightedEventsNoTime[event_number].tof(), 0,
                          weightedEventsNoTime[event_number].weight(),
                          weightedEventsNoTime[event_number].errorSquared());
+  case COMPACT_WEIGHTED_NOTIME:
+    return WeightedEvent(compactEvents[event_number].tof(), 0,
+                         compactEvents[event_number].weight(),
+                         compactEvents[event_number].errorSquared());
   }
   throw std::runtime_error("EventList: invalid event type value was found.");
 }
@@ -881,6 +1248,34 @@ EventList::getWeightedEventsNoTime() const {
   return this->weightedEventsNoTime;
 }
 
+/** Return the list of CompactWeightedEventNoTime contained.
+ * NOTE! This should be used for testing purposes only, as much as possible.
+ *
+ * @return a reference to the list of compact weighted events
+ * */
+std::vector<CompactWeightedEventNoTime> &
+EventList::getCompactWeightedEventsNoTime() {
+  if (eventType != COMPACT_WEIGHTED_NOTIME)
+    throw std::runtime_error("EventList::getCompactWeightedEventsNoTime() "
+                             "called for an EventList not of type "
+                             "CompactWeightedEventNoTime.");
+  return this->compactEvents;
+}
+
+/** Return the list of CompactWeightedEventNoTime contained.
+ * NOTE! This should be used for testing purposes only, as much as possible.
+ *
+ * @return a const reference to the list of compact weighted events
+ * */
+const std::vector<CompactWeightedEventNoTime> &
+EventList::getCompactWeightedEventsNoTime() const {
+  if (eventType != COMPACT_WEIGHTED_NOTIME)
+    throw std::runtime_error("EventList::getCompactWeightedEventsNoTime() "
+                             "called for an EventList not of type "
+                             "CompactWeightedEventNoTime.");
+  return this->compactEvents;
+}
+
 /** Clear the list of events and any
  * associated detector ID's.
  * */
@@ -895,6 +1290,9 @@ void EventList::clear(const bool removeDetIDs) {
   this->weightedEventsNoTime.clear();
   std::vector<WeightedEventNoTime>().swap(
       this->weightedEventsNoTime); // STL Trick to release memory
+  this->compactEvents.clear();
+  std::vector<CompactWeightedEventNoTime>().swap(
+      this->compactEvents); // STL Trick to release memory
   if (removeDetIDs)
     this->clearDetectorIDs();
 }
@@ -918,6 +1316,11 @@ void EventList::clearUnused() {
     std::vector<WeightedEventNoTime>().swap(
         this->weightedEventsNoTime); // STL Trick to release memory
   }
+  if (eventType != COMPACT_WEIGHTED_NOTIME) {
+    this->compactEvents.clear();
+    std::vector<CompactWeightedEventNoTime>().swap(
+        this->compactEvents); // STL Trick to release memory
+  }
 }
 
 /// Mask the spectrum to this value. Removes all events.
@@ -947,16 +1350,18 @@ void EventList::reserve(size_t num) { this->events.reserve(num); }
 // --------------------------------------------------------------------------
 /** Sort events by TOF or Frame
  * @param order :: Order by which to sort.
+ * @param method :: Sorting algorithm to use.
  * */
-void EventList::sort(const EventSortType order) const {
+void EventList::sort(const EventSortType order,
+                     const EventSortMethod method) const {
   if (order == UNSORTED) {
     return; // don't bother doing anything. Why did you ask to unsort?
   } else if (order == TOF_SORT) {
-    this->sortTof();
+    this->sortTof(method);
   } else if (order == PULSETIME_SORT) {
-    this->sortPulseTime();
+    this->sortPulseTime(method);
   } else if (order == PULSETIMETOF_SORT) {
-    this->sortPulseTimeTOF();
+    this->sortPulseTimeTOF(method);
   } else if (order == PULSETIMETOF_DELTA_SORT) {
     throw std::invalid_argument("sorting by pulse time with delta requires "
                                 "extra parameters. Use sortPulseTimeTOFDelta "
@@ -979,8 +1384,10 @@ void EventList::setSortOrder(const EventSortType order) const {
 }
 
 // --------------------------------------------------------------------------
-/** Sort events by TOF in one thread */
-void EventList::sortTof() const {
+/** Sort events by TOF in one thread
+ * @param method :: Sorting algorithm to use.
+ */
+void EventList::sortTof(const EventSortMethod method) const {
   if (this->order == TOF_SORT)
     return; // nothing to do
 
@@ -990,16 +1397,32 @@ void EventList::sortTof() const {
   if (this->order == TOF_SORT)
     return;
 
+  const bool radix = useRadixSort(method);
   switch (eventType) {
   case TOF:
-    tbb::parallel_sort(events.begin(), events.end());
+    if (radix)
+      radixSort(events, TofKey());
+    else
+      tbb::parallel_sort(events.begin(), events.end());
     break;
   case WEIGHTED:
-    tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end());
+    if (radix)
+      radixSort(weightedEvents, TofKey());
+    else
+      tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end());
     break;
   case WEIGHTED_NOTIME:
-    tbb::parallel_sort(weightedEventsNoTime.begin(),
-                       weightedEventsNoTime.end());
+    if (radix)
+      radixSort(weightedEventsNoTime, TofKey());
+    else
+      tbb::parallel_sort(weightedEventsNoTime.begin(),
+                         weightedEventsNoTime.end());
+    break;
+  case COMPACT_WEIGHTED_NOTIME:
+    if (radix)
+      radixSort(compactEvents, TofKey());
+    else
+      tbb::parallel_sort(compactEvents.begin(), compactEvents.end());
     break;
   }
   // Save the order to avoid unnecessary re-sorting.
@@ -1044,14 +1467,21 @@ void EventList::sortTimeAtSample(const double &tofFactor,
     tbb::parallel_sort(weightedEventsNoTime.begin(), weightedEventsNoTime.end(),
                        comparitor);
   } break;
+  case COMPACT_WEIGHTED_NOTIME: {
+    CompareTimeAtSample<CompactWeightedEventNoTime> comparitor(tofFactor,
+                                                               tofShift);
+    tbb::parallel_sort(compactEvents.begin(), compactEvents.end(), comparitor);
+  } break;
   }
   // Save the order to avoid unnecessary re-sorting.
   this->order = TIMEATSAMPLE_SORT;
 }
 
 // --------------------------------------------------------------------------
-/** Sort events by Frame */
-void EventList::sortPulseTime() const {
+/** Sort events by Frame
+ * @param method :: Sorting algorithm to use.
+ */
+void EventList::sortPulseTime(const EventSortMethod method) const {
   if (this->order == PULSETIME_SORT)
     return; // nothing to do
 
@@ -1062,15 +1492,23 @@ void EventList::sortPulseTime() const {
     return;
 
   // Perform sort.
+  const bool radix = useRadixSort(method);
   switch (eventType) {
   case TOF:
-    tbb::parallel_sort(events.begin(), events.end(), compareEventPulseTime);
+    if (radix)
+      radixSort(events, PulseTimeKey());
+    else
+      tbb::parallel_sort(events.begin(), events.end(), compareEventPulseTime);
     break;
   case WEIGHTED:
-    tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end(),
-                       compareEventPulseTime);
+    if (radix)
+      radixSort(weightedEvents, PulseTimeKey());
+    else
+      tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end(),
+                         compareEventPulseTime);
     break;
   case WEIGHTED_NOTIME:
+  case COMPACT_WEIGHTED_NOTIME:
     // Do nothing; there is no time to sort
     break;
   }
@@ -1081,8 +1519,9 @@ void EventList::sortPulseTime() const {
 /*
  * Sort events by pulse time + TOF
  * (the absolute time)
+ * @param method :: Sorting algorithm to use.
  */
-void EventList::sortPulseTimeTOF() const {
+void EventList::sortPulseTimeTOF(const EventSortMethod method) const {
   if (this->order == PULSETIMETOF_SORT)
     return; // already ordered.
 
@@ -1092,15 +1531,30 @@ void EventList::sortPulseTimeTOF() const {
   if (this->order == PULSETIMETOF_SORT)
     return;
 
+  // The radix sort is stable: sorting by TOF and then by pulse time orders
+  // the events by pulse time and then TOF.
+  const bool radix = useRadixSort(method);
   switch (eventType) {
   case TOF:
-    tbb::parallel_sort(events.begin(), events.end(), compareEventPulseTimeTOF);
+    if (radix) {
+      radixSort(events, TofKey());
+      radixSort(events, PulseTimeKey());
+    } else {
+      tbb::parallel_sort(events.begin(), events.end(),
+                         compareEventPulseTimeTOF);
+    }
     break;
   case WEIGHTED:
-    tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end(),
-                       compareEventPulseTimeTOF);
+    if (radix) {
+      radixSort(weightedEvents, TofKey());
+      radixSort(weightedEvents, PulseTimeKey());
+    } else {
+      tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end(),
+                         compareEventPulseTimeTOF);
+    }
     break;
   case WEIGHTED_NOTIME:
+  case COMPACT_WEIGHTED_NOTIME:
     // Do nothing; there is no time to sort
     break;
   }
@@ -1133,6 +1587,7 @@ void EventList::sortPulseTimeTOFDelta(const Types::Core::DateAndTime &start,
                        comparator);
     break;
   case WEIGHTED_NOTIME:
+  case COMPACT_WEIGHTED_NOTIME:
     // Do nothing; there is no time to sort
     break;
   }
@@ -1172,6 +1627,9 @@ void EventList::reverse() {
       std::reverse(this->weightedEventsNoTime.begin(),
                    this->weightedEventsNoTime.end());
       break;
+    case COMPACT_WEIGHTED_NOTIME:
+      std::reverse(this->compactEvents.begin(), this->compactEvents.end());
+      break;
     }
     // And we are still sorted! :)
   }
@@ -1194,6 +1652,8 @@ size_t EventList::getNumberEvents() const {
     return this->weightedEvents.size();
   case WEIGHTED_NOTIME:
     return this->weightedEventsNoTime.size();
+  case COMPACT_WEIGHTED_NOTIME:
+    return this->compactEvents.size();
   }
   throw std::runtime_error("EventList: invalid event type value was found.");
 }
@@ -1209,6 +1669,8 @@ bool EventList::empty() const {
     return this->weightedEvents.empty();
   case WEIGHTED_NOTIME:
     return this->weightedEventsNoTime.empty();
+  case COMPACT_WEIGHTED_NOTIME:
+    return this->compactEvents.empty();
   }
   throw std::runtime_error("EventList: invalid event type value was found.");
 }
@@ -1230,6 +1692,10 @@ size_t EventList::getMemorySize() const {
   case WEIGHTED_NOTIME:
     return this->weightedEventsNoTime.capacity() * sizeof(WeightedEventNoTime) +
            sizeof(EventList);
+  case COMPACT_WEIGHTED_NOTIME:
+    return this->compactEvents.capacity() *
+               sizeof(CompactWeightedEventNoTime) +
+           sizeof(EventList);
   }
   throw std::runtime_error("EventList: invalid event type value was found.");
 }
@@ -1452,16 +1918,16 @@ const MantidVec &EventList::dataE() const {
 /** Compress the event list by grouping events with the same TOF.
  *
  * @param events :: input event list.
- * @param out :: output WeightedEventNoTime vector.
+ * @param out :: output WeightedEventNoTime or CompactWeightedEventNoTime
+ *vector.
  * @param tolerance :: how close do two event's TOF have to be to be considered
  *the same.
  */
 
-template <class T>
-inline void
-EventList::compressEventsHelper(const std::vector<T> &events,
-                                std::vector<WeightedEventNoTime> &out,
-                                double tolerance) {
+template <class T, class OUT>
+inline void EventList::compressEventsHelper(const std::vector<T> &events,
+                                            std::vector<OUT> &out,
+                                            double tolerance) {
   // Clear the output. We can't know ahead of time how much space to reserve :(
   out.clear();
   // We will make a starting guess of 1/20th of the number of input events.
@@ -1695,67 +2161,65 @@ inline void EventList::compressFatEventsHelper(
 // --------------------------------------------------------------------------
 /** Compress the event list by grouping events with the same
  * TOF (within a given tolerance). PulseTime is ignored.
- * The event list will be switched to WeightedEventNoTime.
+ * The event list will be switched to WeightedEventNoTime, or to
+ * CompactWeightedEventNoTime if requested or if it already was compact.
  *
  * @param tolerance :: how close do two event's TOF have to be to be considered
  *the same.
  * @param destination :: EventList that will receive the compressed events. Can
  *be == this.
+ * @param compact :: store the compressed events as CompactWeightedEventNoTime
+ *(single precision TOF).
  */
-void EventList::compressEvents(double tolerance, EventList *destination) {
+void EventList::compressEvents(double tolerance, EventList *destination,
+                               const bool compact) {
+  // A compact list stays compact
+  const EventType outputType = (compact || eventType == COMPACT_WEIGHTED_NOTIME)
+                                   ? COMPACT_WEIGHTED_NOTIME
+                                   : WEIGHTED_NOTIME;
   if (!this->empty()) {
     this->sortTof();
-    switch (eventType) {
-    case TOF:
-      //      if (parallel)
-      //        compressEventsParallelHelper(this->events,
-      //        destination->weightedEventsNoTime, tolerance);
-      //      else
-      compressEventsHelper(this->events, destination->weightedEventsNoTime,
-                           tolerance);
-      break;
-
-    case WEIGHTED:
-      //      if (parallel)
-      //        compressEventsParallelHelper(this->weightedEvents,
-      //        destination->weightedEventsNoTime, tolerance);
-      //      else
-      compressEventsHelper(this->weightedEvents,
-                           destination->weightedEventsNoTime, tolerance);
-
-      break;
-
-    case WEIGHTED_NOTIME:
-      if (destination == this) {
-        // Put results in a temp output
-        std::vector<WeightedEventNoTime> out;
-        //        if (parallel)
-        //          compressEventsParallelHelper(this->weightedEventsNoTime,
-        //          out,
-        //          tolerance);
-        //        else
-        compressEventsHelper(this->weightedEventsNoTime, out, tolerance);
-        // Put it back
-        this->weightedEventsNoTime.swap(out);
-      } else {
-        //        if (parallel)
-        //          compressEventsParallelHelper(this->weightedEventsNoTime,
-        //          destination->weightedEventsNoTime, tolerance);
-        //        else
-        compressEventsHelper(this->weightedEventsNoTime,
-                             destination->weightedEventsNoTime, tolerance);
-      }
-      break;
-    }
+    if (outputType == COMPACT_WEIGHTED_NOTIME)
+      compressEventsInto(destination->compactEvents, tolerance);
+    else
+      compressEventsInto(destination->weightedEventsNoTime, tolerance);
   }
-  // In all cases, you end up WEIGHTED_NOTIME.
-  destination->eventType = WEIGHTED_NOTIME;
+  destination->eventType = outputType;
   // The sort is still valid!
   destination->order = TOF_SORT;
   // Empty out storage for vectors that are now unused.
   destination->clearUnused();
 }
 
+// --------------------------------------------------------------------------
+/** Compress the events of this list, whatever their type, into a vector.
+ *
+ * @param out :: output vector. Can be one of the vectors of this list.
+ * @param tolerance :: how close do two event's TOF have to be to be considered
+ *the same.
+ */
+template <class OUT>
+void EventList::compressEventsInto(std::vector<OUT> &out,
+                                   double tolerance) const {
+  // Put results in a temp output, out may be the vector being compressed
+  std::vector<OUT> result;
+  switch (eventType) {
+  case TOF:
+    compressEventsHelper(this->events, result, tolerance);
+    break;
+  case WEIGHTED:
+    compressEventsHelper(this->weightedEvents, result, tolerance);
+    break;
+  case WEIGHTED_NOTIME:
+    compressEventsHelper(this->weightedEventsNoTime, result, tolerance);
+    break;
+  case COMPACT_WEIGHTED_NOTIME:
+    compressEventsHelper(this->compactEvents, result, tolerance);
+    break;
+  }
+  out.swap(result);
+}
+
 void EventList::compressFatEvents(
     const double tolerance, const Mantid::Types::Core::DateAndTime &timeStart,
     const double seconds, EventList *destination) {
@@ -1764,6 +2228,7 @@ void EventList::compressFatEvents(
   if (!this->empty()) {
     switch (eventType) {
     case WEIGHTED_NOTIME:
+    case COMPACT_WEIGHTED_NOTIME:
       throw std::invalid_argument(
           "Cannot compress events that do not have pulsetime");
     case TOF:
@@ -1799,8 +2264,10 @@ void EventList::compressFatEvents(
 // --------------------------------------------------------------------------
 /** Utility function:
  * Returns the iterator into events of the first TofEvent with
- * tof() > seek_tof
+ * tof() >= seek_tof
  * Will return events.end() if nothing is found!
+ * The events must be sorted by TOF; a binary search is used so that the
+ * events below seek_tof are never read.
  *
  * @param events :: event vector in which to look.
  * @param seek_tof :: tof to find (typically the first bin X[0])
@@ -1808,9 +2275,12 @@ void EventList::compressFatEvents(
  */
 template <class T>
 typename std::vector<T>::const_iterator static findFirstEvent(
-    const std::vector<T> &events, T seek_tof) {
-  return std::find_if_not(events.cbegin(), events.cend(),
-                          [seek_tof](const T &x) { return x < seek_tof; });
+    const std::vector<T> &events, const double seek_tof) {
+  // Compare as doubles: an event type storing its TOF as a float could not
+  // represent seek_tof exactly
+  return std::lower_bound(
+      events.cbegin(), events.cend(), seek_tof,
+      [](const T &event, const double tof) { return event.tof() < tof; });
 }
 
 // --------------------------------------------------------------------------
@@ -1827,17 +2297,14 @@ template <class T>
 typename std::vector<T>::const_iterator
 EventList::findFirstPulseEvent(const std::vector<T> &events,
                                const double seek_pulsetime) {
-  auto itev = events.begin();
-  auto itev_end = events.end(); // cache for speed
-
-  // if tof < X[0], that means that you need to skip some events
-  while ((itev != itev_end) &&
-         (static_cast<double>(itev->pulseTime().totalNanoseconds()) <
-          seek_pulsetime))
-    itev++;
-  // Better fix would be to use a binary search instead of the linear one used
-  // here.
-  return itev;
+  // The events are sorted by pulse time so a binary search can skip all the
+  // events before X[0]
+  return std::lower_bound(
+      events.cbegin(), events.cend(), seek_pulsetime,
+      [](const T &event, const double pulsetime) {
+        return static_cast<double>(event.pulseTime().totalNanoseconds()) <
+               pulsetime;
+      });
 }
 
 // --------------------------------------------------------------------------
@@ -1857,23 +2324,22 @@ template <class T>
 typename std::vector<T>::const_iterator EventList::findFirstTimeAtSampleEvent(
     const std::vector<T> &events, const double seek_time,
     const double &tofFactor, const double &tofOffset) const {
-  auto itev = events.cbegin();
-  auto itev_end = events.cend(); // cache for speed
-
-  // if tof < X[0], that means that you need to skip some events
-  while ((itev != itev_end) && (static_cast<double>(calculateCorrectedFullTime(
-                                    *itev, tofFactor, tofOffset)) < seek_time))
-    itev++;
-  // Better fix would be to use a binary search instead of the linear one used
-  // here.
-  return itev;
+  // The events are sorted by time at sample so a binary search can skip all
+  // the events before X[0]
+  return std::lower_bound(
+      events.cbegin(), events.cend(), seek_time,
+      [tofFactor, tofOffset](const T &event, const double time) {
+        return static_cast<double>(calculateCorrectedFullTime(
+                   event, tofFactor, tofOffset)) < time;
+      });
 }
 
 // --------------------------------------------------------------------------
 /** Utility function:
  * Returns the iterator into events of the first TofEvent with
- * tof() > seek_tof
+ * tof() >= seek_tof
  * Will return events.end() if nothing is found!
+ * The events must be sorted by TOF.
  *
  * @param events :: event vector in which to look.
  * @param seek_tof :: tof to find (typically the first bin X[0])
@@ -1881,9 +2347,10 @@ typename std::vector<T>::const_iterator EventList::findFirstTimeAtSampleEvent(
  */
 template <class T>
 typename std::vector<T>::iterator static findFirstEvent(std::vector<T> &events,
-                                                        T seek_tof) {
-  return std::find_if_not(events.begin(), events.end(),
-                          [seek_tof](const T &x) { return x < seek_tof; });
+                                                        const double seek_tof) {
+  return std::lower_bound(
+      events.begin(), events.end(), seek_tof,
+      [](const T &event, const double tof) { return event.tof() < tof; });
 }
 
 // --------------------------------------------------------------------------
@@ -1930,7 +2397,7 @@ void EventList::histogramForWeightsHelper(const std::vector<T> &events,
   // Do we even have any events to do?
   if (!events.empty()) {
     // Iterate through all events (sorted by tof)
-    auto itev = findFirstEvent(events, T(X[0]));
+    auto itev = findFirstEvent(events, X[0]);
     auto itev_end = events.cend();
     // The above can still take you to end() if no events above X[0], so check
     // again.
@@ -2009,6 +2476,7 @@ void EventList::generateHistogramPulseTime(const MantidVec &X, MantidVec &Y,
                              "Events currently"); // This could be supported.
 
   case WEIGHTED_NOTIME:
+  case COMPACT_WEIGHTED_NOTIME:
     throw std::runtime_error(
         "Cannot histogram by pulse time on Weighted Events NoTime");
   }
@@ -2046,6 +2514,7 @@ void EventList::generateHistogramTimeAtSample(const MantidVec &X, MantidVec &Y,
                              "Events currently"); // This could be supported.
 
   case WEIGHTED_NOTIME:
+  case COMPACT_WEIGHTED_NOTIME:
     throw std::runtime_error(
         "Cannot histogram by time at sample on Weighted Events NoTime");
   }
@@ -2063,8 +2532,30 @@ void EventList::generateHistogramTimeAtSample(const MantidVec &X, MantidVec &Y,
  */
 void EventList::generateHistogram(const MantidVec &X, MantidVec &Y,
                                   MantidVec &E, bool skipError) const {
-  // All types of weights need to be sorted by TOF
+  // Unsorted events on linear or logarithmic bins can be histogrammed
+  // directly, which avoids the cost of sorting them first.
+  if (this->order != TOF_SORT) {
+    const DirectBinIndex binIndex(X);
+    if (binIndex.isDirect()) {
+      switch (eventType) {
+      case TOF:
+        histogramDirectHelper(this->events, X, binIndex, Y, E);
+        break;
+      case WEIGHTED:
+        histogramDirectHelper(this->weightedEvents, X, binIndex, Y, E);
+        break;
+      case WEIGHTED_NOTIME:
+        histogramDirectHelper(this->weightedEventsNoTime, X, binIndex, Y, E);
+        break;
+      case COMPACT_WEIGHTED_NOTIME:
+        histogramDirectHelper(this->compactEvents, X, binIndex, Y, E);
+        break;
+      }
+      return;
+    }
+  }
 
+  // All types of weights need to be sorted by TOF
   this->sortTof();
 
   switch (eventType) {
@@ -2082,6 +2573,9 @@ void EventList::generateHistogram(const MantidVec &X, MantidVec &Y,
   case WEIGHTED_NOTIME:
     histogramForWeightsHelper(this->weightedEventsNoTime, X, Y, E);
     break;
+  case COMPACT_WEIGHTED_NOTIME:
+    histogramForWeightsHelper(this->compactEvents, X, Y, E);
+    break;
   }
 }
 
@@ -2298,7 +2792,7 @@ void EventList::generateCountsHistogram(const MantidVec &X,
   if (!this->events.empty()) {
     // Iterate through all events (sorted by tof) placing them in the correct
     // bin.
-    auto itev = findFirstEvent(this->events, TofEvent(X[0]));
+    auto itev = findFirstEvent(this->events, X[0]);
     // Go through all the events,
     for (auto itx = X.cbegin(); itev != events.end(); ++itev) {
       double tof = itev->tof();
@@ -2445,6 +2939,9 @@ void EventList::integrate(const double minX, const double maxX,
     integrateHelper(this->weightedEventsNoTime, minX, maxX, entireRange, sum,
                     error);
     break;
+  case COMPACT_WEIGHTED_NOTIME:
+    integrateHelper(this->compactEvents, minX, maxX, entireRange, sum, error);
+    break;
   default:
     throw std::runtime_error("EventList: invalid event type value was found.");
   }
@@ -2488,6 +2985,9 @@ void EventList::convertTof(std::function<double(double)> func,
   case WEIGHTED_NOTIME:
     this->convertTofHelper(this->weightedEventsNoTime, func);
     break;
+  case COMPACT_WEIGHTED_NOTIME:
+    this->convertTofHelper(this->compactEvents, func);
+    break;
   }
 }
 
@@ -2498,9 +2998,10 @@ void EventList::convertTof(std::function<double(double)> func,
 template <class T>
 void EventList::convertTofHelper(std::vector<T> &events,
                                  std::function<double(double)> func) {
-  // iterate through all events
+  // iterate through all events. The cast is for CompactWeightedEventNoTime,
+  // which stores the TOF as a float.
   for (auto &ev : events)
-    ev.m_tof = func(ev.m_tof);
+    ev.m_tof = static_cast<decltype(ev.m_tof)>(func(ev.m_tof));
 }
 
 // --------------------------------------------------------------------------
@@ -2532,6 +3033,9 @@ void EventList::convertTof(const double factor, const double offset) {
   case WEIGHTED_NOTIME:
     this->convertTofHelper(this->weightedEventsNoTime, factor, offset);
     break;
+  case COMPACT_WEIGHTED_NOTIME:
+    this->convertTofHelper(this->compactEvents, factor, offset);
+    break;
   }
 }
 
@@ -2549,7 +3053,8 @@ void EventList::convertTofHelper(std::vector<T> &events, const double factor,
                                  const double offset) {
   // iterate through all events
   for (auto &event : events) {
-    event.m_tof = event.m_tof * factor + offset;
+    event.m_tof =
+        static_cast<decltype(event.m_tof)>(event.m_tof * factor + offset);
   }
 }
 
@@ -2602,6 +3107,7 @@ void EventList::addPulsetime(const double seconds) {
     this->addPulsetimeHelper(this->weightedEvents, seconds);
     break;
   case WEIGHTED_NOTIME:
+  case COMPACT_WEIGHTED_NOTIME:
     throw std::runtime_error("EventList::addPulsetime() called on an event "
                              "list with no pulse times. You must call this "
                              "algorithm BEFORE CompressEvents.");
@@ -2683,6 +3189,10 @@ void EventList::maskTof(const double tofMin, const double tofMax) {
     numOrig = this->weightedEventsNoTime.size();
     numDel = this->maskTofHelper(this->weightedEventsNoTime, tofMin, tofMax);
     break;
+  case COMPACT_WEIGHTED_NOTIME:
+    numOrig = this->compactEvents.size();
+    numDel = this->maskTofHelper(this->compactEvents, tofMin, tofMax);
+    break;
   }
 
   if (numDel >= numOrig)
@@ -2721,6 +3231,9 @@ void EventList::getTofs(std::vector<double> &tofs) const {
   case WEIGHTED_NOTIME:
     this->getTofsHelper(this->weightedEventsNoTime, tofs);
     break;
+  case COMPACT_WEIGHTED_NOTIME:
+    this->getTofsHelper(this->compactEvents, tofs);
+    break;
   }
 }
 
@@ -2764,6 +3277,9 @@ void EventList::getWeights(std::vector<double> &weights) const {
   case WEIGHTED_NOTIME:
     this->getWeightsHelper(this->weightedEventsNoTime, weights);
     break;
+  case COMPACT_WEIGHTED_NOTIME:
+    this->getWeightsHelper(this->compactEvents, weights);
+    break;
   default:
     // not a weighted event type, return 1.0 for all.
     weights.assign(this->getNumberEvents(), 1.0);
@@ -2811,6 +3327,9 @@ void EventList::getWeightErrors(std::vector<double> &weightErrors) const {
   case WEIGHTED_NOTIME:
     this->getWeightErrorsHelper(this->weightedEventsNoTime, weightErrors);
     break;
+  case COMPACT_WEIGHTED_NOTIME:
+    this->getWeightErrorsHelper(this->compactEvents, weightErrors);
+    break;
   default:
     // not a weighted event type, return 1.0 for all.
     weightErrors.assign(this->getNumberEvents(), 1.0);
@@ -2864,6 +3383,9 @@ std::vector<Mantid::Types::Core::DateAndTime> EventList::getPulseTimes() const {
   case WEIGHTED_NOTIME:
     this->getPulseTimesHelper(this->weightedEventsNoTime, times);
     break;
+  case COMPACT_WEIGHTED_NOTIME:
+    this->getPulseTimesHelper(this->compactEvents, times);
+    break;
   }
   return times;
 }
@@ -2889,6 +3411,8 @@ double EventList::getTofMin() const {
       return this->weightedEvents.begin()->tof();
     case WEIGHTED_NOTIME:
       return this->weightedEventsNoTime.begin()->tof();
+    case COMPACT_WEIGHTED_NOTIME:
+      return this->compactEvents.begin()->tof();
     }
   }
 
@@ -2906,6 +3430,9 @@ double EventList::getTofMin() const {
     case WEIGHTED_NOTIME:
       temp = this->weightedEventsNoTime[i].tof();
       break;
+    case COMPACT_WEIGHTED_NOTIME:
+      temp = this->compactEvents[i].tof();
+      break;
     }
     if (temp < tMin)
       tMin = temp;
@@ -2935,6 +3462,8 @@ double EventList::getTofMax() const {
       return this->weightedEvents.rbegin()->tof();
     case WEIGHTED_NOTIME:
       return this->weightedEventsNoTime.rbegin()->tof();
+    case COMPACT_WEIGHTED_NOTIME:
+      return this->compactEvents.rbegin()->tof();
     }
   }
 
@@ -2952,6 +3481,9 @@ double EventList::getTofMax() const {
     case WEIGHTED_NOTIME:
       temp = this->weightedEventsNoTime[i].tof();
       break;
+    case COMPACT_WEIGHTED_NOTIME:
+      temp = this->compactEvents[i].tof();
+      break;
     }
     if (temp > tMax)
       tMax = temp;
@@ -2980,6 +3512,8 @@ DateAndTime EventList::getPulseTimeMin() const {
       return this->weightedEvents.begin()->pulseTime();
     case WEIGHTED_NOTIME:
       return this->weightedEventsNoTime.begin()->pulseTime();
+    case COMPACT_WEIGHTED_NOTIME:
+      return this->compactEvents.begin()->pulseTime();
     }
   }
 
@@ -2997,6 +3531,9 @@ DateAndTime EventList::getPulseTimeMin() const {
     case WEIGHTED_NOTIME:
       temp = this->weightedEventsNoTime[i].pulseTime();
       break;
+    case COMPACT_WEIGHTED_NOTIME:
+      temp = this->compactEvents[i].pulseTime();
+      break;
     }
     if (temp < tMin)
       tMin = temp;
@@ -3024,6 +3561,8 @@ DateAndTime EventList::getPulseTimeMax() const {
       return this->weightedEvents.rbegin()->pulseTime();
     case WEIGHTED_NOTIME:
       return this->weightedEventsNoTime.rbegin()->pulseTime();
+    case COMPACT_WEIGHTED_NOTIME:
+      return this->compactEvents.rbegin()->pulseTime();
     }
   }
 
@@ -3041,6 +3580,9 @@ DateAndTime EventList::getPulseTimeMax() const {
     case WEIGHTED_NOTIME:
       temp = this->weightedEventsNoTime[i].pulseTime();
       break;
+    case COMPACT_WEIGHTED_NOTIME:
+      temp = this->compactEvents[i].pulseTime();
+      break;
     }
     if (temp > tMax)
       tMax = temp;
@@ -3074,6 +3616,10 @@ void EventList::getPulseTimeMinMax(
       tMin = this->weightedEventsNoTime.begin()->pulseTime();
       tMax = this->weightedEventsNoTime.rbegin()->pulseTime();
       return;
+    case COMPACT_WEIGHTED_NOTIME:
+      tMin = this->compactEvents.begin()->pulseTime();
+      tMax = this->compactEvents.rbegin()->pulseTime();
+      return;
     }
   }
 
@@ -3091,6 +3637,9 @@ void EventList::getPulseTimeMinMax(
     case WEIGHTED_NOTIME:
       temp = this->weightedEventsNoTime[i].pulseTime();
       break;
+    case COMPACT_WEIGHTED_NOTIME:
+      temp = this->compactEvents[i].pulseTime();
+      break;
     }
     if (temp > tMax)
       tMax = temp;
@@ -3120,6 +3669,9 @@ DateAndTime EventList::getTimeAtSampleMax(const double &tofFactor,
     case WEIGHTED_NOTIME:
       return calculateCorrectedFullTime(*(this->weightedEventsNoTime.rbegin()),
                                         tofFactor, tofOffset);
+    case COMPACT_WEIGHTED_NOTIME:
+      return calculateCorrectedFullTime(*(this->compactEvents.rbegin()),
+                                        tofFactor, tofOffset);
     }
   }
 
@@ -3139,6 +3691,10 @@ DateAndTime EventList::getTimeAtSampleMax(const double &tofFactor,
       temp = calculateCorrectedFullTime(this->weightedEventsNoTime[i],
                                         tofFactor, tofOffset);
       break;
+    case COMPACT_WEIGHTED_NOTIME:
+      temp = calculateCorrectedFullTime(this->compactEvents[i], tofFactor,
+                                        tofOffset);
+      break;
     }
     if (temp > tMax)
       tMax = temp;
@@ -3167,6 +3723,9 @@ DateAndTime EventList::getTimeAtSampleMin(const double &tofFactor,
     case WEIGHTED_NOTIME:
       return calculateCorrectedFullTime(*(this->weightedEventsNoTime.begin()),
                                         tofFactor, tofOffset);
+    case COMPACT_WEIGHTED_NOTIME:
+      return calculateCorrectedFullTime(*(this->compactEvents.begin()),
+                                        tofFactor, tofOffset);
     }
   }
 
@@ -3186,6 +3745,10 @@ DateAndTime EventList::getTimeAtSampleMin(const double &tofFactor,
       temp = calculateCorrectedFullTime(this->weightedEventsNoTime[i],
                                         tofFactor, tofOffset);
       break;
+    case COMPACT_WEIGHTED_NOTIME:
+      temp = calculateCorrectedFullTime(this->compactEvents[i], tofFactor,
+                                        tofOffset);
+      break;
     }
     if (temp < tMin)
       tMin = temp;
@@ -3210,7 +3773,7 @@ void EventList::setTofsHelper(std::vector<T> &events,
     return; // should this throw an exception?
 
   for (size_t i = 0; i < x_size; ++i)
-    events[i].m_tof = tofs[i];
+    events[i].m_tof = static_cast<decltype(events[i].m_tof)>(tofs[i]);
 }
 
 // --------------------------------------------------------------------------
@@ -3233,6 +3796,9 @@ void EventList::setTofs(const MantidVec &tofs) {
   case WEIGHTED_NOTIME:
     this->setTofsHelper(this->weightedEventsNoTime, tofs);
     break;
+  case COMPACT_WEIGHTED_NOTIME:
+    this->setTofsHelper(this->compactEvents, tofs);
+    break;
   }
 }
 
@@ -3339,6 +3905,9 @@ void EventList::multiply(const double value, const double error) {
   case WEIGHTED_NOTIME:
     multiplyHelper(this->weightedEventsNoTime, value, error);
     break;
+  case COMPACT_WEIGHTED_NOTIME:
+    multiplyHelper(this->compactEvents, value, error);
+    break;
   }
 }
 
@@ -3363,7 +3932,7 @@ void EventList::multiplyHistogramHelper(std::vector<T> &events,
   size_t x_size = X.size();
 
   // Iterate through all events (sorted by tof)
-  auto itev = findFirstEvent(events, T(X[0]));
+  auto itev = findFirstEvent(events, X[0]);
   auto itev_end = events.end();
   // The above can still take you to end() if no events above X[0], so check
   // again.
@@ -3462,6 +4031,11 @@ void EventList::multiply(const MantidVec &X, const MantidVec &Y,
     this->sortTof();
     multiplyHistogramHelper(this->weightedEventsNoTime, X, Y, E);
     break;
+  case COMPACT_WEIGHTED_NOTIME:
+    // Sorting by tof is necessary for the algorithm
+    this->sortTof();
+    multiplyHistogramHelper(this->compactEvents, X, Y, E);
+    break;
   }
 }
 
@@ -3486,7 +4060,7 @@ void EventList::divideHistogramHelper(std::vector<T> &events,
   size_t x_size = X.size();
 
   // Iterate through all events (sorted by tof)
-  auto itev = findFirstEvent(events, T(X[0]));
+  auto itev = findFirstEvent(events, X[0]);
   auto itev_end = events.end();
   // The above can still take you to end() if no events above X[0], so check
   // again.
@@ -3599,6 +4173,11 @@ void EventList::divide(const MantidVec &X, const MantidVec &Y,
     this->sortTof();
     divideHistogramHelper(this->weightedEventsNoTime, X, Y, E);
     break;
+  case COMPACT_WEIGHTED_NOTIME:
+    // Sorting by tof is necessary for the algorithm
+    this->sortTof();
+    divideHistogramHelper(this->compactEvents, X, Y, E);
+    break;
   }
 }
 
@@ -3739,6 +4318,7 @@ void EventList::filterByPulseTime(DateAndTime start, DateAndTime stop,
                             output.weightedEvents);
     break;
   case WEIGHTED_NOTIME:
+  case COMPACT_WEIGHTED_NOTIME:
     throw std::runtime_error("EventList::filterByPulseTime() called on an "
                              "EventList that no longer has time information.");
     break;
@@ -3774,6 +4354,7 @@ void EventList::filterByTimeAtSample(Types::Core::DateAndTime start,
                                tofOffset, output.weightedEvents);
     break;
   case WEIGHTED_NOTIME:
+  case COMPACT_WEIGHTED_NOTIME:
     throw std::runtime_error("EventList::filterByTimeAtSample() called on an "
                              "EventList that no longer has full time "
                              "information.");
@@ -3876,6 +4457,7 @@ void EventList::filterInPlace(Kernel::TimeSplitterType &splitter) {
     filterInPlaceHelper(splitter, this->weightedEvents);
     break;
   case WEIGHTED_NOTIME:
+  case COMPACT_WEIGHTED_NOTIME:
     throw std::runtime_error("EventList::filterInPlace() called on an "
                              "EventList that no longer has time information.");
     break;
@@ -3886,7 +4468,7 @@ void EventList::filterInPlace(Kernel::TimeSplitterType &splitter) {
 /** Split the event list into n outputs, operating on a vector of either
  *TofEvent's or WeightedEvent's
  *  Only event's pulse time is used to compare with splitters.
- *  It is a faster and simple version of splitByFullTimeHelper
+ *  It is a faster and simple version of splitByFullTimeSortedHelper
  *
  * @param splitter :: a TimeSplitterType giving where to split
  * @param outputs :: a vector of where the split events will end up. The # of
@@ -3955,7 +4537,7 @@ void EventList::splitByTimeHelper(Kernel::TimeSplitterType &splitter,
  */
 void EventList::splitByTime(Kernel::TimeSplitterType &splitter,
                             std::vector<EventList *> outputs) const {
-  if (eventType == WEIGHTED_NOTIME)
+  if (eventType == WEIGHTED_NOTIME || eventType == COMPACT_WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::splitByTime() called on an EventList "
                              "that no longer has time information.");
 
@@ -3984,105 +4566,144 @@ void EventList::splitByTime(Kernel::TimeSplitterType &splitter,
     splitByTimeHelper(splitter, outputs, this->weightedEvents);
     break;
   case WEIGHTED_NOTIME:
+  case COMPACT_WEIGHTED_NOTIME:
     break;
   }
 }
 
 //------------------------------------------------------------------------------------------------
 /** Split the event list into n outputs, operating on a vector of either
- *TofEvent's or WeightedEvent's
- *  The comparison between neutron event and splitter is based on neutron
- *event's pulse time plus
+ *TofEvent's or WeightedEvent's sorted by their time at the sample.
+ *  The time ranges are walked together with the events: each run of events
+ *that falls into the same range is found by a binary search, so the cost
+ *does not depend on the number of ranges without any events. Each output is
+ *then reserved once and filled with whole runs of events.
  *
- * @param splitter :: a TimeSplitterType giving where to split
- * @param outputs :: a vector of where the split events will end up. The # of
- *entries in there should
- *        be big enough to accommodate the indices.
+ * @param vectimes :: boundaries of the time ranges at the sample in
+ *nanoseconds. Events outside them are not copied anywhere.
+ * @param vecgroups :: the target group of each time range
+ * @param outputs :: a map of where the split events will end up. Events in a
+ *group without an output are not copied.
  * @param events :: either this->events or this->weightedEvents.
- * @param docorrection :: flag to determine whether or not to apply correction
  * @param toffactor :: factor to correct TOF in formula toffactor*tof+tofshift
  * @param tofshift :: amount to shift (in SECOND) to correct TOF in formula:
  *toffactor*tof+tofshift
+ * @return a message listing the groups that have no output
  */
 template <class T>
-void EventList::splitByFullTimeHelper(Kernel::TimeSplitterType &splitter,
-                                      std::map<int, EventList *> outputs,
-                                      typename std::vector<T> &events,
-                                      bool docorrection, double toffactor,
-                                      double tofshift) const {
-  // 1. Prepare to Iterate through the splitter at the same time
-  auto itspl = splitter.begin();
-  auto itspl_end = splitter.end();
-
-  // 2. Prepare to Iterate through all events (sorted by tof)
-  auto itev = events.begin();
-  auto itev_end = events.end();
+std::string EventList::splitByFullTimeSortedHelper(
+    const std::vector<int64_t> &vectimes, const std::vector<int> &vecgroups,
+    const std::map<int, EventList *> &outputs,
+    const typename std::vector<T> &events, double toffactor,
+    double tofshift) const {
+  using EventIterator = typename std::vector<T>::const_iterator;
+  struct EventRun {
+    EventIterator begin;
+    EventIterator end;
+    EventList *output;
+  };
+
+  const auto eventsBefore = [toffactor, tofshift](const T &event,
+                                                  const int64_t time) {
+    return calculateCorrectedFullTime(event, toffactor, tofshift) < time;
+  };
+
+  // Find the runs of events going to each output, skipping those before the
+  // first range
+  std::vector<EventRun> runs;
+  std::set<int> missingGroups;
+  auto first = std::lower_bound(events.cbegin(), events.cend(),
+                                vectimes.front(), eventsBefore);
+  auto boundary = vectimes.cbegin();
+  while (first != events.cend()) {
+    // The end of the range holding the next event
+    boundary = std::upper_bound(
+        boundary, vectimes.cend(),
+        calculateCorrectedFullTime(*first, toffactor, tofshift));
+    if (boundary == vectimes.cend())
+      break;
+    const auto last =
+        std::lower_bound(first, events.cend(), *boundary, eventsBefore);
 
-  // 3. This is the time of the first section. Anything before is thrown out.
-  while (itspl != itspl_end) {
-    // Get the splitting interval times and destination
-    int64_t start = itspl->start().totalNanoseconds();
-    int64_t stop = itspl->stop().totalNanoseconds();
-    const int index = itspl->index();
+    const int group = vecgroups[boundary - vectimes.cbegin() - 1];
+    const auto output = outputs.find(group);
+    if (output != outputs.end() && output->second)
+      runs.push_back(EventRun{first, last, output->second});
+    else
+      missingGroups.insert(group);
+    first = last;
+  }
 
-    // a) Skip the events before the start of the time
-    // TODO This step can be
-    EventList *myOutput = outputs[-1];
-    while (itev != itev_end) {
-      int64_t fulltime;
-      if (docorrection)
-        fulltime = calculateCorrectedFullTime(*itev, toffactor, tofshift);
-      else
-        fulltime = itev->m_pulsetime.totalNanoseconds() +
-                   static_cast<int64_t>(itev->m_tof * 1000);
-      if (fulltime < start) {
-        // a1) Record to index = -1 space
-        const T eventCopy(*itev);
-        myOutput->addEventQuickly(eventCopy);
-        itev++;
-      } else {
-        break;
-      }
-    }
+  // Size each output once and copy the runs into it
+  std::map<EventList *, size_t> numberOfEvents;
+  for (const auto &run : runs)
+    numberOfEvents[run.output] +=
+        static_cast<size_t>(std::distance(run.begin, run.end));
+  for (const auto &output : numberOfEvents) {
+    std::vector<T> *outputEvents;
+    getEventsFrom(*output.first, outputEvents);
+    outputEvents->reserve(outputEvents->size() + output.second);
+    output.first->order = UNSORTED;
+  }
+  for (const auto &run : runs) {
+    std::vector<T> *outputEvents;
+    getEventsFrom(*run.output, outputEvents);
+    outputEvents->insert(outputEvents->end(), run.begin, run.end);
+  }
 
-    // b) Go through all the events that are in the interval (if any)
-    while (itev != itev_end) {
-      int64_t fulltime;
-      if (docorrection)
-        fulltime = itev->m_pulsetime.totalNanoseconds() +
-                   static_cast<int64_t>(toffactor * itev->m_tof * 1000 +
-                                        tofshift * 1.0E9);
-      else
-        fulltime = itev->m_pulsetime.totalNanoseconds() +
-                   static_cast<int64_t>(itev->m_tof * 1000);
-      if (fulltime < stop) {
-        // b1) Copy the event into another
-        const T eventCopy(*itev);
-        EventList *myOutput = outputs[index];
-        // Add the copy to the output
-        myOutput->addEventQuickly(eventCopy);
-        ++itev;
-      } else {
-        break;
-      }
-    }
+  std::stringstream msgss;
+  for (const auto group : missingGroups)
+    msgss << "Group " << group << " has a NULL output EventList. "
+          << "\n";
+  return msgss.str();
+}
 
-    // Go to the next interval
-    ++itspl;
-    // But if we reached the end, then we are done.
-    if (itspl == itspl_end)
-      break;
+//------------------------------------------------------------------------------------------------
+/** Sort the events by their time at the sample and split them into the
+ * outputs.
+ *
+ * @param vectimes :: boundaries of the time ranges in nanoseconds
+ * @param vecgroups :: the target group of each time range
+ * @param outputs :: a map of where the split events will end up
+ * @param docorrection :: flag to determine whether or not to apply correction
+ * @param toffactor :: factor to correct TOF in formula toffactor*tof+tofshift
+ * @param tofshift :: amount to shift (in SECOND) to correct TOF
+ * @return a message listing the groups that have no output
+ */
+std::string EventList::splitByFullTimeSorted(
+    const std::vector<int64_t> &vectimes, const std::vector<int> &vecgroups,
+    const std::map<int, EventList *> &outputs, bool docorrection,
+    double toffactor, double tofshift) const {
+  if (!docorrection) {
+    toffactor = 1.0;
+    tofshift = 0.0;
+  }
+  // A previous sort by time at sample may have used other corrections
+  this->sortTimeAtSample(toffactor, tofshift, true);
 
-    // No need to keep looping through the filter if we are out of events
-    if (itev == itev_end)
-      break;
-  } // END-WHILE Splitter
+  switch (eventType) {
+  case TOF:
+    return splitByFullTimeSortedHelper(vectimes, vecgroups, outputs,
+                                       this->events, toffactor, tofshift);
+  case WEIGHTED:
+    return splitByFullTimeSortedHelper(vectimes, vecgroups, outputs,
+                                       this->weightedEvents, toffactor,
+                                       tofshift);
+  case WEIGHTED_NOTIME:
+  case COMPACT_WEIGHTED_NOTIME:
+    break;
+  }
+  return "TOF type is weighted no time.  Impossible to split. ";
 }
 
 //------------------------------------------------------------------------------------------------
 /** Split the event list into n outputs by event's full time (tof + pulse time)
  *
- * @param splitter :: a TimeSplitterType giving where to split
+ * Events before the start of each splitting interval that are not in an
+ * earlier interval go to output -1. Events after the last interval are not
+ * copied.
+ *
+ * @param splitter :: a TimeSplitterType giving where to split, sorted by time
  * @param outputs :: a map of where the split events will end up. The # of
  *entries in there should
  *        be big enough to accommodate the indices.
@@ -4095,14 +4716,11 @@ void EventList::splitByFullTime(Kernel::TimeSplitterType &splitter,
                                 std::map<int, EventList *> outputs,
                                 bool docorrection, double toffactor,
                                 double tofshift) const {
-  if (eventType == WEIGHTED_NOTIME)
+  if (eventType == WEIGHTED_NOTIME || eventType == COMPACT_WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::splitByTime() called on an EventList "
                              "that no longer has time information.");
 
-  // 1. Start by sorting the event list by pulse time.
-  this->sortPulseTimeTOF();
-
-  // 2. Initialize all the outputs
+  // 1. Initialize all the outputs
   std::map<int, EventList *>::iterator outiter;
   for (outiter = outputs.begin(); outiter != outputs.end(); ++outiter) {
     EventList *opeventlist = outiter->second;
@@ -4115,202 +4733,42 @@ void EventList::splitByFullTime(Kernel::TimeSplitterType &splitter,
 
   // Do nothing if there are no entries
   if (splitter.empty()) {
-    // 3A. Copy all events to group workspace = -1
+    // 2A. Copy all events to group workspace = -1
     (*outputs[-1]) = (*this);
     // this->duplicate(outputs[-1]);
   } else {
-    // 3B. Split
-    switch (eventType) {
-    case TOF:
-      splitByFullTimeHelper(splitter, outputs, this->events, docorrection,
-                            toffactor, tofshift);
-      break;
-    case WEIGHTED:
-      splitByFullTimeHelper(splitter, outputs, this->weightedEvents,
-                            docorrection, toffactor, tofshift);
-      break;
-    case WEIGHTED_NOTIME:
-      break;
-    }
-  }
-}
-
-//------------------------------------------------------------------------------------------------
-/** Split the event list into n outputs, operating on a vector of either
- *TofEvent's or WeightedEvent's
- *  The comparison between neutron event and splitter is based on neutron
- *event's pulse time plus
- *
- * @param vectimes :: a vector of absolute time in nanoseconds serving as
- *boundaries of splitters
- * @param vecgroups :: a vector of integer serving as the target workspace group
- *for splitters
- * @param outputs :: a vector of where the split events will end up. The # of
- *entries in there should
- *        be big enough to accommodate the indices.
- * @param vecEvents :: either this->events or this->weightedEvents.
- * @param docorrection :: flag to determine whether or not to apply correction
- * @param toffactor :: factor multiplied to TOF for correcting event time from
- *detector to sample
- * @param tofshift :: shift in SECOND to TOF for correcting event time from
- *detector to sample
- */
-template <class T>
-std::string EventList::splitByFullTimeVectorSplitterHelper(
-    const std::vector<int64_t> &vectimes, const std::vector<int> &vecgroups,
-    std::map<int, EventList *> outputs, typename std::vector<T> &vecEvents,
-    bool docorrection, double toffactor, double tofshift) const {
-  // Define variables for events
-  // size_t numevents = events.size();
-  typename std::vector<T>::iterator eviter;
-  std::stringstream msgss;
-
-  // Loop through events
-  for (eviter = vecEvents.begin(); eviter != vecEvents.end(); ++eviter) {
-    // Obtain time of event
-    int64_t evabstimens;
-    if (docorrection)
-      evabstimens = eviter->m_pulsetime.totalNanoseconds() +
-                    static_cast<int64_t>(toffactor * eviter->m_tof * 1000 +
-                                         tofshift * 1.0E9);
-    else
-      evabstimens = eviter->m_pulsetime.totalNanoseconds() +
-                    static_cast<int64_t>(eviter->m_tof * 1000);
-
-    // Search in vector
-    int index = static_cast<int>(
-        lower_bound(vectimes.begin(), vectimes.end(), evabstimens) -
-        vectimes.begin());
-    int group;
-    // FIXME - whether lower_bound() equal to vectimes.size()-1 should be
-    // filtered out?
-    if (index == 0 || index > static_cast<int>(vectimes.size() - 1)) {
-      // Event is before first splitter or after last splitter.  Put to -1
-      group = -1;
-    } else {
-      group = vecgroups[index - 1];
-    }
-
-    // Copy event to the proper group
-    EventList *myOutput = outputs[group];
-    if (!myOutput) {
-      std::stringstream errss;
-      errss << "Group " << group << " has a NULL output EventList. "
-            << "\n";
-      msgss << errss.str();
-    } else {
-      const T eventCopy(*eviter);
-      myOutput->addEventQuickly(eventCopy);
-    }
-  }
-
-  return (msgss.str());
-}
-
-//------------------------------------------------------------------------------------------------
-/** Split the event list into n outputs, operating on a vector of either
- *TofEvent's or WeightedEvent's
- *  The comparison between neutron event and splitter is based on neutron
- *event's pulse time plus
- *
- * @param vectimes :: a vector of absolute time in nanoseconds serving as
- *boundaries of splitters
- * @param vecgroups :: a vector of integer serving as the target workspace group
- *for splitters
- * @param outputs :: a vector of where the split events will end up. The # of
- *entries in there should
- *        be big enough to accommodate the indices.
- * @param vecEvents :: either this->events or this->weightedEvents.
- * @param docorrection :: flag to determine whether or not to apply correction
- * @param toffactor :: factor multiplied to TOF for correcting event time from
- *detector to sample
- * @param tofshift :: shift in SECOND to TOF for correcting event time from
- *detector to sample
- */
-template <class T>
-std::string EventList::splitByFullTimeSparseVectorSplitterHelper(
-    const std::vector<int64_t> &vectimes, const std::vector<int> &vecgroups,
-    std::map<int, EventList *> outputs, typename std::vector<T> &vecEvents,
-    bool docorrection, double toffactor, double tofshift) const {
-  // Define variables for events
-  // size_t numevents = events.size();
-  // typename std::vector<T>::iterator eviter;
-  std::stringstream msgss;
-
-  size_t num_splitters = vecgroups.size();
-  // prepare to Iterate through all events (sorted by tof)
-  auto iter_events = vecEvents.begin();
-  auto iter_events_end = vecEvents.end();
-
-  // std::stringstream debug_ss;
-  // debug_ss << "\nFilter events...:\n";
-
-  for (size_t i = 0; i < num_splitters; ++i) {
-    // get one splitter
-    int64_t start_i64 = vectimes[i];
-    int64_t stop_i64 = vectimes[i + 1];
-    int group = vecgroups[i];
-    // debug_ss << "working on splitter: " << i << " from " << start_i64 << " to
-    // " << stop_i64 << "\n";
-
-    // go over events
-    while (iter_events != iter_events_end) {
-      int64_t absolute_time;
-      if (docorrection)
-        absolute_time =
-            iter_events->m_pulsetime.totalNanoseconds() +
-            static_cast<int64_t>(toffactor * iter_events->m_tof * 1000 +
-                                 tofshift * 1.0E9);
-      else
-        absolute_time = iter_events->m_pulsetime.totalNanoseconds() +
-                        static_cast<int64_t>(iter_events->m_tof * 1000);
-
-      // debug_ss << "  event " << iter_events - vecEvents.begin() << " abs.time
-      // = " << absolute_time << "\n";
-
-      if (absolute_time < start_i64) {
-        // event occurs before the splitter. only can happen with first
-        // splitter. Then ignore and move to next
-        ++iter_events;
+    // 2B. Turn the intervals into consecutive time ranges, with the gaps
+    // before each interval going to group -1
+    std::vector<int64_t> vectimes{std::numeric_limits<int64_t>::min()};
+    std::vector<int> vecgroups;
+    vectimes.reserve(2 * splitter.size() + 1);
+    vecgroups.reserve(2 * splitter.size());
+    for (const auto &interval : splitter) {
+      const int64_t start =
+          std::max(interval.start().totalNanoseconds(), vectimes.back());
+      const int64_t stop = interval.stop().totalNanoseconds();
+      if (stop <= start)
         continue;
+      if (start > vectimes.back()) {
+        vectimes.push_back(start);
+        vecgroups.push_back(-1);
       }
+      vectimes.push_back(stop);
+      vecgroups.push_back(interval.index());
+    }
 
-      if (absolute_time < stop_i64) {
-        // in the splitter, then copy the event into another
-        const T eventCopy(*iter_events);
-        // Copy event to the proper group
-        EventList *myOutput = outputs[group];
-        if (!myOutput) {
-          // there is no such group defined. quit for this group
-          std::stringstream errss;
-          errss << "Group " << group << " has a NULL output EventList. "
-                << "\n";
-          msgss << errss.str();
-          throw std::runtime_error(errss.str());
-        }
-        // Add the copy to the output
-        myOutput->addEventQuickly(eventCopy);
-        ++iter_events;
-      } else {
-        // event occurs after the stop time, it should belonged to the next
-        // splitter
-        break;
-      }
-    } // while
-
-    // quit the loop if there is no more event left
-    if (iter_events == iter_events_end)
-      break;
-  } // for splitter
-
-  // std::cout << debug_ss.str();
-
-  return (msgss.str());
+    // 3. Split
+    if (!vecgroups.empty())
+      splitByFullTimeSorted(vectimes, vecgroups, outputs, docorrection,
+                            toffactor, tofshift);
+  }
 }
 
 //----------------------------------------------------------------------------------------------
 /**
  * @brief EventList::splitByFullTimeMatrixSplitter
+ * Events before the first splitting time or after the last one go to group
+ * -1 if there is an output for it, and are not copied otherwise.
  * @param vec_splitters_time  :: vector of splitting times
  * @param vecgroups :: vector of index group for splitters
  * @param vec_outputEventList :: vector of groups of splitted events
@@ -4319,22 +4777,16 @@ std::string EventList::splitByFullTimeSparseVectorSplitterHelper(
  * @param tofshift :: shift to TOF in unit of SECOND for correction
  * @return
  */
-// TODO/FIXME/NOW - Consider to use vector to replace vec_outputEventList and
-// have an option to ignore the un-filtered events!
 std::string EventList::splitByFullTimeMatrixSplitter(
     const std::vector<int64_t> &vec_splitters_time,
     const std::vector<int> &vecgroups,
     std::map<int, EventList *> vec_outputEventList, bool docorrection,
     double toffactor, double tofshift) const {
   // Check validity
-  if (eventType == WEIGHTED_NOTIME)
+  if (eventType == WEIGHTED_NOTIME || eventType == COMPACT_WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::splitByTime() called on an EventList "
                              "that no longer has time information.");
 
-  // Start by sorting the event list by pulse time, if its flag is not set up
-  // right
-  sortPulseTimeTOF();
-
   // Initialize all the output event list
   std::map<int, EventList *>::iterator outiter;
   for (outiter = vec_outputEventList.begin();
@@ -4354,38 +4806,33 @@ std::string EventList::splitByFullTimeMatrixSplitter(
     // Copy all events to group workspace = -1
     (*vec_outputEventList[-1]) = (*this);
     // this->duplicate(outputs[-1]);
+  } else if (vec_outputEventList.count(-1) > 0) {
+    // Send the events outside of the splitters to group -1
+    std::vector<int64_t> vectimes;
+    std::vector<int> vecgroups_all;
+    vectimes.reserve(vec_splitters_time.size() + 2);
+    vecgroups_all.reserve(vecgroups.size() + 2);
+    if (vec_splitters_time.front() > std::numeric_limits<int64_t>::min()) {
+      vectimes.push_back(std::numeric_limits<int64_t>::min());
+      vecgroups_all.push_back(-1);
+    }
+    vectimes.insert(vectimes.end(), vec_splitters_time.begin(),
+                    vec_splitters_time.end());
+    vecgroups_all.insert(vecgroups_all.end(), vecgroups.begin(),
+                         vecgroups.end());
+    if (vec_splitters_time.back() < std::numeric_limits<int64_t>::max()) {
+      vectimes.push_back(std::numeric_limits<int64_t>::max());
+      vecgroups_all.push_back(-1);
+    }
+    debugmessage =
+        splitByFullTimeSorted(vectimes, vecgroups_all, vec_outputEventList,
+                              docorrection, toffactor, tofshift);
   } else {
     // Split
-
-    // Try to find out which filtering algorithm to use by comparing number of
-    // splitters and number of events
-    bool sparse_splitter = vec_splitters_time.size() < this->getNumberEvents();
-
-    switch (eventType) {
-    case TOF:
-      if (sparse_splitter)
-        debugmessage = splitByFullTimeSparseVectorSplitterHelper(
-            vec_splitters_time, vecgroups, vec_outputEventList, this->events,
-            docorrection, toffactor, tofshift);
-      else
-        debugmessage = splitByFullTimeVectorSplitterHelper(
-            vec_splitters_time, vecgroups, vec_outputEventList, this->events,
-            docorrection, toffactor, tofshift);
-      break;
-    case WEIGHTED:
-      if (sparse_splitter)
-        debugmessage = splitByFullTimeSparseVectorSplitterHelper(
-            vec_splitters_time, vecgroups, vec_outputEventList,
-            this->weightedEvents, docorrection, toffactor, tofshift);
-      else
-        debugmessage = splitByFullTimeVectorSplitterHelper(
-            vec_splitters_time, vecgroups, vec_outputEventList,
-            this->weightedEvents, docorrection, toffactor, tofshift);
-      break;
-    case WEIGHTED_NOTIME:
-      debugmessage = "TOF type is weighted no time.  Impossible to split. ";
-      break;
-    }
+    debugmessage =
+        splitByFullTimeSorted(vec_splitters_time, vecgroups,
+                              vec_outputEventList, docorrection, toffactor,
+                              tofshift);
   }
 
   return debugmessage;
@@ -4464,7 +4911,7 @@ void EventList::splitByPulseTimeHelper(Kernel::TimeSplitterType &splitter,
 void EventList::splitByPulseTime(Kernel::TimeSplitterType &splitter,
                                  std::map<int, EventList *> outputs) const {
   // Check for supported event type
-  if (eventType == WEIGHTED_NOTIME)
+  if (eventType == WEIGHTED_NOTIME || eventType == COMPACT_WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::splitByTime() called on an EventList "
                              "that no longer has time information.");
 
@@ -4496,6 +4943,7 @@ void EventList::splitByPulseTime(Kernel::TimeSplitterType &splitter,
       splitByPulseTimeHelper(splitter, outputs, this->weightedEvents);
       break;
     case WEIGHTED_NOTIME:
+    case COMPACT_WEIGHTED_NOTIME:
       break;
     }
   }
@@ -4509,7 +4957,7 @@ void EventList::splitByPulseTimeWithMatrix(
     const std::vector<int64_t> &vec_times, const std::vector<int> &vec_target,
     std::map<int, EventList *> outputs) const {
   // Check for supported event type
-  if (eventType == WEIGHTED_NOTIME)
+  if (eventType == WEIGHTED_NOTIME || eventType == COMPACT_WEIGHTED_NOTIME)
     throw std::runtime_error("EventList::splitByTime() called on an EventList "
                              "that no longer has time information.");
 
@@ -4543,6 +4991,7 @@ void EventList::splitByPulseTimeWithMatrix(
                                        this->weightedEvents);
       break;
     case WEIGHTED_NOTIME:
+    case COMPACT_WEIGHTED_NOTIME:
       break;
     }
   }
@@ -4659,6 +5108,25 @@ void getEventsFrom(const EventList &el,
   events = &el.getWeightedEventsNoTime();
 }
 
+//--------------------------------------------------------------------------
+/** Get the vector of events contained in an EventList;
+ * this is overloaded by event type.
+ *
+ * @param el :: The EventList to retrieve
+ * @param[out] events :: reference to a pointer to a vector of this type of
+ *event.
+ *             The pointer will be set to point to the vector.
+ * @throw runtime_error if you call this on the wrong type of EventList.
+ */
+void getEventsFrom(EventList &el,
+                   std::vector<CompactWeightedEventNoTime> *&events) {
+  events = &el.getCompactWeightedEventsNoTime();
+}
+void getEventsFrom(const EventList &el,
+                   std::vector<CompactWeightedEventNoTime> const *&events) {
+  events = &el.getCompactWeightedEventsNoTime();
+}
+
 //--------------------------------------------------------------------------
 /** Helper function for the conversion to TOF. This handles the different
  *  event types.
@@ -4671,13 +5139,19 @@ template <class T>
 void EventList::convertUnitsViaTofHelper(typename std::vector<T> &events,
                                          Mantid::Kernel::Unit *fromUnit,
                                          Mantid::Kernel::Unit *toUnit) {
-  auto itev = events.begin();
-  auto itev_end = events.end();
-  for (; itev != itev_end; itev++) {
-    // Conver to TOF
-    double tof = fromUnit->singleToTOF(itev->m_tof);
-    // And back from TOF to whatever
-    itev->m_tof = toUnit->singleFromTOF(tof);
+  // Convert the events in blocks so that the units work on contiguous arrays
+  constexpr size_t blockSize = 1024;
+  std::array<double, blockSize> block;
+  for (size_t start = 0; start < events.size(); start += blockSize) {
+    const size_t count = std::min(blockSize, events.size() - start);
+    auto itev = events.begin() + start;
+    for (size_t i = 0; i < count; ++i)
+      block[i] = itev[i].m_tof;
+    // Convert to TOF and back from TOF to whatever
+    fromUnit->manyToTOF(block.data(), count);
+    toUnit->manyFromTOF(block.data(), count);
+    for (size_t i = 0; i < count; ++i)
+      itev[i].m_tof = static_cast<decltype(itev->m_tof)>(block[i]);
   }
 }
 
@@ -4712,6 +5186,9 @@ void EventList::convertUnitsViaTof(Mantid::Kernel::Unit *fromUnit,
   case WEIGHTED_NOTIME:
     convertUnitsViaTofHelper(this->weightedEventsNoTime, fromUnit, toUnit);
     break;
+  case COMPACT_WEIGHTED_NOTIME:
+    convertUnitsViaTofHelper(this->compactEvents, fromUnit, toUnit);
+    break;
   }
 }
 
@@ -4728,7 +5205,8 @@ void EventList::convertUnitsQuicklyHelper(typename std::vector<T> &events,
                                           const double &power) {
   for (auto &event : events) {
     // Output unit = factor * (input) ^ power
-    event.m_tof = factor * std::pow(event.m_tof, power);
+    event.m_tof = static_cast<decltype(event.m_tof)>(
+        factor * std::pow(event.m_tof, power));
   }
 }
 
@@ -4749,6 +5227,9 @@ void EventList::convertUnitsQuickly(const double &factor, const double &power) {
   case WEIGHTED_NOTIME:
     convertUnitsQuicklyHelper(this->weightedEventsNoTime, factor, power);
     break;
+  case COMPACT_WEIGHTED_NOTIME:
+    convertUnitsQuicklyHelper(this->compactEvents, factor, power);
+    break;
   }
 }
 
@@ -409,7 +409,7 @@ Mantid::API::EventType EventWorkspace::getEventType() const {
     if (static_cast<int>(out) < static_cast<int>(thisType)) {
       out = thisType;
       // This is the most-specialized it can get.
-      if (out == Mantid::API::WEIGHTED_NOTIME)
+      if (out == Mantid::API::COMPACT_WEIGHTED_NOTIME)
         return out;
     }
   }
@@ -604,13 +604,14 @@ class EventSortingTask {
 public:
   /// ctor
   EventSortingTask(const EventWorkspace *WS, EventSortType sortType,
-                   Mantid::API::Progress *prog)
-      : m_sortType(sortType), m_WS(WS), prog(prog) {}
+                   EventSortMethod sortMethod, Mantid::API::Progress *prog)
+      : m_sortType(sortType), m_sortMethod(sortMethod), m_WS(WS),
+        prog(prog) {}
 
   // Execute the sort as specified.
   void operator()(const tbb::blocked_range<size_t> &range) const {
     for (size_t wi = range.begin(); wi < range.end(); ++wi) {
-      m_WS->getSpectrum(wi).sort(m_sortType);
+      m_WS->getSpectrum(wi).sort(m_sortType, m_sortMethod);
     }
     // Report progress
     if (prog)
@@ -620,6 +621,8 @@ public:
 private:
   /// How to sort
   EventSortType m_sortType;
+  /// Sorting algorithm
+  EventSortMethod m_sortMethod;
   /// EventWorkspace on which to sort
   const EventWorkspace *m_WS;
   /// Optional Progress dialog.
@@ -644,9 +647,11 @@ EventSortType EventWorkspace::getSortType() const {
  * @param sortType :: How to sort the event lists.
  * @param prog :: a progress report object. If the pointer is not NULL, each
  * event list will call prog.report() once.
+ * @param method :: Sorting algorithm to use for the event lists.
  */
 void EventWorkspace::sortAll(EventSortType sortType,
-                             Mantid::API::Progress *prog) const {
+                             Mantid::API::Progress *prog,
+                             EventSortMethod method) const {
   if (this->getSortType() == sortType) {
     if (prog != nullptr) {
       prog->reportIncrement(this->data.size());
@@ -655,7 +660,7 @@ void EventWorkspace::sortAll(EventSortType sortType,
   }
 
   // Create the thread pool, and optimize by doing the longest sorts first.
-  EventSortingTask task(this, sortType, prog);
+  EventSortingTask task(this, sortType, method, prog);
   tbb::parallel_for(tbb::blocked_range<size_t>(0, data.size()), task);
 }
 
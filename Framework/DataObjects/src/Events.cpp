@@ -203,6 +203,13 @@ WeightedEventNoTime::WeightedEventNoTime(const WeightedEvent &rhs)
     : m_tof(rhs.m_tof), m_weight(rhs.m_weight),
       m_errorSquared(rhs.m_errorSquared) {}
 
+/** Constructor, copy from a CompactWeightedEventNoTime object
+ * @param rhs: source CompactWeightedEventNoTime
+ */
+WeightedEventNoTime::WeightedEventNoTime(const CompactWeightedEventNoTime &rhs)
+    : m_tof(rhs.m_tof), m_weight(rhs.m_weight),
+      m_errorSquared(rhs.m_errorSquared) {}
+
 /** Constructor, copy from another TofEvent object
  * @param rhs: source TofEvent
  */
@@ -245,5 +252,142 @@ bool WeightedEventNoTime::equals(const WeightedEventNoTime &rhs,
   return true;
 }
 
+//==========================================================================
+/// ----------------- CompactWeightedEventNoTime stuff ---------------------
+//==========================================================================
+
+/** Constructor, tof only:
+ * @param time_of_flight: tof in microseconds.
+ */
+CompactWeightedEventNoTime::CompactWeightedEventNoTime(double time_of_flight)
+    : m_tof(static_cast<float>(time_of_flight)), m_weight(1.0),
+      m_errorSquared(1.0) {}
+
+/** Constructor, full:
+ * @param tof: tof in microseconds.
+ * @param weight: weight of this neutron event.
+ * @param errorSquared: the square of the error on the event
+ */
+CompactWeightedEventNoTime::CompactWeightedEventNoTime(double tof,
+                                                       double weight,
+                                                       double errorSquared)
+    : m_tof(static_cast<float>(tof)), m_weight(static_cast<float>(weight)),
+      m_errorSquared(static_cast<float>(errorSquared)) {}
+
+/** Constructor, full:
+ * @param tof: tof in microseconds.
+ * @param weight: weight of this neutron event.
+ * @param errorSquared: the square of the error on the event
+ */
+CompactWeightedEventNoTime::CompactWeightedEventNoTime(double tof, float weight,
+                                                       float errorSquared)
+    : m_tof(static_cast<float>(tof)), m_weight(weight),
+      m_errorSquared(errorSquared) {}
+
+/** Constructor that ignores a time:
+ * @param tof: tof in microseconds.
+ * @param pulsetime: an ignored pulse time.
+ * @param weight: weight of this neutron event.
+ * @param errorSquared: the square of the error on the event
+ */
+CompactWeightedEventNoTime::CompactWeightedEventNoTime(
+    double tof, const Mantid::Types::Core::DateAndTime, double weight,
+    double errorSquared)
+    : m_tof(static_cast<float>(tof)), m_weight(static_cast<float>(weight)),
+      m_errorSquared(static_cast<float>(errorSquared)) {}
+
+/** Constructor that ignores a time:
+ * @param tof: tof in microseconds.
+ * @param pulsetime: an ignored pulse time.
+ * @param weight: weight of this neutron event.
+ * @param errorSquared: the square of the error on the event
+ */
+CompactWeightedEventNoTime::CompactWeightedEventNoTime(
+    double tof, const Mantid::Types::Core::DateAndTime, float weight,
+    float errorSquared)
+    : m_tof(static_cast<float>(tof)), m_weight(weight),
+      m_errorSquared(errorSquared) {}
+
+/** Constructor, copy from a TofEvent object but add weights
+ * @param rhs: TofEvent to copy into this.
+ * @param weight: weight of this neutron event.
+ * @param errorSquared: the square of the error on the event
+ */
+CompactWeightedEventNoTime::CompactWeightedEventNoTime(const TofEvent &rhs,
+                                                       double weight,
+                                                       double errorSquared)
+    : m_tof(static_cast<float>(rhs.m_tof)),
+      m_weight(static_cast<float>(weight)),
+      m_errorSquared(static_cast<float>(errorSquared)) {}
+
+/** Constructor, copy from a TofEvent object but add weights
+ * @param rhs: TofEvent to copy into this.
+ * @param weight: weight of this neutron event.
+ * @param errorSquared: the square of the error on the event
+ */
+CompactWeightedEventNoTime::CompactWeightedEventNoTime(const TofEvent &rhs,
+                                                       float weight,
+                                                       float errorSquared)
+    : m_tof(static_cast<float>(rhs.m_tof)), m_weight(weight),
+      m_errorSquared(errorSquared) {}
+
+/** Constructor, copy from a WeightedEvent object
+ * @param rhs: source WeightedEvent
+ */
+CompactWeightedEventNoTime::CompactWeightedEventNoTime(const WeightedEvent &rhs)
+    : m_tof(static_cast<float>(rhs.m_tof)), m_weight(rhs.m_weight),
+      m_errorSquared(rhs.m_errorSquared) {}
+
+/** Constructor, copy from a WeightedEventNoTime object
+ * @param rhs: source WeightedEventNoTime
+ */
+CompactWeightedEventNoTime::CompactWeightedEventNoTime(
+    const WeightedEventNoTime &rhs)
+    : m_tof(static_cast<float>(rhs.m_tof)), m_weight(rhs.m_weight),
+      m_errorSquared(rhs.m_errorSquared) {}
+
+/** Constructor, copy from another TofEvent object
+ * @param rhs: source TofEvent
+ */
+CompactWeightedEventNoTime::CompactWeightedEventNoTime(const TofEvent &rhs)
+    : m_tof(static_cast<float>(rhs.m_tof)), m_weight(1.0),
+      m_errorSquared(1.0) {}
+
+/// Empty constructor
+CompactWeightedEventNoTime::CompactWeightedEventNoTime()
+    : m_tof(0.0), m_weight(1.0), m_errorSquared(1.0) {}
+
+/** Comparison operator.
+ * @param rhs :: event to which we are comparing.
+ * @return true if all elements of this event are identical
+ *  */
+bool CompactWeightedEventNoTime::
+operator==(const CompactWeightedEventNoTime &rhs) const {
+  return (this->m_tof == rhs.m_tof) && (this->m_weight == rhs.m_weight) &&
+         (this->m_errorSquared == rhs.m_errorSquared);
+}
+
+/**
+ * Compare two events within the specified tolerance
+ *
+ * @param rhs the other CompactWeightedEventNoTime to compare
+ * @param tolTof the tolerance of a difference in m_tof.
+ * @param tolWeight the tolerance of a difference in m_weight
+ * and m_errorSquared.
+ *
+ * @return True if the are the same within the specifed tolerances
+ */
+bool CompactWeightedEventNoTime::equals(const CompactWeightedEventNoTime &rhs,
+                                        const double tolTof,
+                                        const double tolWeight) const {
+  if (std::fabs(this->m_tof - rhs.m_tof) > tolTof)
+    return false;
+  if (std::fabs(this->m_weight - rhs.m_weight) > tolWeight)
+    return false;
+  if (std::fabs(this->m_errorSquared - rhs.m_errorSquared) > tolWeight)
+    return false;
+  return true;
+}
+
 } // namespace DataObjects
 } // namespace Mantid
@@ -4,7 +4,9 @@
 namespace Mantid {
 namespace DataObjects {
 
-MDBoxSaveable::MDBoxSaveable(API::IMDNode *const Host) : m_MDNode(Host) {}
+MDBoxSaveable::MDBoxSaveable(API::IMDNode *const Host,
+                             std::mutex *const dataMutex)
+    : m_MDNode(Host), m_dataMutex(dataMutex) {}
 
 /** flush data out of the file buffer to the HDD */
 void MDBoxSaveable::flushData() const {
@@ -32,6 +34,7 @@ void MDBoxSaveable::save() const {
  * private function called from the DiskBuffer
  */
 void MDBoxSaveable::load() {
+  std::lock_guard<std::mutex> lock(m_loadMutex);
   // Is the data in memory right now (cached copy)?
   if (!m_isLoaded) {
     API::IBoxControllerIO *fileIO = m_MDNode->getBoxController()->getFileIO();
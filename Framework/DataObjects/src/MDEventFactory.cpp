@@ -331,8 +331,8 @@ API::IMDNode *MDEventFactory::createMDBoxLean(
     const std::vector<Mantid::Geometry::MDDimensionExtents<coord_t>>
         &extentsVector,
     const uint32_t depth, const size_t nBoxEvents, const size_t boxID) {
-  return new MDBox<MDLeanEvent<nd>, nd>(splitter, depth, extentsVector,
-                                        nBoxEvents, boxID);
+  return new (splitter) MDBox<MDLeanEvent<nd>, nd>(
+      splitter, depth, extentsVector, nBoxEvents, boxID);
 }
 /**Method to create MDBox for events (Constructor wrapper) with given number of
  * dimensions
@@ -349,8 +349,8 @@ API::IMDNode *MDEventFactory::createMDBoxFat(
     const std::vector<Mantid::Geometry::MDDimensionExtents<coord_t>>
         &extentsVector,
     const uint32_t depth, const size_t nBoxEvents, const size_t boxID) {
-  return new MDBox<MDEvent<nd>, nd>(splitter, depth, extentsVector, nBoxEvents,
-                                    boxID);
+  return new (splitter) MDBox<MDEvent<nd>, nd>(splitter, depth, extentsVector,
+                                               nBoxEvents, boxID);
 }
 /**Method to create MDGridBox for lean events (Constructor wrapper) with given
  * number of dimensions
@@ -367,7 +367,8 @@ API::IMDNode *MDEventFactory::createMDGridBoxLean(
     const std::vector<Mantid::Geometry::MDDimensionExtents<coord_t>>
         &extentsVector,
     const uint32_t depth, const size_t /*nBoxEvents*/, const size_t /*boxID*/) {
-  return new MDGridBox<MDLeanEvent<nd>, nd>(splitter, depth, extentsVector);
+  return new (splitter)
+      MDGridBox<MDLeanEvent<nd>, nd>(splitter, depth, extentsVector);
 }
 /**Method to create MDGridBox for events (Constructor wrapper) with given number
  * of dimensions
@@ -384,7 +385,8 @@ API::IMDNode *MDEventFactory::createMDGridBoxFat(
     const std::vector<Mantid::Geometry::MDDimensionExtents<coord_t>>
         &extentsVector,
     const uint32_t depth, const size_t /*nBoxEvents*/, const size_t /*boxID*/) {
-  return new MDGridBox<MDEvent<nd>, nd>(splitter, depth, extentsVector);
+  return new (splitter)
+      MDGridBox<MDEvent<nd>, nd>(splitter, depth, extentsVector);
 }
 //-------------------------------------------------------------- MD BOX
 // constructor wrapper -- END
@@ -0,0 +1,79 @@
+#ifndef COMPACTWEIGHTEDEVENTNOTIMETEST_H_
+#define COMPACTWEIGHTEDEVENTNOTIMETEST_H_ 1
+
+#include "MantidDataObjects/Events.h"
+#include <cmath>
+#include <cxxtest/TestSuite.h>
+
+using namespace Mantid;
+using namespace Mantid::DataObjects;
+using Mantid::Types::Event::TofEvent;
+
+//==========================================================================================
+class CompactWeightedEventNoTimeTest : public CxxTest::TestSuite {
+public:
+  void testSize() {
+    TS_ASSERT_EQUALS(sizeof(CompactWeightedEventNoTime), 12);
+    TS_ASSERT_LESS_THAN(sizeof(CompactWeightedEventNoTime),
+                        sizeof(WeightedEventNoTime));
+  }
+
+  void testConstructors() {
+    TofEvent e(123, 456);
+    CompactWeightedEventNoTime cen;
+
+    // Empty
+    TS_ASSERT_EQUALS(cen.tof(), 0);
+    TS_ASSERT_EQUALS(cen.pulseTime(), 0);
+    TS_ASSERT_EQUALS(cen.weight(), 1.0);
+    TS_ASSERT_EQUALS(cen.error(), 1.0);
+
+    // From WeightedEvent
+    cen = CompactWeightedEventNoTime(WeightedEvent(456, 789, 2.5, 1.5 * 1.5));
+    TS_ASSERT_EQUALS(cen.tof(), 456);
+    TS_ASSERT_EQUALS(cen.pulseTime(), 0); // Lost the time!
+    TS_ASSERT_EQUALS(cen.weight(), 2.5);
+    TS_ASSERT_EQUALS(cen.error(), 1.5);
+
+    // From WeightedEventNoTime and back
+    WeightedEventNoTime wen(789, 3.5, 0.5 * 0.5);
+    cen = CompactWeightedEventNoTime(wen);
+    TS_ASSERT_EQUALS(cen.tof(), 789);
+    TS_ASSERT_EQUALS(cen.weight(), 3.5);
+    TS_ASSERT_EQUALS(cen.error(), 0.5);
+    TS_ASSERT(WeightedEventNoTime(cen) == wen);
+
+    // Default one weight from TofEvent
+    cen = CompactWeightedEventNoTime(e);
+    TS_ASSERT_EQUALS(cen.tof(), 123);
+    TS_ASSERT_EQUALS(cen.weight(), 1.0);
+    TS_ASSERT_EQUALS(cen.error(), 1.0);
+
+    // Full constructor
+    cen = CompactWeightedEventNoTime(456, 2.5, 1.5 * 1.5);
+    TS_ASSERT_EQUALS(cen.tof(), 456);
+    TS_ASSERT_EQUALS(cen.weight(), 2.5);
+    TS_ASSERT_EQUALS(cen.error(), 1.5);
+  }
+
+  void testTofIsSinglePrecision() {
+    const double tof = 12345.678901234;
+    CompactWeightedEventNoTime cen(tof, 1.0, 1.0);
+    TS_ASSERT_EQUALS(cen.tof(), static_cast<double>(static_cast<float>(tof)));
+    TS_ASSERT_DELTA(cen.tof(), tof, tof * 1e-7);
+  }
+
+  void testComparison() {
+    CompactWeightedEventNoTime cen1(20.0, 1., 1.);
+    CompactWeightedEventNoTime cen2(20.05, 1.05, 1.05);
+
+    TS_ASSERT(cen1 == cen1);
+    TS_ASSERT(!(cen1 == cen2));
+    TS_ASSERT(cen1 < cen2);
+    TS_ASSERT(cen1 < 20.01);
+    TS_ASSERT(cen1.equals(cen2, .1, .1));
+    TS_ASSERT(!cen1.equals(cen2, .01, .1));
+  }
+};
+
+#endif /// COMPACTWEIGHTEDEVENTNOTIMETEST_H_
@@ -13,6 +13,7 @@
 #include <cxxtest/TestSuite.h>
 
 #include <boost/scoped_ptr.hpp>
+#include <vector>
 
 using namespace Mantid;
 using namespace Mantid::Kernel;
@@ -159,6 +160,31 @@ public:
     compare(3, out, expected);
   }
 
+  /** applyMany gives the same results as apply on each coordinate */
+  void test_applyMany() {
+    CoordTransformAffine ct(3, 2);
+    Mantid::Kernel::Matrix<coord_t> mat(3, 4);
+    coord_t values[2][4] = {{0.5, -1.0, 2.0, 3.0}, {1.5, 0.25, -0.75, -2.0}};
+    for (size_t row = 0; row < 2; ++row)
+      for (size_t col = 0; col < 4; ++col)
+        mat[row][col] = values[row][col];
+    mat[2][3] = 1.0;
+    ct.setMatrix(mat);
+
+    const size_t count = 5;
+    // Stored by dimension: all x, then all y, then all z
+    coord_t in[3 * count] = {1, 2, 3, 4, 5, 0, -1, -2, 7, 8, 9, 3, 1, -4, 0};
+    coord_t out[2 * count];
+    ct.applyMany(in, out, count);
+    for (size_t i = 0; i < count; ++i) {
+      coord_t point[3] = {in[i], in[count + i], in[2 * count + i]};
+      coord_t expected[2];
+      ct.apply(point, expected);
+      TS_ASSERT_DELTA(out[i], expected[0], 1e-5);
+      TS_ASSERT_DELTA(out[count + i], expected[1], 1e-5);
+    }
+  }
+
   //-----------------------------------------------------------------------------------------------
   /** Test a case of a rotation 0.1 radians around +Z,
    * and a projection into the XY plane */
@@ -418,6 +444,18 @@ public:
       ct.apply(in, out);
     }
   }
+  void test_applyMany_4D_performance() {
+    CoordTransformAffine ct(4, 4);
+    coord_t translation[4] = {2.0, 3.0, 4.0, 5.0};
+    ct.addTranslation(translation);
+    const size_t count = 1000;
+    std::vector<coord_t> in(4 * count, 1.5);
+    std::vector<coord_t> out(4 * count);
+
+    for (size_t i = 0; i < 1000 * 10; ++i) {
+      ct.applyMany(in.data(), out.data(), count);
+    }
+  }
 };
 
 #endif /* MANTID_DATAOBJECTS_COORDTRANSFORMAFFINETEST_H_ */
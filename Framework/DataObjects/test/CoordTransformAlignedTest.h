@@ -71,6 +71,31 @@ public:
     TS_ASSERT_DELTA(output[2], 3.0, 1e-6);
   }
 
+  /// applyMany gives the same results as apply on each coordinate
+  void test_applyMany() {
+    size_t dimToBinFrom[3] = {3, 1, 0};
+    coord_t origin[3] = {5, 10, 15};
+    coord_t scaling[3] = {1, 2, 3};
+    CoordTransformAligned ct(4, 3, dimToBinFrom, origin, scaling);
+
+    const size_t count = 3;
+    // Stored by dimension
+    coord_t input[4 * count] = {16, 17, 18, 11, 12, 13, 0, 0, 0, 6, 7, 8};
+    coord_t output[3 * count];
+    ct.applyMany(input, output, count);
+    for (size_t i = 0; i < count; ++i) {
+      coord_t point[4] = {input[i], input[count + i], input[2 * count + i],
+                          input[3 * count + i]};
+      coord_t expected[3];
+      ct.apply(point, expected);
+      for (size_t d = 0; d < 3; ++d)
+        TS_ASSERT_DELTA(output[d * count + i], expected[d], 1e-6);
+    }
+    TS_ASSERT_DELTA(output[0], 1.0, 1e-6);
+    TS_ASSERT_DELTA(output[count], 2.0, 1e-6);
+    TS_ASSERT_DELTA(output[2 * count], 3.0, 1e-6);
+  }
+
   /// Clone the transform, check that it still works
   void test_clone() {
     size_t dimToBinFrom[3] = {3, 1, 0};
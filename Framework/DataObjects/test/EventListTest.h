@@ -314,6 +314,113 @@ public:
     TS_ASSERT_EQUALS(el.getWeightedEventsNoTime()[0].error(), 1.0);
   }
 
+  //----------------------------------
+  void test_switchToCompactWeightedEventsNoTime() {
+    // Start with a bit of fake data
+    this->fake_data();
+    const std::vector<TofEvent> original = el.getEvents();
+    el.switchTo(COMPACT_WEIGHTED_NOTIME);
+    TS_ASSERT_THROWS(el.getEvents().size(), std::runtime_error);
+    TS_ASSERT_THROWS(el.getWeightedEventsNoTime().size(), std::runtime_error);
+    TS_ASSERT_EQUALS(el.getCompactWeightedEventsNoTime().size(), NUMEVENTS);
+    TS_ASSERT_EQUALS(el.getNumberEvents(), NUMEVENTS);
+    TS_ASSERT_EQUALS(el.getCompactWeightedEventsNoTime()[0].weight(), 1.0);
+    TS_ASSERT_EQUALS(el.getCompactWeightedEventsNoTime()[0].error(), 1.0);
+
+    // The pulse times are gone
+    TS_ASSERT_THROWS(el.switchTo(WEIGHTED), std::runtime_error);
+    // but the list can be widened to double precision
+    el.switchTo(WEIGHTED_NOTIME);
+    TS_ASSERT_EQUALS(el.getWeightedEventsNoTime().size(), NUMEVENTS);
+    for (size_t i = 0; i < original.size(); ++i)
+      TS_ASSERT_DELTA(el.getEvent(i).tof(), original[i].tof(),
+                      original[i].tof() * 1e-7);
+  }
+
+  //----------------------------------
+  void test_appending_compact_lists() {
+    this->fake_data();
+    EventList compact(el);
+    compact.switchTo(COMPACT_WEIGHTED_NOTIME);
+
+    // A compact list stays compact
+    EventList lhs(compact);
+    lhs += el;
+    TS_ASSERT_EQUALS(lhs.getEventType(), COMPACT_WEIGHTED_NOTIME);
+    TS_ASSERT_EQUALS(lhs.getNumberEvents(), 2 * NUMEVENTS);
+
+    // Other lists keep double precision times-of-flight
+    for (int type = 0; type < 3; ++type) {
+      lhs = el;
+      lhs.switchTo(static_cast<EventType>(type));
+      lhs += compact;
+      TS_ASSERT_EQUALS(lhs.getEventType(), WEIGHTED_NOTIME);
+      TS_ASSERT_EQUALS(lhs.getNumberEvents(), 2 * NUMEVENTS);
+      TS_ASSERT_DELTA(lhs.getEvent(NUMEVENTS).tof(), el.getEvent(0).tof(),
+                      1e-3);
+    }
+
+    // Subtracting leaves no counts
+    lhs = compact;
+    lhs -= el;
+    lhs.setX(one_big_bin());
+    boost::scoped_ptr<MantidVec> Y(lhs.makeDataY());
+    TS_ASSERT_DELTA((*Y)[0], 0.0, 1e-6);
+  }
+
+  //----------------------------------
+  void test_compact_histogram_matches_weighted_no_time() {
+    this->fake_uniform_data(5.0);
+    this->test_setX();
+    el *= 3.2;
+    EventList notime(el);
+    notime.switchTo(WEIGHTED_NOTIME);
+    EventList compact(el);
+    compact.switchTo(COMPACT_WEIGHTED_NOTIME);
+
+    boost::scoped_ptr<MantidVec> Y1(notime.makeDataY());
+    boost::scoped_ptr<MantidVec> E1(notime.makeDataE());
+    boost::scoped_ptr<MantidVec> Y2(compact.makeDataY());
+    boost::scoped_ptr<MantidVec> E2(compact.makeDataE());
+    TS_ASSERT_EQUALS(*Y1, *Y2);
+    TS_ASSERT_EQUALS(*E1, *E2);
+
+    TS_ASSERT_LESS_THAN(compact.getMemorySize(), notime.getMemorySize());
+  }
+
+  //----------------------------------
+  void test_compact_list_with_bin_edge_not_representable_as_float() {
+    // float(0.7) is below 0.7, so an event stored at float(0.7) falls before
+    // the first bin edge and must not be counted
+    el = EventList();
+    el += TofEvent(0.7, 0);
+    el += TofEvent(0.8, 0);
+    el += TofEvent(1.5, 0);
+    el.switchTo(COMPACT_WEIGHTED_NOTIME);
+    const MantidVec X = {0.7, 1.0, 2.0};
+
+    MantidVec Y, E;
+    el.generateHistogram(X, Y, E);
+    TS_ASSERT_EQUALS(Y.size(), 2);
+    TS_ASSERT_EQUALS(Y[0], 1.0);
+    TS_ASSERT_EQUALS(Y[1], 1.0);
+
+    // Scaling by a histogram leaves the event below the first edge untouched
+    const MantidVec factor = {2.0, 3.0};
+    const MantidVec error = {0.0, 0.0};
+    EventList multiplied(el);
+    multiplied.multiply(X, factor, error);
+    TS_ASSERT_EQUALS(multiplied.getEvent(0).weight(), 1.0);
+    TS_ASSERT_EQUALS(multiplied.getEvent(1).weight(), 2.0);
+    TS_ASSERT_EQUALS(multiplied.getEvent(2).weight(), 3.0);
+
+    EventList divided(el);
+    divided.divide(X, factor, error);
+    TS_ASSERT_EQUALS(divided.getEvent(0).weight(), 1.0);
+    TS_ASSERT_EQUALS(divided.getEvent(1).weight(), 0.5);
+    TS_ASSERT_DELTA(divided.getEvent(2).weight(), 1.0 / 3.0, 1e-6);
+  }
+
   //----------------------------------
   void test_switch_on_the_fly_when_adding_single_event() {
     fake_data();
@@ -956,6 +1063,26 @@ public:
     }
   }
 
+  void test_histogram_by_pulse_time_with_first_bin_higher_than_first_event() {
+    EventList eList = this->fake_uniform_pulse_data();
+
+    // Generate the histogram bins starting 10 bins after the first event
+    MantidVec X;
+    for (int pulse_time = BIN_DELTA * 10;
+         pulse_time < BIN_DELTA * (NUMBINS + 1); pulse_time += BIN_DELTA) {
+      X.push_back(pulse_time);
+    }
+    MantidVec Y;
+    MantidVec E;
+
+    eList.generateHistogramPulseTime(X, Y, E);
+
+    TS_ASSERT_EQUALS(Y.size(), X.size() - 1);
+    for (std::size_t i = 0; i < Y.size(); i++) {
+      TS_ASSERT_EQUALS(Y[i], 2.0);
+    }
+  }
+
   void test_histogram_weighed_event_by_pulse_time_throws() {
     EventList eList = this->fake_uniform_pulse_data(WEIGHTED);
 
@@ -1203,6 +1330,50 @@ public:
     }
   }
 
+  void test_histogram_unsorted_linear_bins_matches_sorted() {
+    MantidVec X;
+    for (double tof = 1e5; tof < 9e6; tof += 1e5)
+      X.push_back(tof);
+    // Truncated last bin, as produced by Rebin
+    X.push_back(8.95e6);
+    do_test_histogram_unsorted_matches_sorted(X);
+  }
+
+  void test_histogram_unsorted_logarithmic_bins_matches_sorted() {
+    MantidVec X{1e3};
+    while (X.back() * 1.05 < 1e7)
+      X.push_back(X.back() * 1.05);
+    X.push_back(1e7);
+    do_test_histogram_unsorted_matches_sorted(X);
+  }
+
+  void test_histogram_unsorted_irregular_bins_matches_sorted() {
+    MantidVec X{1e3, 2e3, 1e4, 5e5, 5.5e5, 3e6, 9e6};
+    do_test_histogram_unsorted_matches_sorted(X);
+  }
+
+  void do_test_histogram_unsorted_matches_sorted(const MantidVec &X) {
+    for (auto eventType : {TOF, WEIGHTED, WEIGHTED_NOTIME}) {
+      EventList unsorted = fake_random_tof_constant_pulse_data(TOF, 10000);
+      unsorted.switchTo(eventType);
+      if (eventType != TOF)
+        unsorted *= 2.0;
+      EventList sorted(unsorted);
+      sorted.sortTof();
+
+      MantidVec Yunsorted, Eunsorted, Ysorted, Esorted;
+      unsorted.generateHistogram(X, Yunsorted, Eunsorted);
+      sorted.generateHistogram(X, Ysorted, Esorted);
+
+      TS_ASSERT_EQUALS(Yunsorted.size(), X.size() - 1);
+      TS_ASSERT_EQUALS(Eunsorted.size(), X.size() - 1);
+      for (size_t i = 0; i < Ysorted.size(); ++i) {
+        TS_ASSERT_DELTA(Yunsorted[i], Ysorted[i], 1e-9);
+        TS_ASSERT_DELTA(Eunsorted[i], Esorted[i], 1e-9);
+      }
+    }
+  }
+
   void test_histogram_const_call() {
     this->fake_uniform_data();
     this->test_setX(); // Set it up WITH THE default binning
@@ -1600,6 +1771,46 @@ public:
     }
   }
 
+  void test_radix_sort_matches_comparison_sort() {
+    for (int this_type = 0; this_type < 3; this_type++) {
+      EventType curType = static_cast<EventType>(this_type);
+      for (auto order : {TOF_SORT, PULSETIME_SORT, PULSETIMETOF_SORT}) {
+        if (curType == WEIGHTED_NOTIME && order != TOF_SORT)
+          continue;
+        EventList radix = make_list_for_radix_sort(curType);
+        EventList comparison(radix);
+        radix.sort(order, RADIX_SORT);
+        comparison.sort(order, COMPARISON_SORT);
+        TS_ASSERT_EQUALS(radix.getSortType(), order);
+        TS_ASSERT_EQUALS(radix.getNumberEvents(),
+                         comparison.getNumberEvents());
+        for (size_t i = 0; i < radix.getNumberEvents(); i++) {
+          // Events with equal keys may end up in a different order
+          if (order != PULSETIME_SORT)
+            TS_ASSERT_EQUALS(radix.getEvent(i).tof(),
+                             comparison.getEvent(i).tof());
+          if (order != TOF_SORT)
+            TS_ASSERT_EQUALS(radix.getEvent(i).pulseTime(),
+                             comparison.getEvent(i).pulseTime());
+        }
+      }
+    }
+  }
+
+  void test_radix_sort_is_stable() {
+    EventList el;
+    for (int i = 0; i < 2000; i++)
+      el += TofEvent(static_cast<double>(i % 10), i);
+    el.sortTof(RADIX_SORT);
+    for (size_t i = 1; i < el.getNumberEvents(); i++) {
+      const auto &previous = el.getEvent(i - 1);
+      const auto &current = el.getEvent(i);
+      TS_ASSERT_LESS_THAN_EQUALS(previous.tof(), current.tof());
+      if (previous.tof() == current.tof())
+        TS_ASSERT_LESS_THAN(previous.pulseTime(), current.pulseTime());
+    }
+  }
+
   //-----------------------------------------------------------------------------------------------
   void test_filterByPulseTime() {
     // Go through each possible EventType (except the no-time one) as the input
@@ -1880,6 +2091,60 @@ public:
     return;
   }
 
+  //-----------------------------------------------------------------------------------------------
+  /** Events from a later pulse can reach the sample before those from an
+   * earlier one, so splitting by full time must not rely on the pulse time
+   * order of the events
+   */
+  void test_splitByFullTime_follows_the_time_at_sample() {
+    EventList input;
+    // Full times of 50000, 20000, 110000 and 21000 ns
+    input.addEventQuickly(TofEvent(50.0, DateAndTime(int64_t(0))));
+    input.addEventQuickly(TofEvent(10.0, DateAndTime(int64_t(10000))));
+    input.addEventQuickly(TofEvent(100.0, DateAndTime(int64_t(10000))));
+    input.addEventQuickly(TofEvent(1.0, DateAndTime(int64_t(20000))));
+    input.sortPulseTimeTOF();
+
+    EventList out1, out2, out3, unfiltered;
+    std::map<int, EventList *> outputs{
+        {1, &out1}, {2, &out2}, {3, &out3}, {-1, &unfiltered}};
+
+    const std::vector<int64_t> times{0, 30000, 100000, 200000};
+    const std::vector<int> groups{1, 2, 3};
+    input.splitByFullTimeMatrixSplitter(times, groups, outputs, false, 1.0,
+                                        0.0);
+    TS_ASSERT_EQUALS(out1.getNumberEvents(), 2);
+    TS_ASSERT_EQUALS(out2.getNumberEvents(), 1);
+    TS_ASSERT_EQUALS(out3.getNumberEvents(), 1);
+    TS_ASSERT_EQUALS(unfiltered.getNumberEvents(), 0);
+    TS_ASSERT_DELTA(out2.getEvent(0).tof(), 50.0, 1e-10);
+
+    // Times outside of the matrix splitter go to -1
+    input.splitByFullTimeMatrixSplitter({30000, 100000}, {2}, outputs, false,
+                                        1.0, 0.0);
+    TS_ASSERT_EQUALS(out2.getNumberEvents(), 1);
+    TS_ASSERT_EQUALS(unfiltered.getNumberEvents(), 3);
+
+    // Time before an interval goes to -1, time after the last one is dropped
+    TimeSplitterType splitter{
+        SplittingInterval(DateAndTime(int64_t(25000)),
+                          DateAndTime(int64_t(60000)), 1),
+        SplittingInterval(DateAndTime(int64_t(70000)),
+                          DateAndTime(int64_t(80000)), 2)};
+    input.splitByFullTime(splitter, outputs, false, 1.0, 0.0);
+    TS_ASSERT_EQUALS(unfiltered.getNumberEvents(), 2);
+    TS_ASSERT_EQUALS(out1.getNumberEvents(), 1);
+    TS_ASSERT_EQUALS(out2.getNumberEvents(), 0);
+    TS_ASSERT_EQUALS(out3.getNumberEvents(), 0);
+
+    // A group without an output is left out
+    outputs.erase(-1);
+    const auto message = input.splitByFullTimeMatrixSplitter(
+        {0, 30000, 200000}, {4, 1}, outputs, false, 1.0, 0.0);
+    TS_ASSERT_EQUALS(out1.getNumberEvents(), 2);
+    TS_ASSERT_DIFFERS(message.find("Group 4"), std::string::npos);
+  }
+
   //-----------------------------------------------------------------------------------------------
   void test_splitByTime_allTypes() {
     // Go through each possible EventType as the input
@@ -2112,6 +2377,41 @@ public:
     }   // starting event type
   }
 
+  void test_compressEvents_compact() {
+    for (size_t inplace = 0; inplace < 2; inplace++) {
+      el = EventList();
+      el.addEventQuickly(TofEvent(1.0, 22));
+      el.addEventQuickly(TofEvent(1.2, 33));
+      el.addEventQuickly(TofEvent(30.3, 44));
+      el.addEventQuickly(TofEvent(30.2, 55));
+      el.addEventQuickly(TofEvent(30.25, 66));
+      el.addEventQuickly(TofEvent(34.0, 55));
+
+      EventList out;
+      EventList *el_out = inplace ? &el : &out;
+      TS_ASSERT_THROWS_NOTHING(el.compressEvents(1.0, el_out, true);)
+
+      TS_ASSERT_EQUALS(el_out->getEventType(), COMPACT_WEIGHTED_NOTIME);
+      TS_ASSERT_EQUALS(el_out->getNumberEvents(), 3);
+      TS_ASSERT(el_out->isSortedByTof());
+      if (el_out->getNumberEvents() == 3) {
+        TS_ASSERT_DELTA(el_out->getEvent(0).tof(), 1.1, 1e-5);
+        TS_ASSERT_DELTA(el_out->getEvent(0).weight(), 2, 1e-5);
+        TS_ASSERT_DELTA(el_out->getEvent(1).tof(), 30.25, 1e-5);
+        TS_ASSERT_DELTA(el_out->getEvent(1).weight(), 3, 1e-5);
+        TS_ASSERT_DELTA(el_out->getEvent(2).tof(), 34.0, 1e-5);
+        TS_ASSERT_DELTA(el_out->getEvent(2).weight(), 1, 1e-5);
+        TS_ASSERT_EQUALS(el_out->getCompactWeightedEventsNoTime().capacity(),
+                         3);
+      }
+
+      // Compressing again keeps the list compact
+      el_out->compressEvents(10.0, el_out);
+      TS_ASSERT_EQUALS(el_out->getEventType(), COMPACT_WEIGHTED_NOTIME);
+      TS_ASSERT_EQUALS(el_out->getNumberEvents(), 2);
+    }
+  }
+
   void test_compressFatEvents() {
     // no pulse time should throw an exception
     EventList el_notime_output;
@@ -2548,6 +2848,18 @@ public:
     }
   }
 
+  /// Events with negative and positive TOFs and repeated pulse times
+  EventList make_list_for_radix_sort(const EventType type) {
+    EventList el;
+    for (int i = 0; i < 5000; i++) {
+      const double tof = ((i * 7919) % 2003 - 500) * 0.37;
+      const int64_t pulseTime = 1000000000LL * ((i * 104729) % 97);
+      el += TofEvent(tof, pulseTime);
+    }
+    el.switchTo(type);
+    return el;
+  }
+
   void fake_data_only_two_times(DateAndTime time1, DateAndTime time2) {
     // Clear the list
     el = EventList();
@@ -2788,6 +3100,18 @@ public:
 
   void test_sort_tof() { el_random.sortTof(); }
 
+  void test_sort_tof_comparison() { el_random.sortTof(COMPARISON_SORT); }
+
+  void test_sort_tof_radix() { el_random.sortTof(RADIX_SORT); }
+
+  void test_sort_pulsetime_tof_comparison() {
+    el_random.sortPulseTimeTOF(COMPARISON_SORT);
+  }
+
+  void test_sort_pulsetime_tof_radix() {
+    el_random.sortPulseTimeTOF(RADIX_SORT);
+  }
+
   void test_compressEvents() {
     EventList out_el;
     el_sorted.compressEvents(10.0, &out_el);
@@ -364,6 +364,22 @@ public:
     delete events;
   }
 
+  void test_addEventsData() {
+    BoxController_sptr sc(new BoxController(2));
+    MDBox<MDLeanEvent<2>, 2> b(sc.get());
+    MDLeanEvent<2> ev(4.0, 3.4);
+    b.addEvent(ev);
+    b.reserveMemoryForLoad(3);
+    // signal, error squared and the two coordinates of each event
+    const std::vector<coord_t> table{1.0, 0.5, 0.1, 0.2, 2.0, 1.5, 0.3, 0.4};
+    b.addEventsData(table);
+    TS_ASSERT_EQUALS(b.getEvents().size(), 3);
+    TS_ASSERT_EQUALS(b.getEvents()[0].getSignal(), 4.0);
+    TS_ASSERT_EQUALS(b.getEvents()[2].getSignal(), 2.0);
+    TS_ASSERT_DELTA(b.getEvents()[2].getCenter(1), 0.4, 1e-6);
+    TS_ASSERT_EQUALS(b.getEvents().capacity(), 3);
+  }
+
   void test_sptr() {
     using mdbox3 = MDBox<MDLeanEvent<3>, 3>;
     TS_ASSERT_THROWS_NOTHING(mdbox3::sptr a(new mdbox3(sc.get()));)
@@ -198,6 +198,31 @@ public:
     delete ew;
   }
 
+  //-------------------------------------------------------------------------------------
+  /** The boxes, including those made by splitting, come from the allocator of
+   * the box controller */
+  void test_boxes_are_allocated_by_the_box_controller() {
+    MDEventWorkspace3Lean::sptr ew =
+        MDEventsTestHelper::makeMDEW<3>(4, 0.0, 4.0, 1);
+    BoxController_sptr bc = ew->getBoxController();
+    std::vector<API::IMDNode *> boxes;
+    ew->getBox()->getBoxes(boxes, 10000, false);
+    TS_ASSERT_EQUALS(bc->getBoxAllocator().numBlocksInUse(), boxes.size());
+
+    MDLeanEvent<3> ev(1.0, 1.0);
+    ev.setCenter(0, 1.1);
+    ev.setCenter(1, 0.01);
+    ev.setCenter(2, 0.01);
+    for (size_t i = 0; i < 100; i++) {
+      ew->addEvent(ev);
+    }
+    ew->splitAllIfNeeded(nullptr);
+    boxes.clear();
+    ew->getBox()->getBoxes(boxes, 10000, false);
+    TS_ASSERT_LESS_THAN(65, boxes.size());
+    TS_ASSERT_EQUALS(bc->getBoxAllocator().numBlocksInUse(), boxes.size());
+  }
+
   //-------------------------------------------------------------------------------------
   /** MDBox->addEvent() tracks when a box is too big.
    * MDEventWorkspace->splitTrackedBoxes() splits them
@@ -56,6 +56,18 @@ public:
     ws.swap(cloned);
   }
 
+  void test_clone_shares_data_until_it_is_changed() {
+    Workspace2D_sptr cloned(ws->clone());
+    TS_ASSERT_EQUALS(&cloned->y(1)[0], &ws->y(1)[0]);
+    TS_ASSERT_EQUALS(&cloned->getSpectrum(1), &cloned->getSpectrum(0) + 1);
+
+    cloned->mutableY(1)[0] = -1.0;
+    TS_ASSERT_DIFFERS(ws->y(1)[0], -1.0);
+    TS_ASSERT_EQUALS(cloned->y(1)[0], -1.0);
+    TS_ASSERT_EQUALS(cloned->getSpectrum(1).getSpectrumNo(),
+                     ws->getSpectrum(1).getSpectrumNo());
+  }
+
   void testInit() {
     ws->setTitle("testInit");
     TS_ASSERT_EQUALS(ws->getNumberHistograms(), nhist);
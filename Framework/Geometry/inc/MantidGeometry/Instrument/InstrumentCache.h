@@ -0,0 +1,63 @@
+#ifndef MANTID_GEOMETRY_INSTRUMENTCACHE_H_
+#define MANTID_GEOMETRY_INSTRUMENTCACHE_H_
+
+#include "MantidGeometry/DllConfig.h"
+
+#include <string>
+
+namespace Mantid {
+namespace Geometry {
+// Forward declarations
+class Instrument;
+
+/**
+  Functions to write a fully parsed instrument to a binary cache file and to
+  read it back, so that the instrument definition XML does not need to be
+  parsed again.
+
+  The cache file holds the component tree, the shapes of the components, the
+  source, sample, chopper, detector and monitor markers, the reference frame
+  and the parameters of the instrument definition (the logfile cache). It is
+  written in the byte order of the machine, with a version number and a
+  checksum of its contents, and a file that does not match either is rejected
+  when it is read.
+
+  Instruments made of components other than those created by the instrument
+  definition parser, or that have a separate physical instrument, cannot be
+  cached.
+
+  Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+namespace InstrumentCache {
+/// The extension of instrument cache files
+MANTID_GEOMETRY_DLL const std::string &fileExtension();
+
+MANTID_GEOMETRY_DLL void save(const Instrument &instrument,
+                              const std::string &filename);
+
+MANTID_GEOMETRY_DLL void load(const std::string &filename,
+                              Instrument &instrument);
+} // namespace InstrumentCache
+} // namespace Geometry
+} // namespace Mantid
+
+#endif /* MANTID_GEOMETRY_INSTRUMENTCACHE_H_ */
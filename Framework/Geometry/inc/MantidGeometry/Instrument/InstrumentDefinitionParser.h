@@ -81,6 +81,11 @@ public:
   boost::shared_ptr<Instrument>
   parseXML(Kernel::ProgressBase *progressReporter);
 
+  /// Read the instrument from its cache file, or parse XML contents and
+  /// write the cache file
+  boost::shared_ptr<Instrument>
+  parseXMLOrReadCache(Kernel::ProgressBase *progressReporter);
+
   /// Add/overwrite any parameters specified in instrument with param values
   /// specified in <component-link> XML elements
   void setComponentLinks(boost::shared_ptr<Geometry::Instrument> &instrument,
@@ -107,6 +112,9 @@ public:
   /// creates a vtp filename from a given xml filename
   const std::string createVTPFileName();
 
+  /// creates an instrument cache filename from a given xml filename
+  const std::string createInstrumentCacheFileName();
+
 private:
   /// shared Constructor logic
   void initialise(const std::string &filename, const std::string &instName,
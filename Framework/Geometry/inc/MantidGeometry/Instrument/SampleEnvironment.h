@@ -6,6 +6,7 @@
 //------------------------------------------------------------------------------
 #include "MantidGeometry/DllConfig.h"
 #include "MantidGeometry/Instrument/Container.h"
+#include "MantidGeometry/Objects/BoundingVolumeHierarchy.h"
 
 namespace Mantid {
 namespace Kernel {
@@ -72,6 +73,8 @@ private:
   std::string m_name;
   // Element zero is always assumed to be the can
   std::vector<IObject_const_sptr> m_components;
+  // Bounding boxes of the components, to find those a track passes through
+  BoundingVolumeHierarchy m_componentBoxes;
 };
 
 // Typedef a unique_ptr
@@ -0,0 +1,90 @@
+#ifndef MANTIDGEOMETRY_BOUNDINGVOLUMEHIERARCHY_H_
+#define MANTIDGEOMETRY_BOUNDINGVOLUMEHIERARCHY_H_
+
+#include "MantidGeometry/DllConfig.h"
+#include "MantidGeometry/Objects/BoundingBox.h"
+#include "MantidKernel/V3D.h"
+
+#include <vector>
+
+namespace Mantid {
+namespace Geometry {
+
+//-------------------------------------------------------------------------
+// Forward declarations
+//-------------------------------------------------------------------------
+class Track;
+
+/**
+A bounding volume hierarchy over a list of axis-aligned bounding boxes, e.g.
+the bounding boxes of the children of an instrument assembly or of the
+components of a sample environment. It finds the boxes that a line passes
+through without testing each box in turn.
+
+The boxes are grouped in a binary tree, split at the median of the box centres
+along the longest extent of each group. Null boxes are left out of the tree,
+as nothing can intersect them.
+
+Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+National Laboratory & European Spallation Source
+
+This file is part of Mantid.
+
+Mantid is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 3 of the License, or
+(at your option) any later version.
+
+Mantid is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+File change history is stored at: <https://github.com/mantidproject/mantid>
+Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class MANTID_GEOMETRY_DLL BoundingVolumeHierarchy {
+public:
+  /// Default constructor, for a hierarchy without any boxes
+  BoundingVolumeHierarchy() = default;
+  explicit BoundingVolumeHierarchy(const std::vector<BoundingBox> &boxes);
+
+  /// @return the number of non-null boxes in the hierarchy
+  size_t size() const { return m_items.size(); }
+
+  void findLineIntersections(const Track &track,
+                             std::vector<size_t> &indices) const;
+  void findLineIntersections(const Kernel::V3D &startPoint,
+                             const Kernel::V3D &lineDir,
+                             std::vector<size_t> &indices) const;
+
+private:
+  /// A group of boxes and the box around them
+  struct Node {
+    /// Minimum and maximum x, y and z of the boxes of the node
+    double bounds[6];
+    /// First item of a leaf, or the index of the second child of an interior
+    /// node. The first child of an interior node follows the node.
+    size_t start;
+    /// Number of items of a leaf, or 0 for an interior node
+    size_t count;
+  };
+
+  size_t build(const size_t begin, const size_t end,
+               const std::vector<double> &bounds);
+
+  /// The nodes of the tree, the root first
+  std::vector<Node> m_nodes;
+  /// Indices of the boxes in the input list, in the order of the leaves
+  std::vector<size_t> m_items;
+  /// Minimum and maximum x, y and z of each box, in the order of the leaves
+  std::vector<double> m_itemBounds;
+};
+
+} // namespace Geometry
+} // namespace Mantid
+
+#endif /* MANTIDGEOMETRY_BOUNDINGVOLUMEHIERARCHY_H_ */
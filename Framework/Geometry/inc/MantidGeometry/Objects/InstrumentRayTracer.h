@@ -4,17 +4,20 @@
 #include "MantidGeometry/IDetector.h"
 #include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/Objects/BoundingBox.h"
+#include "MantidGeometry/Objects/BoundingVolumeHierarchy.h"
 #include "MantidGeometry/Objects/Track.h"
-#include <boost/unordered_map.hpp>
 #include <deque>
 #include <list>
+#include <memory>
 #include <mutex>
+#include <unordered_map>
 
 namespace Mantid {
 namespace Kernel {
 class V3D;
 }
 namespace Geometry {
+class ICompAssembly;
 class IComponent;
 struct Link;
 class Track;
@@ -26,6 +29,11 @@ This class is responsible for tracking rays and accumulating a list of objects
 that are
 intersected along the way.
 
+The children of each assembly that a ray enters are found with a hierarchy of
+their bounding boxes, which is built the first time the assembly is reached
+and kept for the lifetime of the tracer. Reuse a tracer for many rays through
+the same instrument.
+
 @author Martyn Gigg, Tessella plc
 @date 22/10/2010
 
@@ -69,15 +77,20 @@ private:
   InstrumentRayTracer();
   /// Fire the given track at the instrument
   void fireRay(Track &testRay) const;
+  /// Get the hierarchy of the bounding boxes of the children of an assembly
+  const BoundingVolumeHierarchy &
+  getChildHierarchy(const ICompAssembly &assembly) const;
 
   /// Pointer to the instrument
   Instrument_const_sptr m_instrument;
   /// Accumulate results in this Track object, aids performance. This is cleared
   /// when getResults is called.
   mutable Track m_resultsTrack;
-  /// Map of component id -> bounding box.
-  mutable boost::unordered_map<IComponent *, BoundingBox> m_boxCache;
-  /// Mutex to lock box cache
+  /// Map of assembly component id -> hierarchy of its children
+  mutable std::unordered_map<IComponent *,
+                             std::unique_ptr<BoundingVolumeHierarchy>>
+      m_hierarchyCache;
+  /// Mutex to lock the hierarchy cache
   mutable std::mutex m_mutex;
 };
 } // namespace Geometry
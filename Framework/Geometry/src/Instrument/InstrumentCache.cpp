@@ -0,0 +1,877 @@
+#include "MantidGeometry/Instrument/InstrumentCache.h"
+#include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/Detector.h"
+#include "MantidGeometry/Instrument/ObjCompAssembly.h"
+#include "MantidGeometry/Instrument/RectangularDetector.h"
+#include "MantidGeometry/Instrument/ReferenceFrame.h"
+#include "MantidGeometry/Instrument/StructuredDetector.h"
+#include "MantidGeometry/Instrument/XMLInstrumentParameter.h"
+#include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidGeometry/Objects/ShapeFactory.h"
+#include "MantidKernel/ChecksumHelper.h"
+#include "MantidKernel/Interpolation.h"
+
+#include <Poco/Exception.h>
+#include <Poco/File.h>
+#include <Poco/Process.h>
+
+#include <boost/make_shared.hpp>
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
+
+namespace Mantid {
+namespace Geometry {
+namespace InstrumentCache {
+using Kernel::Quat;
+using Kernel::V3D;
+
+namespace {
+/// Identifies an instrument cache file, and the byte order it was written in
+const uint32_t MAGIC_NUMBER = 0x4D494331;
+/// Version of the layout of the file. Increment it whenever the layout changes.
+const uint32_t VERSION = 1;
+
+/// The types of component in the tree
+enum class ComponentType : uint8_t {
+  Component,
+  CompAssembly,
+  ObjCompAssembly,
+  ObjComponent,
+  Detector,
+  RectangularDetector,
+  StructuredDetector
+};
+
+/// Appends values to a buffer in the byte order of the machine
+class BufferWriter {
+public:
+  template <typename T> void write(const T value) {
+    static_assert(std::is_arithmetic<T>::value, "Only plain numbers");
+    m_buffer.append(reinterpret_cast<const char *>(&value), sizeof(T));
+  }
+  void write(const std::string &value) {
+    write<uint64_t>(value.size());
+    m_buffer.append(value);
+  }
+  void write(const V3D &value) {
+    for (size_t i = 0; i < 3; ++i)
+      write<double>(value[i]);
+  }
+  void write(const Quat &value) {
+    for (int i = 0; i < 4; ++i)
+      write<double>(value[i]);
+  }
+  void write(const std::vector<double> &values) {
+    write<uint64_t>(values.size());
+    for (const auto value : values)
+      write<double>(value);
+  }
+  void write(const std::vector<std::string> &values) {
+    write<uint64_t>(values.size());
+    for (const auto &value : values)
+      write(value);
+  }
+  const std::string &buffer() const { return m_buffer; }
+
+private:
+  std::string m_buffer;
+};
+
+/// Reads values written by BufferWriter, checking that they are in the buffer
+class BufferReader {
+public:
+  BufferReader(const char *begin, const char *end)
+      : m_position(begin), m_end(end) {}
+  template <typename T> T read() {
+    static_assert(std::is_arithmetic<T>::value, "Only plain numbers");
+    T value;
+    std::memcpy(&value, take(sizeof(T)), sizeof(T));
+    return value;
+  }
+  std::string readString() {
+    const auto size = size_t(read<uint64_t>());
+    return std::string(take(size), size);
+  }
+  V3D readV3D() {
+    V3D value;
+    for (size_t i = 0; i < 3; ++i)
+      value[i] = read<double>();
+    return value;
+  }
+  Quat readQuat() {
+    Quat value;
+    for (int i = 0; i < 4; ++i)
+      value[i] = read<double>();
+    return value;
+  }
+  std::vector<double> readDoubles() {
+    std::vector<double> values(size_t(read<uint64_t>()));
+    for (auto &value : values)
+      value = read<double>();
+    return values;
+  }
+  std::vector<std::string> readStrings() {
+    std::vector<std::string> values(size_t(read<uint64_t>()));
+    for (auto &value : values)
+      value = readString();
+    return values;
+  }
+  bool atEnd() const { return m_position == m_end; }
+
+private:
+  const char *take(const size_t size) {
+    if (size > size_t(m_end - m_position))
+      throw std::runtime_error("Instrument cache file is truncated");
+    const char *data = m_position;
+    m_position += size;
+    return data;
+  }
+  const char *m_position;
+  const char *const m_end;
+};
+
+/// Axis of a reference frame that a unit vector points along
+PointingAlong pointingAlong(const V3D &direction) {
+  if (direction.X() != 0.0)
+    return X;
+  if (direction.Y() != 0.0)
+    return Y;
+  return Z;
+}
+
+/// Writes the parts of an instrument, numbering the components in the order
+/// of a depth-first walk of the tree
+class InstrumentWriter {
+public:
+  explicit InstrumentWriter(const Instrument &instrument)
+      : m_instrument(instrument) {}
+  std::string write();
+
+private:
+  void writeComponent(const IComponent &component);
+  void writeChildren(const ICompAssembly &assembly);
+  void writeGeneratedChildren(const ICompAssembly &assembly);
+  void writeShape(const boost::shared_ptr<const IObject> &shape);
+  void addComponent(const IComponent *component);
+  uint64_t indexOf(const IComponent *component) const;
+  void writeMarkers(BufferWriter &out) const;
+  void writeParameters(BufferWriter &out) const;
+
+  const Instrument &m_instrument;
+  /// The definitions of the shapes
+  BufferWriter m_shapes;
+  /// The component tree
+  BufferWriter m_tree;
+  /// Indices of the shapes written so far
+  std::unordered_map<const IObject *, int64_t> m_shapeIndices;
+  /// Indices of the components written so far
+  std::unordered_map<const IComponent *, uint64_t> m_componentIndices;
+};
+
+/**
+ * Write the instrument
+ * @return the contents of the cache file, without the header
+ */
+std::string InstrumentWriter::write() {
+  if (m_instrument.isParametrized())
+    throw std::invalid_argument("A parametrized instrument cannot be cached");
+  if (m_instrument.getPhysicalInstrument())
+    throw std::invalid_argument(
+        "An instrument with a physical instrument cannot be cached");
+
+  BufferWriter out;
+  out.write(m_instrument.getName());
+  out.write(m_instrument.getDefaultView());
+  out.write(m_instrument.getDefaultAxis());
+  out.write<int64_t>(m_instrument.getValidFromDate().totalNanoseconds());
+  out.write<int64_t>(m_instrument.getValidToDate().totalNanoseconds());
+
+  const auto frame = m_instrument.getReferenceFrame();
+  out.write<uint8_t>(frame->pointingUp());
+  out.write<uint8_t>(frame->pointingAlongBeam());
+  out.write<uint8_t>(pointingAlong(frame->vecThetaSign()));
+  out.write<uint8_t>(frame->getHandedness());
+  out.write(frame->origin());
+
+  // The instrument itself is the root of the tree
+  addComponent(&m_instrument);
+  m_tree.write(m_instrument.getRelativePos());
+  m_tree.write(m_instrument.getRelativeRot());
+  writeChildren(m_instrument);
+  writeMarkers(m_tree);
+  writeParameters(m_tree);
+
+  // The shapes and the number of components are only known after walking the
+  // tree, but are needed before it when reading
+  out.write<uint64_t>(m_shapeIndices.size());
+  BufferWriter numComponents;
+  numComponents.write<uint64_t>(m_componentIndices.size());
+  return out.buffer() + m_shapes.buffer() + numComponents.buffer() +
+         m_tree.buffer();
+}
+
+/**
+ * Write a component below the root of the tree, and the components below it
+ * @param component :: the component
+ */
+void InstrumentWriter::writeComponent(const IComponent &component) {
+  addComponent(&component);
+
+  const auto &type = typeid(component);
+  ComponentType componentType;
+  if (type == typeid(Component))
+    componentType = ComponentType::Component;
+  else if (type == typeid(CompAssembly))
+    componentType = ComponentType::CompAssembly;
+  else if (type == typeid(ObjCompAssembly))
+    componentType = ComponentType::ObjCompAssembly;
+  else if (type == typeid(ObjComponent))
+    componentType = ComponentType::ObjComponent;
+  else if (type == typeid(Detector))
+    componentType = ComponentType::Detector;
+  else if (type == typeid(RectangularDetector))
+    componentType = ComponentType::RectangularDetector;
+  else if (type == typeid(StructuredDetector))
+    componentType = ComponentType::StructuredDetector;
+  else
+    throw std::invalid_argument("Component " + component.getName() +
+                                " is of a type that cannot be cached");
+
+  m_tree.write<uint8_t>(static_cast<uint8_t>(componentType));
+  m_tree.write(component.getName());
+  m_tree.write(component.getRelativePos());
+  m_tree.write(component.getRelativeRot());
+
+  switch (componentType) {
+  case ComponentType::Component:
+    break;
+  case ComponentType::CompAssembly:
+    writeChildren(dynamic_cast<const ICompAssembly &>(component));
+    break;
+  case ComponentType::ObjCompAssembly: {
+    const auto &assembly = dynamic_cast<const ObjCompAssembly &>(component);
+    writeShape(assembly.shape());
+    writeChildren(assembly);
+    break;
+  }
+  case ComponentType::ObjComponent:
+    writeShape(dynamic_cast<const ObjComponent &>(component).shape());
+    break;
+  case ComponentType::Detector: {
+    const auto &detector = dynamic_cast<const Detector &>(component);
+    m_tree.write<int32_t>(detector.getID());
+    writeShape(detector.shape());
+    break;
+  }
+  case ComponentType::RectangularDetector: {
+    const auto &bank = dynamic_cast<const RectangularDetector &>(component);
+    // The shape of the pixels, rather than the outline of the bank
+    writeShape(bank.getAtXY(0, 0)->shape());
+    m_tree.write<int32_t>(bank.xpixels());
+    m_tree.write<double>(bank.xstart());
+    m_tree.write<double>(bank.xstep());
+    m_tree.write<int32_t>(bank.ypixels());
+    m_tree.write<double>(bank.ystart());
+    m_tree.write<double>(bank.ystep());
+    m_tree.write<int32_t>(bank.idstart());
+    m_tree.write<uint8_t>(bank.idfillbyfirst_y());
+    m_tree.write<int32_t>(bank.idstepbyrow());
+    m_tree.write<int32_t>(bank.idstep());
+    writeGeneratedChildren(bank);
+    break;
+  }
+  case ComponentType::StructuredDetector: {
+    const auto &bank = dynamic_cast<const StructuredDetector &>(component);
+    m_tree.write<uint64_t>(bank.xPixels());
+    m_tree.write<uint64_t>(bank.yPixels());
+    m_tree.write(bank.getXValues());
+    m_tree.write(bank.getYValues());
+    m_tree.write<int32_t>(bank.idStart());
+    m_tree.write<uint8_t>(bank.idFillByFirstY());
+    m_tree.write<int32_t>(bank.idStepByRow());
+    m_tree.write<int32_t>(bank.idStep());
+    writeGeneratedChildren(bank);
+    break;
+  }
+  }
+}
+
+/**
+ * Write the children of an assembly
+ * @param assembly :: the assembly
+ */
+void InstrumentWriter::writeChildren(const ICompAssembly &assembly) {
+  const int nchildren = assembly.nelements();
+  m_tree.write<int32_t>(nchildren);
+  for (int i = 0; i < nchildren; ++i)
+    writeComponent(*assembly.getChild(i));
+}
+
+/**
+ * Write the positions and rotations of the components below a bank, which are
+ * created by the bank itself when it is read back
+ * @param assembly :: the bank, or a column of it
+ */
+void InstrumentWriter::writeGeneratedChildren(const ICompAssembly &assembly) {
+  const int nchildren = assembly.nelements();
+  m_tree.write<int32_t>(nchildren);
+  for (int i = 0; i < nchildren; ++i) {
+    const auto child = assembly.getChild(i);
+    addComponent(child.get());
+    m_tree.write(child->getRelativePos());
+    m_tree.write(child->getRelativeRot());
+    if (auto column = dynamic_cast<const ICompAssembly *>(child.get()))
+      writeGeneratedChildren(*column);
+    else
+      m_tree.write<int32_t>(-1);
+  }
+}
+
+/**
+ * Write the index of a shape, and the definition of the shape if it has not
+ * been written before
+ * @param shape :: the shape, which may be null
+ */
+void InstrumentWriter::writeShape(
+    const boost::shared_ptr<const IObject> &shape) {
+  if (!shape) {
+    m_tree.write<int64_t>(-1);
+    return;
+  }
+  auto it = m_shapeIndices.find(shape.get());
+  if (it == m_shapeIndices.end()) {
+    auto csgShape = dynamic_cast<const CSGObject *>(shape.get());
+    if (!csgShape)
+      throw std::invalid_argument("Only CSG shapes can be cached");
+    const std::string shapeXML = csgShape->getShapeXML();
+    if (shapeXML.empty() && csgShape->hasValidShape())
+      throw std::invalid_argument(
+          "Shapes not defined by XML cannot be cached");
+    m_shapes.write(shapeXML);
+    m_shapes.write<int32_t>(csgShape->getName());
+    it = m_shapeIndices
+             .emplace(shape.get(), static_cast<int64_t>(m_shapeIndices.size()))
+             .first;
+  }
+  m_tree.write<int64_t>(it->second);
+}
+
+/**
+ * Give a component the next index in the tree
+ * @param component :: a component of the instrument
+ */
+void InstrumentWriter::addComponent(const IComponent *component) {
+  if (!m_componentIndices.emplace(component, m_componentIndices.size())
+           .second)
+    throw std::invalid_argument("Component " + component->getName() +
+                                " appears more than once in the instrument");
+}
+
+/**
+ * @param component :: a component of the instrument
+ * @return the index of the component in the tree
+ */
+uint64_t InstrumentWriter::indexOf(const IComponent *component) const {
+  auto it = m_componentIndices.find(component);
+  if (it == m_componentIndices.end())
+    throw std::invalid_argument(
+        "The instrument refers to a component outside its tree");
+  return it->second;
+}
+
+/**
+ * Write which components are the source, sample, chopper points, monitors
+ * and detectors
+ * @param out :: the buffer to write to
+ */
+void InstrumentWriter::writeMarkers(BufferWriter &out) const {
+  auto source = m_instrument.getSource();
+  out.write<int64_t>(source ? static_cast<int64_t>(indexOf(source.get())) : -1);
+  auto sample = m_instrument.getSample();
+  out.write<int64_t>(sample ? static_cast<int64_t>(indexOf(sample.get())) : -1);
+
+  const size_t nchoppers = m_instrument.getNumberOfChopperPoints();
+  out.write<uint64_t>(nchoppers);
+  for (size_t i = 0; i < nchoppers; ++i)
+    out.write<uint64_t>(indexOf(m_instrument.getChopperPoint(i).get()));
+
+  // Detector IDs are in ascending order
+  const auto detectorIDs = m_instrument.getDetectorIDs();
+  out.write<uint64_t>(detectorIDs.size());
+  for (const auto detectorID : detectorIDs) {
+    out.write<uint64_t>(indexOf(m_instrument.getDetector(detectorID).get()));
+    out.write<uint8_t>(m_instrument.isMonitor(detectorID));
+  }
+}
+
+/**
+ * Write the parameters from the instrument definition
+ * @param out :: the buffer to write to
+ */
+void InstrumentWriter::writeParameters(BufferWriter &out) const {
+  const auto &units = m_instrument.getLogfileUnit();
+  out.write<uint64_t>(units.size());
+  for (const auto &unit : units) {
+    out.write(unit.first);
+    out.write(unit.second);
+  }
+
+  const auto &parameters = m_instrument.getLogfileCache();
+  out.write<uint64_t>(parameters.size());
+  for (const auto &item : parameters) {
+    const XMLInstrumentParameter &parameter = *item.second;
+    out.write(item.first.first);
+    out.write<uint64_t>(indexOf(item.first.second));
+    out.write<uint64_t>(indexOf(parameter.m_component));
+    out.write(parameter.m_logfileID);
+    out.write(parameter.m_value);
+    if (parameter.m_interpolation) {
+      std::ostringstream interpolation;
+      interpolation.precision(17);
+      parameter.m_interpolation->printSelf(interpolation);
+      out.write<uint8_t>(1);
+      out.write(interpolation.str());
+    } else {
+      out.write<uint8_t>(0);
+    }
+    out.write(parameter.m_formula);
+    out.write(parameter.m_formulaUnit);
+    out.write(parameter.m_resultUnit);
+    out.write(parameter.m_paramName);
+    out.write(parameter.m_type);
+    out.write(parameter.m_tie);
+    out.write(parameter.m_constraint);
+    out.write(parameter.m_penaltyFactor);
+    out.write(parameter.m_fittingFunction);
+    out.write(parameter.m_extractSingleValueAs);
+    out.write(parameter.m_eq);
+    out.write<double>(parameter.m_angleConvertConst);
+    out.write(parameter.m_description);
+  }
+}
+
+/// Reads the parts of an instrument in the order InstrumentWriter wrote them
+class InstrumentReader {
+public:
+  InstrumentReader(BufferReader &in, Instrument &instrument)
+      : m_in(in), m_instrument(instrument) {}
+  void read();
+
+private:
+  void readComponent(ICompAssembly &parent);
+  void readChildren(ICompAssembly &assembly);
+  void readGeneratedChildren(ICompAssembly &assembly);
+  boost::shared_ptr<IObject> readShape();
+  IComponent *componentAt(const int64_t index) const;
+  void readMarkers();
+  void readParameters();
+
+  BufferReader &m_in;
+  Instrument &m_instrument;
+  /// The shapes in the order they were written
+  std::vector<boost::shared_ptr<IObject>> m_shapes;
+  /// The components in the order they were written
+  std::vector<IComponent *> m_components;
+};
+
+/// Read the instrument
+void InstrumentReader::read() {
+  const std::string name = m_in.readString();
+  if (name != m_instrument.getName())
+    throw std::runtime_error("Instrument cache file is for instrument " +
+                             name + ", not " + m_instrument.getName());
+  m_instrument.setDefaultView(m_in.readString());
+  m_instrument.setDefaultViewAxis(m_in.readString());
+  m_instrument.setValidFromDate(
+      Types::Core::DateAndTime(m_in.read<int64_t>()));
+  m_instrument.setValidToDate(Types::Core::DateAndTime(m_in.read<int64_t>()));
+
+  const auto up = static_cast<PointingAlong>(m_in.read<uint8_t>());
+  const auto alongBeam = static_cast<PointingAlong>(m_in.read<uint8_t>());
+  const auto thetaSign = static_cast<PointingAlong>(m_in.read<uint8_t>());
+  const auto handedness = static_cast<Handedness>(m_in.read<uint8_t>());
+  m_instrument.setReferenceFrame(boost::make_shared<ReferenceFrame>(
+      up, alongBeam, thetaSign, handedness, m_in.readString()));
+
+  Geometry::ShapeFactory shapeCreator;
+  m_shapes.resize(size_t(m_in.read<uint64_t>()));
+  for (auto &shape : m_shapes) {
+    const std::string shapeXML = m_in.readString();
+    auto csgShape = shapeXML.empty()
+                        ? boost::make_shared<CSGObject>()
+                        : shapeCreator.createShape(shapeXML, false);
+    csgShape->setName(m_in.read<int32_t>());
+    shape = csgShape;
+  }
+
+  m_components.reserve(size_t(m_in.read<uint64_t>()));
+  m_components.push_back(&m_instrument);
+  m_instrument.setPos(m_in.readV3D());
+  m_instrument.setRot(m_in.readQuat());
+  readChildren(m_instrument);
+
+  readMarkers();
+  readParameters();
+}
+
+/**
+ * Read a component below the root of the tree, and the components below it
+ * @param parent :: the assembly to add the component to
+ */
+void InstrumentReader::readComponent(ICompAssembly &parent) {
+  const auto componentType = static_cast<ComponentType>(m_in.read<uint8_t>());
+  const std::string name = m_in.readString();
+  const V3D pos = m_in.readV3D();
+  const Quat rot = m_in.readQuat();
+
+  Component *component(nullptr);
+  switch (componentType) {
+  case ComponentType::Component:
+    component = new Component(name);
+    parent.add(component);
+    break;
+  case ComponentType::CompAssembly: {
+    auto assembly = new CompAssembly(name);
+    parent.add(assembly);
+    component = assembly;
+    break;
+  }
+  case ComponentType::ObjCompAssembly: {
+    auto assembly = new ObjCompAssembly(name);
+    parent.add(assembly);
+    assembly->setOutline(readShape());
+    component = assembly;
+    break;
+  }
+  case ComponentType::ObjComponent:
+    component = new ObjComponent(name);
+    parent.add(component);
+    static_cast<ObjComponent *>(component)->setShape(readShape());
+    break;
+  case ComponentType::Detector: {
+    const int id = m_in.read<int32_t>();
+    component = new Detector(name, id, readShape(), nullptr);
+    parent.add(component);
+    break;
+  }
+  case ComponentType::RectangularDetector: {
+    auto bank = new RectangularDetector(name);
+    parent.add(bank);
+    auto shape = readShape();
+    const int xpixels = m_in.read<int32_t>();
+    const double xstart = m_in.read<double>();
+    const double xstep = m_in.read<double>();
+    const int ypixels = m_in.read<int32_t>();
+    const double ystart = m_in.read<double>();
+    const double ystep = m_in.read<double>();
+    const int idstart = m_in.read<int32_t>();
+    const bool idfillbyfirst_y = m_in.read<uint8_t>() != 0;
+    const int idstepbyrow = m_in.read<int32_t>();
+    const int idstep = m_in.read<int32_t>();
+    bank->initialize(shape, xpixels, xstart, xstep, ypixels, ystart, ystep,
+                     idstart, idfillbyfirst_y, idstepbyrow, idstep);
+    component = bank;
+    break;
+  }
+  case ComponentType::StructuredDetector: {
+    auto bank = new StructuredDetector(name);
+    parent.add(bank);
+    const auto xPixels = size_t(m_in.read<uint64_t>());
+    const auto yPixels = size_t(m_in.read<uint64_t>());
+    auto xValues = m_in.readDoubles();
+    auto yValues = m_in.readDoubles();
+    const detid_t idStart = m_in.read<int32_t>();
+    const bool idFillByFirstY = m_in.read<uint8_t>() != 0;
+    const int idStepByRow = m_in.read<int32_t>();
+    const int idStep = m_in.read<int32_t>();
+    const bool isZBeam =
+        m_instrument.getReferenceFrame()->isVectorPointingAlongBeam(
+            V3D(0, 0, 1));
+    bank->initialize(xPixels, yPixels, std::move(xValues), std::move(yValues),
+                     isZBeam, idStart, idFillByFirstY, idStepByRow, idStep);
+    component = bank;
+    break;
+  }
+  default:
+    throw std::runtime_error("Instrument cache file has an unknown component "
+                             "type");
+  }
+  component->setPos(pos);
+  component->setRot(rot);
+  m_components.push_back(component);
+
+  switch (componentType) {
+  case ComponentType::CompAssembly:
+  case ComponentType::ObjCompAssembly:
+    readChildren(dynamic_cast<ICompAssembly &>(*component));
+    break;
+  case ComponentType::RectangularDetector:
+  case ComponentType::StructuredDetector:
+    readGeneratedChildren(dynamic_cast<ICompAssembly &>(*component));
+    break;
+  default:
+    break;
+  }
+}
+
+/**
+ * Read the children of an assembly
+ * @param assembly :: the assembly to add the children to
+ */
+void InstrumentReader::readChildren(ICompAssembly &assembly) {
+  const int nchildren = m_in.read<int32_t>();
+  for (int i = 0; i < nchildren; ++i)
+    readComponent(assembly);
+}
+
+/**
+ * Read the positions and rotations of the components below a bank, which the
+ * bank created when it was initialized
+ * @param assembly :: the bank, or a column of it
+ */
+void InstrumentReader::readGeneratedChildren(ICompAssembly &assembly) {
+  const int nchildren = m_in.read<int32_t>();
+  if (nchildren != assembly.nelements())
+    throw std::runtime_error("Instrument cache file does not match the "
+                             "pixels of bank " +
+                             assembly.getName());
+  for (int i = 0; i < nchildren; ++i) {
+    auto child = assembly.getChild(i);
+    m_components.push_back(child.get());
+    child->setPos(m_in.readV3D());
+    child->setRot(m_in.readQuat());
+    auto column = boost::dynamic_pointer_cast<ICompAssembly>(child);
+    if (column) {
+      readGeneratedChildren(*column);
+    } else if (m_in.read<int32_t>() != -1) {
+      throw std::runtime_error("Instrument cache file does not match the "
+                               "pixels of bank " +
+                               assembly.getName());
+    }
+  }
+}
+
+/// @return the shape with the index that is read next, or null
+boost::shared_ptr<IObject> InstrumentReader::readShape() {
+  const int64_t index = m_in.read<int64_t>();
+  if (index < 0)
+    return boost::shared_ptr<IObject>();
+  if (size_t(index) >= m_shapes.size())
+    throw std::runtime_error("Instrument cache file has an unknown shape");
+  return m_shapes[size_t(index)];
+}
+
+/**
+ * @param index :: the index of a component in the tree
+ * @return the component
+ */
+IComponent *InstrumentReader::componentAt(const int64_t index) const {
+  if (index < 0 || size_t(index) >= m_components.size())
+    throw std::runtime_error("Instrument cache file has an unknown component");
+  return m_components[size_t(index)];
+}
+
+/// Read which components are the source, sample, chopper points, monitors
+/// and detectors
+void InstrumentReader::readMarkers() {
+  const auto source = m_in.read<int64_t>();
+  if (source >= 0)
+    m_instrument.markAsSource(componentAt(source));
+  const auto sample = m_in.read<int64_t>();
+  if (sample >= 0)
+    m_instrument.markAsSamplePos(componentAt(sample));
+
+  // Choppers are ordered by their distance from the source
+  const auto nchoppers = size_t(m_in.read<uint64_t>());
+  for (size_t i = 0; i < nchoppers; ++i) {
+    auto chopper = dynamic_cast<const ObjComponent *>(
+        componentAt(static_cast<int64_t>(m_in.read<uint64_t>())));
+    if (!chopper)
+      throw std::runtime_error("Instrument cache file has a chopper point "
+                               "that is not an object component");
+    m_instrument.markAsChopperPoint(chopper);
+  }
+
+  const auto ndetectors = size_t(m_in.read<uint64_t>());
+  std::vector<const IDetector *> detectors;
+  detectors.reserve(ndetectors);
+  for (size_t i = 0; i < ndetectors; ++i) {
+    auto detector = dynamic_cast<const IDetector *>(
+        componentAt(static_cast<int64_t>(m_in.read<uint64_t>())));
+    if (!detector)
+      throw std::runtime_error("Instrument cache file has a detector that is "
+                               "not a detector component");
+    // Monitors are added straight away, before the cache of detectors is
+    // unsorted by markAsDetectorIncomplete
+    if (m_in.read<uint8_t>() != 0)
+      m_instrument.markAsMonitor(detector);
+    else
+      detectors.push_back(detector);
+  }
+  for (const auto detector : detectors)
+    m_instrument.markAsDetectorIncomplete(detector);
+  m_instrument.markAsDetectorFinalize();
+}
+
+/// Read the parameters from the instrument definition
+void InstrumentReader::readParameters() {
+  auto &units = m_instrument.getLogfileUnit();
+  const auto nunits = size_t(m_in.read<uint64_t>());
+  for (size_t i = 0; i < nunits; ++i) {
+    const std::string name = m_in.readString();
+    units[name] = m_in.readString();
+  }
+
+  auto &parameters = m_instrument.getLogfileCache();
+  const auto nparameters = size_t(m_in.read<uint64_t>());
+  for (size_t i = 0; i < nparameters; ++i) {
+    const std::string key = m_in.readString();
+    const IComponent *keyComponent =
+        componentAt(static_cast<int64_t>(m_in.read<uint64_t>()));
+    const IComponent *parameterComponent =
+        componentAt(static_cast<int64_t>(m_in.read<uint64_t>()));
+    const std::string logfileID = m_in.readString();
+    const std::string value = m_in.readString();
+    boost::shared_ptr<Kernel::Interpolation> interpolation;
+    if (m_in.read<uint8_t>() != 0) {
+      interpolation = boost::make_shared<Kernel::Interpolation>();
+      std::istringstream interpolationStream(m_in.readString());
+      interpolationStream >> *interpolation;
+    }
+    const std::string formula = m_in.readString();
+    const std::string formulaUnit = m_in.readString();
+    const std::string resultUnit = m_in.readString();
+    const std::string paramName = m_in.readString();
+    const std::string type = m_in.readString();
+    const std::string tie = m_in.readString();
+    const std::vector<std::string> constraint = m_in.readStrings();
+    std::string penaltyFactor = m_in.readString();
+    const std::string fittingFunction = m_in.readString();
+    const std::string extractSingleValueAs = m_in.readString();
+    const std::string eq = m_in.readString();
+    const double angleConvertConst = m_in.read<double>();
+    const std::string description = m_in.readString();
+    parameters.emplace(std::make_pair(key, keyComponent),
+                       boost::make_shared<XMLInstrumentParameter>(
+                           logfileID, value, interpolation, formula,
+                           formulaUnit, resultUnit, paramName, type, tie,
+                           constraint, penaltyFactor, fittingFunction,
+                           extractSingleValueAs, eq, parameterComponent,
+                           angleConvertConst, description));
+  }
+}
+} // namespace
+
+/// @return The extension of instrument cache files
+const std::string &fileExtension() {
+  static const std::string extension(".instrcache");
+  return extension;
+}
+
+/**
+ * Write an instrument to a cache file. The file is written under a temporary
+ * name and then renamed, so that other processes never read a partial file.
+ * The temporary file is removed if anything fails. If it cannot be renamed
+ * but the cache file exists, another process is assumed to have written it.
+ * @param instrument :: An instrument that is not parametrized
+ * @param filename :: The path of the cache file
+ * @throws std::invalid_argument if the instrument cannot be cached
+ * @throws std::runtime_error if the file cannot be written
+ */
+void save(const Instrument &instrument, const std::string &filename) {
+  const std::string contents = InstrumentWriter(instrument).write();
+
+  BufferWriter header;
+  header.write<uint32_t>(MAGIC_NUMBER);
+  header.write<uint32_t>(VERSION);
+  header.write(Kernel::ChecksumHelper::sha1FromString(contents));
+
+  const std::string partialFilename =
+      filename + "." + std::to_string(Poco::Process::id()) + ".part";
+  Poco::File partialFile(partialFilename);
+  const auto removePartialFile = [&partialFile] {
+    try {
+      if (partialFile.exists())
+        partialFile.remove();
+    } catch (Poco::Exception &) {
+      // Nothing more can be done about it
+    }
+  };
+
+  bool written;
+  {
+    std::ofstream file(partialFilename, std::ios::binary | std::ios::trunc);
+    file.write(header.buffer().data(), header.buffer().size());
+    file.write(contents.data(), contents.size());
+    file.close();
+    written = !file.fail();
+  }
+  if (!written) {
+    removePartialFile();
+    throw std::runtime_error("Unable to write instrument cache file " +
+                             partialFilename);
+  }
+
+  try {
+    partialFile.renameTo(filename);
+  } catch (Poco::Exception &e) {
+    removePartialFile();
+    bool cached = false;
+    try {
+      cached = Poco::File(filename).exists();
+    } catch (Poco::Exception &) {
+      // Treated as not cached
+    }
+    if (!cached)
+      throw std::runtime_error("Unable to rename instrument cache file " +
+                               partialFilename + ": " + e.displayText());
+  }
+}
+
+/**
+ * Read an instrument from a cache file
+ * @param filename :: The path of the cache file
+ * @param instrument :: An empty instrument with the same name as the cached
+ * one, to add the components and parameters to
+ * @throws std::runtime_error if the file cannot be read, or was written by a
+ * different version or for a different instrument
+ */
+void load(const std::string &filename, Instrument &instrument) {
+  std::ifstream file(filename, std::ios::binary);
+  if (!file)
+    throw std::runtime_error("Unable to open instrument cache file " +
+                             filename);
+  std::string buffer((std::istreambuf_iterator<char>(file)),
+                     std::istreambuf_iterator<char>());
+
+  BufferReader header(buffer.data(), buffer.data() + buffer.size());
+  if (header.read<uint32_t>() != MAGIC_NUMBER)
+    throw std::runtime_error(filename + " is not an instrument cache file");
+  if (header.read<uint32_t>() != VERSION)
+    throw std::runtime_error("Instrument cache file " + filename +
+                             " was written by a different version");
+  const std::string checksum = header.readString();
+  // The header is followed by the contents
+  const size_t headerSize = 2 * sizeof(uint32_t) + sizeof(uint64_t) +
+                            checksum.size();
+  const std::string contents = buffer.substr(headerSize);
+  if (Kernel::ChecksumHelper::sha1FromString(contents) != checksum)
+    throw std::runtime_error("Instrument cache file " + filename +
+                             " is corrupt");
+
+  BufferReader in(contents.data(), contents.data() + contents.size());
+  InstrumentReader(in, instrument).read();
+  if (!in.atEnd())
+    throw std::runtime_error("Instrument cache file " + filename +
+                             " has unexpected contents");
+}
+
+} // namespace InstrumentCache
+} // namespace Geometry
+} // namespace Mantid
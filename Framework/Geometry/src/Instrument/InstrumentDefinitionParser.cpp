@@ -2,6 +2,7 @@
 #include <sstream>
 
 #include "MantidGeometry/Instrument/Detector.h"
+#include "MantidGeometry/Instrument/InstrumentCache.h"
 #include "MantidGeometry/Instrument/InstrumentDefinitionParser.h"
 #include "MantidGeometry/Instrument/ObjCompAssembly.h"
 #include "MantidGeometry/Instrument/RectangularDetector.h"
@@ -26,6 +27,7 @@
 #include <Poco/DOM/NodeFilter.h>
 #include <Poco/DOM/NodeIterator.h>
 #include <Poco/DOM/NodeList.h>
+#include <Poco/File.h>
 #include <Poco/Path.h>
 #include <Poco/SAX/AttributesImpl.h>
 #include <Poco/String.h>
@@ -283,6 +285,48 @@ InstrumentDefinitionParser::parseXML(Kernel::ProgressBase *progressReporter) {
   return m_instrument;
 }
 
+//----------------------------------------------------------------------------------------------
+/** Read the instrument from its binary cache file if there is one, and
+ * otherwise fully parse the IDF XML contents and write the cache file for the
+ * next time. The cache file is named after the checksum of the XML contents,
+ * so that a changed IDF is parsed again.
+ *
+ * @param progressReporter :: Optional Progress reporter object. If NULL, no
+ * progress reporting.
+ * @return the instrument that was created
+ */
+Instrument_sptr InstrumentDefinitionParser::parseXMLOrReadCache(
+    Kernel::ProgressBase *progressReporter) {
+  const std::string cacheFilename = createInstrumentCacheFileName();
+  if (cacheFilename.empty())
+    return parseXML(progressReporter);
+
+  if (Poco::File(cacheFilename).exists()) {
+    auto instrument = boost::make_shared<Instrument>(m_instrument->getName());
+    instrument->setFilename(m_instrument->getFilename());
+    instrument->setXmlText(m_instrument->getXmlText());
+    try {
+      InstrumentCache::load(cacheFilename, *instrument);
+      g_log.debug() << "Read instrument from cache file " << cacheFilename
+                    << '\n';
+      return instrument;
+    } catch (std::exception &e) {
+      g_log.warning() << "Unable to read instrument cache file "
+                      << cacheFilename << ": " << e.what()
+                      << ". The instrument definition is parsed instead.\n";
+    }
+  }
+
+  auto instrument = parseXML(progressReporter);
+  try {
+    InstrumentCache::save(*instrument, cacheFilename);
+  } catch (std::exception &e) {
+    g_log.information() << "Instrument cache file " << cacheFilename
+                        << " was not written: " << e.what() << '\n';
+  }
+  return instrument;
+}
+
 /**
  * Collect some information about types for later use including:
  * - populate directory getTypeElement
@@ -2981,6 +3025,25 @@ const std::string InstrumentDefinitionParser::createVTPFileName() {
   return retVal;
 }
 
+/** Generates an instrument cache filename from the mangled name of the
+ *  instrument
+ *
+ *  @return The instrument cache filename
+ *
+ */
+const std::string
+InstrumentDefinitionParser::createInstrumentCacheFileName() {
+  std::string retVal;
+  std::string filename = getMangledName();
+  if (!filename.empty()) {
+    Poco::Path path(ConfigService::Instance().getVTPFileDirectory());
+    path.makeDirectory();
+    path.append(filename + InstrumentCache::fileExtension());
+    retVal = path.toString();
+  }
+  return retVal;
+}
+
 /** Return a subelement of an XML element, but also checks that there exist
  *exactly one entry
  *  of this subelement.
@@ -6,6 +6,8 @@
 #include "MantidGeometry/Objects/Track.h"
 #include "MantidKernel/PseudoRandomNumberGenerator.h"
 
+#include <algorithm>
+
 namespace Mantid {
 namespace Geometry {
 using Geometry::BoundingBox;
@@ -24,7 +26,9 @@ using Kernel::V3D;
  */
 SampleEnvironment::SampleEnvironment(std::string name,
                                      Container_const_sptr container)
-    : m_name(std::move(name)), m_components(1, container) {}
+    : m_name(std::move(name)), m_components(1, container),
+      m_componentBoxes(
+          std::vector<BoundingBox>(1, container->getBoundingBox())) {}
 
 /**
  * @return An axis-aligned BoundingBox object that encompasses the whole kit.
@@ -92,9 +96,13 @@ bool SampleEnvironment::isValid(const V3D &point) const {
  * @return The total number of segments added to the track
  */
 int SampleEnvironment::interceptSurfaces(Track &track) const {
+  // Only the components whose bounding boxes the track passes through
+  std::vector<size_t> hits;
+  m_componentBoxes.findLineIntersections(track, hits);
+  std::sort(hits.begin(), hits.end());
   int nsegments(0);
-  for (const auto &component : m_components) {
-    nsegments += component->interceptSurface(track);
+  for (const auto index : hits) {
+    nsegments += m_components[index]->interceptSurface(track);
   }
   return nsegments;
 }
@@ -104,6 +112,12 @@ int SampleEnvironment::interceptSurfaces(Track &track) const {
  */
 void SampleEnvironment::add(const IObject_const_sptr &component) {
   m_components.emplace_back(component);
+  std::vector<BoundingBox> boxes;
+  boxes.reserve(m_components.size());
+  for (const auto &item : m_components) {
+    boxes.emplace_back(item->getBoundingBox());
+  }
+  m_componentBoxes = BoundingVolumeHierarchy(boxes);
 }
 } // namespace Geometry
 } // namespace Mantid
@@ -0,0 +1,192 @@
+#include "MantidGeometry/Objects/BoundingVolumeHierarchy.h"
+#include "MantidGeometry/Objects/Track.h"
+#include "MantidKernel/Tolerance.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Mantid {
+namespace Geometry {
+using Kernel::V3D;
+
+namespace {
+/// Maximum number of boxes in a leaf of the tree
+const size_t MAX_LEAF_ITEMS = 4;
+/// Maximum depth of the tree. Splitting at the median keeps the depth
+/// logarithmic in the number of boxes, so this is never reached.
+const size_t MAX_DEPTH = 64;
+
+/**
+ * Does a line intersect a box. Follows BoundingBox::doesLineIntersect: the
+ * line goes forward from the start point, and a box containing the start
+ * point is intersected.
+ * @param bounds :: minimum and maximum x, y and z of the box
+ * @param startPoint :: The starting point for the line
+ * @param lineDir :: The direction of the line
+ * @returns True if the line intersects the box
+ */
+bool lineIntersectsBox(const double *bounds, const V3D &startPoint,
+                       const V3D &lineDir) {
+  double nearest(0.0);
+  double furthest(std::numeric_limits<double>::max());
+  for (size_t i = 0; i < 3; ++i) {
+    const double minPoint(bounds[i]), maxPoint(bounds[i + 3]);
+    if (std::abs(lineDir[i]) < Kernel::Tolerance) {
+      // Parallel to the faces of this axis
+      if (startPoint[i] < minPoint || startPoint[i] > maxPoint)
+        return false;
+      continue;
+    }
+    double lambdaMin = (minPoint - startPoint[i]) / lineDir[i];
+    double lambdaMax = (maxPoint - startPoint[i]) / lineDir[i];
+    if (lambdaMin > lambdaMax)
+      std::swap(lambdaMin, lambdaMax);
+    nearest = std::max(nearest, lambdaMin);
+    furthest = std::min(furthest, lambdaMax);
+    if (nearest > furthest)
+      return false;
+  }
+  return true;
+}
+} // namespace
+
+/**
+ * Constructor
+ * @param boxes :: the axis-aligned boxes to put in the hierarchy
+ */
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(
+    const std::vector<BoundingBox> &boxes) {
+  // The extents of each box, indexed by its position in the input
+  std::vector<double> bounds(6 * boxes.size());
+  for (size_t i = 0; i < boxes.size(); ++i) {
+    const BoundingBox &box = boxes[i];
+    if (box.isNull())
+      continue;
+    const V3D &minPoint = box.minPoint();
+    const V3D &maxPoint = box.maxPoint();
+    for (size_t j = 0; j < 3; ++j) {
+      bounds[6 * i + j] = minPoint[j];
+      bounds[6 * i + j + 3] = maxPoint[j];
+    }
+    m_items.push_back(i);
+  }
+  if (m_items.empty())
+    return;
+
+  m_nodes.reserve(2 * (m_items.size() / MAX_LEAF_ITEMS) + 1);
+  build(0, m_items.size(), bounds);
+
+  m_itemBounds.reserve(6 * m_items.size());
+  for (const auto item : m_items) {
+    m_itemBounds.insert(m_itemBounds.end(), bounds.begin() + 6 * item,
+                        bounds.begin() + 6 * item + 6);
+  }
+}
+
+/**
+ * Build the node of the tree for a range of the items, and the nodes below it
+ * @param begin :: the first item of the node
+ * @param end :: one past the last item of the node
+ * @param bounds :: the extents of each box, indexed by its position in the
+ * input
+ * @return the index of the node
+ */
+size_t BoundingVolumeHierarchy::build(const size_t begin, const size_t end,
+                                      const std::vector<double> &bounds) {
+  const size_t index = m_nodes.size();
+  m_nodes.emplace_back();
+
+  Node node;
+  double centreMin[3], centreMax[3];
+  for (size_t j = 0; j < 3; ++j) {
+    node.bounds[j] = centreMin[j] = std::numeric_limits<double>::max();
+    node.bounds[j + 3] = centreMax[j] = std::numeric_limits<double>::lowest();
+  }
+  for (size_t k = begin; k < end; ++k) {
+    const double *itemBounds = &bounds[6 * m_items[k]];
+    for (size_t j = 0; j < 3; ++j) {
+      node.bounds[j] = std::min(node.bounds[j], itemBounds[j]);
+      node.bounds[j + 3] = std::max(node.bounds[j + 3], itemBounds[j + 3]);
+      const double centre = 0.5 * (itemBounds[j] + itemBounds[j + 3]);
+      centreMin[j] = std::min(centreMin[j], centre);
+      centreMax[j] = std::max(centreMax[j], centre);
+    }
+  }
+
+  if (end - begin <= MAX_LEAF_ITEMS) {
+    node.start = begin;
+    node.count = end - begin;
+    m_nodes[index] = node;
+    return index;
+  }
+
+  // Split at the median of the centres, along their longest extent
+  size_t axis(0);
+  for (size_t j = 1; j < 3; ++j) {
+    if (centreMax[j] - centreMin[j] > centreMax[axis] - centreMin[axis])
+      axis = j;
+  }
+  const size_t middle = begin + (end - begin) / 2;
+  std::nth_element(m_items.begin() + begin, m_items.begin() + middle,
+                   m_items.begin() + end, [&bounds, axis](size_t a, size_t b) {
+                     return bounds[6 * a + axis] + bounds[6 * a + axis + 3] <
+                            bounds[6 * b + axis] + bounds[6 * b + axis + 3];
+                   });
+
+  node.count = 0;
+  build(begin, middle, bounds);
+  node.start = build(middle, end, bounds);
+  m_nodes[index] = node;
+  return index;
+}
+
+/**
+ * Find the boxes that a track passes through
+ * @param track :: the track to test
+ * @param indices :: [Out] the positions of the boxes in the input list are
+ * appended here, in no particular order
+ */
+void BoundingVolumeHierarchy::findLineIntersections(
+    const Track &track, std::vector<size_t> &indices) const {
+  findLineIntersections(track.startPoint(), track.direction(), indices);
+}
+
+/**
+ * Find the boxes that a line passes through, with the same definition of an
+ * intersection as BoundingBox::doesLineIntersect
+ * @param startPoint :: The starting point for the line
+ * @param lineDir :: The direction of the line
+ * @param indices :: [Out] the positions of the boxes in the input list are
+ * appended here, in no particular order
+ */
+void BoundingVolumeHierarchy::findLineIntersections(
+    const V3D &startPoint, const V3D &lineDir,
+    std::vector<size_t> &indices) const {
+  if (m_nodes.empty())
+    return;
+
+  size_t stack[MAX_DEPTH];
+  size_t stackSize(0);
+  stack[stackSize++] = 0;
+  while (stackSize > 0) {
+    const size_t index = stack[--stackSize];
+    const Node &node = m_nodes[index];
+    if (!lineIntersectsBox(node.bounds, startPoint, lineDir))
+      continue;
+    if (node.count == 0) {
+      stack[stackSize++] = node.start;
+      stack[stackSize++] = index + 1;
+    } else if (node.count == 1) {
+      indices.push_back(m_items[node.start]);
+    } else {
+      for (size_t k = node.start; k < node.start + node.count; ++k) {
+        if (lineIntersectsBox(&m_itemBounds[6 * k], startPoint, lineDir))
+          indices.push_back(m_items[k]);
+      }
+    }
+  }
+}
+
+} // namespace Geometry
+} // namespace Mantid
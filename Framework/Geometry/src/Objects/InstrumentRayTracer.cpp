@@ -2,11 +2,16 @@
 // Includes
 //-------------------------------------------------------------
 #include "MantidGeometry/Objects/InstrumentRayTracer.h"
+#include "MantidGeometry/ICompAssembly.h"
 #include "MantidGeometry/IComponent.h"
+#include "MantidGeometry/IObjComponent.h"
 #include "MantidGeometry/Instrument/InstrumentVisitor.h"
+#include "MantidGeometry/Instrument/RectangularDetector.h"
 #include "MantidGeometry/Objects/Track.h"
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/V3D.h"
+#include "MantidKernel/make_unique.h"
+#include <algorithm>
 #include <deque>
 #include <iterator>
 
@@ -120,40 +125,75 @@ IDetector_const_sptr InstrumentRayTracer::getDetectorResult() const {
  */
 void InstrumentRayTracer::fireRay(Track &testRay) const {
   // Go through the instrument tree and see if we get any hits by
-  // (a) first testing the bounding box and if we're inside that then
-  // (b) test the lower components.
+  // (a) finding the children of an assembly whose bounding boxes are hit and
+  // (b) testing the shapes of those children, or their own children.
   std::deque<IComponent_const_sptr> nodeQueue;
 
   // Start at the root of the tree
   nodeQueue.push_back(m_instrument);
 
+  std::vector<size_t> hits;
   IComponent_const_sptr node;
   while (!nodeQueue.empty()) {
     node = nodeQueue.front();
     nodeQueue.pop_front();
-    BoundingBox bbox;
-    auto it = m_boxCache.find(node->getComponentID());
-    if (it != m_boxCache.end()) {
-      bbox = it->second;
-    } else {
-      node->getBoundingBox(bbox);
-      std::lock_guard<std::mutex> lock(m_mutex);
-      m_boxCache[node->getComponentID()] = bbox;
+    auto assembly = boost::dynamic_pointer_cast<const ICompAssembly>(node);
+    if (!assembly) {
+      throw Kernel::Exception::NotImplementedError(
+          "Implement non-comp assembly interactions");
+    }
+    // Rectangular detectors find the pixel that is hit directly
+    if (boost::dynamic_pointer_cast<const RectangularDetector>(assembly)) {
+      assembly->testIntersectionWithChildren(testRay, nodeQueue);
+      continue;
     }
 
-    // Quick test. If this suceeds moved on to test the children
-    if (bbox.doesLineIntersect(testRay)) {
-      if (ICompAssembly_const_sptr assembly =
-              boost::dynamic_pointer_cast<const ICompAssembly>(node)) {
-        assembly->testIntersectionWithChildren(testRay, nodeQueue);
-      } else {
-        throw Kernel::Exception::NotImplementedError(
-            "Implement non-comp assembly interactions");
+    hits.clear();
+    getChildHierarchy(*assembly).findLineIntersections(testRay, hits);
+    // Keep the order of the children
+    std::sort(hits.begin(), hits.end());
+    for (const auto i : hits) {
+      auto child = assembly->getChild(static_cast<int>(i));
+      if (boost::dynamic_pointer_cast<ICompAssembly>(child)) {
+        nodeQueue.push_back(child);
+      } else if (auto physicalObject =
+                     dynamic_cast<IObjComponent *>(child.get())) {
+        physicalObject->interceptSurface(testRay);
       }
     }
   }
 }
 
+/**
+ * Get the hierarchy of the bounding boxes of the children of an assembly,
+ * building it if this is the first time the assembly is reached
+ * @param assembly :: An assembly in the instrument
+ * @return The hierarchy. The positions of the boxes are the child indices.
+ */
+const BoundingVolumeHierarchy &
+InstrumentRayTracer::getChildHierarchy(const ICompAssembly &assembly) const {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_hierarchyCache.find(assembly.getComponentID());
+    if (it != m_hierarchyCache.end())
+      return *it->second;
+  }
+
+  const int nchildren = assembly.nelements();
+  std::vector<BoundingBox> childBoxes(static_cast<size_t>(nchildren));
+  for (int i = 0; i < nchildren; ++i) {
+    assembly.getChild(i)->getBoundingBox(childBoxes[i]);
+  }
+  auto hierarchy = Kernel::make_unique<BoundingVolumeHierarchy>(childBoxes);
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  // Another thread may have built the same hierarchy in the meantime
+  auto &cached = m_hierarchyCache[assembly.getComponentID()];
+  if (!cached)
+    cached = std::move(hierarchy);
+  return *cached;
+}
+
 ///**
 // * Perform a quick check as to whether the ray passes through the component
 // * @param component :: The test component
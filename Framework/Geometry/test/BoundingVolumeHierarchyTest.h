@@ -0,0 +1,107 @@
+#ifndef MANTID_GEOMETRY_BOUNDINGVOLUMEHIERARCHYTEST_H_
+#define MANTID_GEOMETRY_BOUNDINGVOLUMEHIERARCHYTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidGeometry/Objects/BoundingVolumeHierarchy.h"
+#include "MantidGeometry/Objects/Track.h"
+
+#include <algorithm>
+#include <random>
+
+using Mantid::Geometry::BoundingBox;
+using Mantid::Geometry::BoundingVolumeHierarchy;
+using Mantid::Geometry::Track;
+using Mantid::Kernel::V3D;
+
+class BoundingVolumeHierarchyTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static BoundingVolumeHierarchyTest *createSuite() {
+    return new BoundingVolumeHierarchyTest();
+  }
+  static void destroySuite(BoundingVolumeHierarchyTest *suite) {
+    delete suite;
+  }
+
+  void test_empty_hierarchy_finds_nothing() {
+    BoundingVolumeHierarchy hierarchy;
+    TS_ASSERT_EQUALS(hierarchy.size(), 0);
+    std::vector<size_t> indices;
+    hierarchy.findLineIntersections(V3D(0, 0, 0), V3D(0, 0, 1), indices);
+    TS_ASSERT(indices.empty());
+  }
+
+  void test_null_boxes_are_left_out() {
+    std::vector<BoundingBox> boxes(3);
+    boxes[1] = BoundingBox(1.0, 1.0, 6.0, -1.0, -1.0, 5.0);
+    BoundingVolumeHierarchy hierarchy(boxes);
+    TS_ASSERT_EQUALS(hierarchy.size(), 1);
+
+    std::vector<size_t> indices;
+    hierarchy.findLineIntersections(Track(V3D(0, 0, 0), V3D(0, 0, 1)),
+                                    indices);
+    TS_ASSERT_EQUALS(indices, std::vector<size_t>(1, 1));
+  }
+
+  void test_only_boxes_in_front_of_the_start_are_found() {
+    std::vector<BoundingBox> boxes{
+        BoundingBox(1.0, 1.0, 6.0, -1.0, -1.0, 5.0),
+        BoundingBox(1.0, 1.0, -5.0, -1.0, -1.0, -6.0),
+        // Contains the start point
+        BoundingBox(1.0, 1.0, 1.0, -1.0, -1.0, -1.0),
+        // Beside the line
+        BoundingBox(3.0, 1.0, 6.0, 2.0, -1.0, 5.0)};
+    BoundingVolumeHierarchy hierarchy(boxes);
+
+    std::vector<size_t> indices;
+    hierarchy.findLineIntersections(V3D(0, 0, 0), V3D(0, 0, 1), indices);
+    std::sort(indices.begin(), indices.end());
+    TS_ASSERT_EQUALS(indices, (std::vector<size_t>{0, 2}));
+  }
+
+  void test_matches_testing_every_box() {
+    std::mt19937 generator(12345);
+    std::uniform_real_distribution<double> position(-10.0, 10.0);
+    std::uniform_real_distribution<double> size(0.1, 2.0);
+    std::vector<BoundingBox> boxes;
+    for (size_t i = 0; i < 1000; ++i) {
+      const V3D corner(position(generator), position(generator),
+                       position(generator));
+      boxes.emplace_back(corner.X() + size(generator),
+                         corner.Y() + size(generator),
+                         corner.Z() + size(generator), corner.X(), corner.Y(),
+                         corner.Z());
+    }
+    BoundingVolumeHierarchy hierarchy(boxes);
+    TS_ASSERT_EQUALS(hierarchy.size(), boxes.size());
+
+    std::normal_distribution<double> direction;
+    size_t numFound(0);
+    for (size_t i = 0; i < 200; ++i) {
+      const V3D start(position(generator), position(generator),
+                      position(generator));
+      V3D dir(direction(generator), direction(generator), direction(generator));
+      // Include lines along an axis
+      if (i % 4 == 0)
+        dir = V3D(0.0, 0.0, dir.Z());
+      dir.normalize();
+
+      std::vector<size_t> expected;
+      for (size_t j = 0; j < boxes.size(); ++j) {
+        if (boxes[j].doesLineIntersect(start, dir))
+          expected.push_back(j);
+      }
+      std::vector<size_t> indices;
+      hierarchy.findLineIntersections(start, dir, indices);
+      std::sort(indices.begin(), indices.end());
+      TS_ASSERT_EQUALS(indices, expected);
+      numFound += indices.size();
+    }
+    // Make sure the test is not trivial
+    TS_ASSERT_LESS_THAN(200, numFound);
+  }
+};
+
+#endif /* MANTID_GEOMETRY_BOUNDINGVOLUMEHIERARCHYTEST_H_ */
@@ -0,0 +1,209 @@
+#ifndef MANTID_GEOMETRY_INSTRUMENTCACHETEST_H_
+#define MANTID_GEOMETRY_INSTRUMENTCACHETEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidGeometry/IDetector.h"
+#include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/InstrumentCache.h"
+#include "MantidGeometry/Instrument/ParameterMap.h"
+#include "MantidGeometry/Instrument/RectangularDetector.h"
+#include "MantidGeometry/Instrument/ReferenceFrame.h"
+#include "MantidGeometry/Instrument/XMLInstrumentParameter.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Interpolation.h"
+#include "MantidTestHelpers/ComponentCreationHelper.h"
+
+#include <Poco/File.h>
+#include <Poco/Path.h>
+#include <Poco/Process.h>
+
+#include <boost/make_shared.hpp>
+
+#include <fstream>
+
+using namespace Mantid::Geometry;
+using Mantid::Kernel::ConfigService;
+using Mantid::Kernel::V3D;
+
+class InstrumentCacheTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static InstrumentCacheTest *createSuite() {
+    return new InstrumentCacheTest();
+  }
+  static void destroySuite(InstrumentCacheTest *suite) { delete suite; }
+
+  InstrumentCacheTest()
+      : m_filename(Poco::Path(ConfigService::Instance().getTempDir())
+                       .append("InstrumentCacheTest" +
+                               InstrumentCache::fileExtension())
+                       .toString()) {}
+
+  void tearDown() override {
+    Poco::File file(m_filename);
+    if (file.exists())
+      file.remove();
+  }
+
+  void test_cylindrical_instrument_is_read_back() {
+    auto instrument = ComponentCreationHelper::createTestInstrumentCylindrical(
+        2, V3D(0.0, 0.0, -10.0), V3D(0.0, 0.0, 0.0));
+    instrument->setDefaultView("CYLINDRICAL_Y");
+    instrument->setReferenceFrame(
+        boost::make_shared<ReferenceFrame>(Y, X, Left, "source"));
+
+    TS_ASSERT_THROWS_NOTHING(InstrumentCache::save(*instrument, m_filename));
+    auto loaded = boost::make_shared<Instrument>(instrument->getName());
+    TS_ASSERT_THROWS_NOTHING(InstrumentCache::load(m_filename, *loaded));
+
+    checkSameInstrument(*instrument, *loaded);
+    TS_ASSERT_EQUALS(loaded->getDefaultView(), "CYLINDRICAL_Y");
+    TS_ASSERT_EQUALS(loaded->getReferenceFrame()->pointingAlongBeam(), X);
+    TS_ASSERT_EQUALS(loaded->getReferenceFrame()->getHandedness(), Left);
+    TS_ASSERT_EQUALS(loaded->getReferenceFrame()->origin(), "source");
+  }
+
+  void test_rectangular_detector_pixels_keep_their_rotation() {
+    auto instrument =
+        ComponentCreationHelper::createTestInstrumentRectangular2(2, 4);
+    auto bank = boost::dynamic_pointer_cast<const RectangularDetector>(
+        instrument->getComponentByName("bank2"));
+    auto pixel = bank->getAtXY(1, 2);
+    pixel->setRot(Mantid::Kernel::Quat(45.0, V3D(0, 0, 1)));
+
+    InstrumentCache::save(*instrument, m_filename);
+    auto loaded = boost::make_shared<Instrument>(instrument->getName());
+    InstrumentCache::load(m_filename, *loaded);
+
+    checkSameInstrument(*instrument, *loaded);
+    auto loadedBank = boost::dynamic_pointer_cast<const RectangularDetector>(
+        loaded->getComponentByName("bank2"));
+    TS_ASSERT(loadedBank);
+    TS_ASSERT_EQUALS(loadedBank->xpixels(), 4);
+    TS_ASSERT_EQUALS(loadedBank->idstart(), 16);
+    TS_ASSERT_EQUALS(loadedBank->getAtXY(1, 2)->getRotation(),
+                     pixel->getRotation());
+  }
+
+  void test_parameters_are_read_back() {
+    auto instrument = ComponentCreationHelper::createTestInstrumentCylindrical(
+        1, V3D(0.0, 0.0, -10.0), V3D(0.0, 0.0, 0.0));
+    const IComponent *bank = instrument->getComponentByName("bank1").get();
+    std::string penaltyFactor("2.0");
+    auto interpolation = boost::make_shared<Mantid::Kernel::Interpolation>();
+    interpolation->addPoint(1.0, 0.1);
+    interpolation->addPoint(3.0, 0.7);
+    instrument->getLogfileCache().emplace(
+        std::make_pair("height", bank),
+        boost::make_shared<XMLInstrumentParameter>(
+            "", "1.5", interpolation, "", "", "", "height", "double", "",
+            std::vector<std::string>{"0.0", "2.0"}, penaltyFactor, "", "", "",
+            bank, 1.0, "The height"));
+    instrument->getLogfileUnit()["height"] = "m";
+
+    InstrumentCache::save(*instrument, m_filename);
+    auto loaded = boost::make_shared<Instrument>(instrument->getName());
+    InstrumentCache::load(m_filename, *loaded);
+
+    const IComponent *loadedBank = loaded->getComponentByName("bank1").get();
+    const auto &parameters = loaded->getLogfileCache();
+    TS_ASSERT_EQUALS(parameters.size(), 1);
+    auto it = parameters.find(std::make_pair("height", loadedBank));
+    TS_ASSERT(it != parameters.end());
+    if (it == parameters.end())
+      return;
+    const auto &parameter = *it->second;
+    TS_ASSERT_EQUALS(parameter.m_component, loadedBank);
+    TS_ASSERT_EQUALS(parameter.m_value, "1.5");
+    TS_ASSERT_EQUALS(parameter.m_type, "double");
+    TS_ASSERT_EQUALS(parameter.m_constraint,
+                     (std::vector<std::string>{"0.0", "2.0"}));
+    TS_ASSERT_EQUALS(parameter.m_penaltyFactor, "2.0");
+    TS_ASSERT_EQUALS(parameter.m_description, "The height");
+    TS_ASSERT_DELTA(parameter.m_interpolation->value(2.0), 0.4, 1e-12);
+    TS_ASSERT_EQUALS(loaded->getLogfileUnit().at("height"), "m");
+  }
+
+  void test_load_throws_for_a_different_instrument() {
+    auto instrument =
+        ComponentCreationHelper::createTestInstrumentRectangular2(1, 2);
+    InstrumentCache::save(*instrument, m_filename);
+    Instrument other("other");
+    TS_ASSERT_THROWS(InstrumentCache::load(m_filename, other),
+                     std::runtime_error);
+  }
+
+  void test_load_throws_for_a_corrupt_file() {
+    auto instrument =
+        ComponentCreationHelper::createTestInstrumentRectangular2(1, 2);
+    InstrumentCache::save(*instrument, m_filename);
+    {
+      std::fstream file(m_filename,
+                        std::ios::binary | std::ios::in | std::ios::out);
+      file.seekp(-10, std::ios::end);
+      file.put('\x7f');
+    }
+    Instrument loaded(instrument->getName());
+    TS_ASSERT_THROWS(InstrumentCache::load(m_filename, loaded),
+                     std::runtime_error);
+  }
+
+  void test_save_throws_for_a_parametrized_instrument() {
+    auto instrument =
+        ComponentCreationHelper::createTestInstrumentRectangular2(1, 2);
+    Instrument parametrized(instrument, boost::make_shared<ParameterMap>());
+    TS_ASSERT_THROWS(InstrumentCache::save(parametrized, m_filename),
+                     std::invalid_argument);
+    TS_ASSERT(!Poco::File(m_filename).exists());
+  }
+
+  void test_save_leaves_no_partial_file_if_the_cache_exists() {
+    // A directory in the way makes the rename fail
+    Poco::File directory(m_filename);
+    directory.createDirectory();
+    std::ofstream(Poco::Path(m_filename).append("file").toString()) << "x";
+    auto instrument =
+        ComponentCreationHelper::createTestInstrumentRectangular2(1, 2);
+
+    TS_ASSERT_THROWS_NOTHING(InstrumentCache::save(*instrument, m_filename));
+    TS_ASSERT(!Poco::File(m_filename + "." +
+                          std::to_string(Poco::Process::id()) + ".part")
+                   .exists());
+    directory.remove(true);
+  }
+
+private:
+  void checkSameInstrument(const Instrument &expected,
+                           const Instrument &actual) {
+    TS_ASSERT_EQUALS(actual.nelements(), expected.nelements());
+    TS_ASSERT_EQUALS(actual.getSource()->getName(),
+                     expected.getSource()->getName());
+    TS_ASSERT_EQUALS(actual.getSource()->getPos(),
+                     expected.getSource()->getPos());
+    TS_ASSERT_EQUALS(actual.getSample()->getPos(),
+                     expected.getSample()->getPos());
+
+    const auto detectorIDs = expected.getDetectorIDs();
+    TS_ASSERT_EQUALS(actual.getDetectorIDs(), detectorIDs);
+    TS_ASSERT_EQUALS(actual.getMonitors(), expected.getMonitors());
+    for (const auto detectorID : detectorIDs) {
+      auto expectedDetector = expected.getDetector(detectorID);
+      auto actualDetector = actual.getDetector(detectorID);
+      TS_ASSERT_EQUALS(actualDetector->getName(), expectedDetector->getName());
+      TS_ASSERT_EQUALS(actualDetector->getPos(), expectedDetector->getPos());
+      TS_ASSERT_EQUALS(actualDetector->getRotation(),
+                       expectedDetector->getRotation());
+      BoundingBox expectedBox, actualBox;
+      expectedDetector->getBoundingBox(expectedBox);
+      actualDetector->getBoundingBox(actualBox);
+      TS_ASSERT_EQUALS(actualBox.minPoint(), expectedBox.minPoint());
+      TS_ASSERT_EQUALS(actualBox.maxPoint(), expectedBox.maxPoint());
+    }
+  }
+
+  const std::string m_filename;
+};
+
+#endif /* MANTID_GEOMETRY_INSTRUMENTCACHETEST_H_ */
@@ -141,6 +141,28 @@ public:
     TS_ASSERT_EQUALS(results.size(), 0);
   }
 
+  void test_That_A_Tracer_Can_Be_Reused_For_Many_Rays() {
+    Instrument_sptr testInst = setupInstrument();
+    InstrumentRayTracer tracker(testInst);
+    const IComponent *centralPixel =
+        testInst->getComponentByName("pixel-(0;0)").get();
+    const IComponent *interceptedPixel =
+        testInst->getComponentByName("pixel-(1;0)").get();
+    for (size_t i = 0; i < 3; ++i) {
+      tracker.trace(V3D(0., 0., 1));
+      Links results = tracker.getResults();
+      TS_ASSERT_EQUALS(results.size(), 2);
+      TS_ASSERT_EQUALS(results.back().componentID,
+                       centralPixel->getComponentID());
+
+      tracker.trace(V3D(0.010, 0.0, 15.004));
+      results = tracker.getResults();
+      TS_ASSERT_EQUALS(results.size(), 1);
+      TS_ASSERT_EQUALS(results.front().componentID,
+                       interceptedPixel->getComponentID());
+    }
+  }
+
   /** Test ray tracing into a rectangular detector
    *
    * @param inst :: instrument with 1 rect
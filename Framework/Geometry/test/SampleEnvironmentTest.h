@@ -94,6 +94,19 @@ public:
     TS_ASSERT_EQUALS(3, ray.count());
   }
 
+  void test_Track_Intersection_Only_Includes_Components_Along_Track() {
+    using namespace Mantid::Geometry;
+    using namespace Mantid::Kernel;
+
+    auto kit = createTestKit();
+    // Through the can only
+    Track ray(V3D(0, -0.5, 0), V3D(0.0, 1.0, 0.0));
+    int nsegments(0);
+    TS_ASSERT_THROWS_NOTHING(nsegments = kit->interceptSurfaces(ray));
+    TS_ASSERT_EQUALS(1, nsegments);
+    TS_ASSERT_EQUALS(1, ray.count());
+  }
+
   void test_BoundingBox_Encompasses_Whole_Object() {
     using namespace Mantid::Geometry;
     using namespace Mantid::Kernel;
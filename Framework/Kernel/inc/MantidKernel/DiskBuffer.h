@@ -10,11 +10,15 @@
 #include <boost/multi_index/sequenced_index.hpp>
 #include <boost/multi_index_container.hpp>
 #endif
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
+#include <exception>
 #include <limits>
 #include <list>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace Mantid {
@@ -32,6 +36,12 @@ class ISaveable;
   It also stores a list of "free" blocks in the output file,
   to allow new blocks to fill them later.
 
+  By default the buffer is written out by whichever thread overflows it.
+  After startIOThread() a background thread does the writing instead, so
+  that the threads filling the buffer do not wait for the disk, and objects
+  passed to prefetch() are loaded by that thread ahead of use. The I/O thread
+  must be stopped with stopIOThread() before the file is closed.
+
   @date 2011-12-30
 
   Copyright &copy; 2011 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
@@ -77,12 +87,20 @@ public:
   DiskBuffer(uint64_t m_writeBufferSize);
   DiskBuffer(const DiskBuffer &) = delete;
   DiskBuffer &operator=(const DiskBuffer &) = delete;
-  virtual ~DiskBuffer() = default;
+  virtual ~DiskBuffer();
 
   void toWrite(ISaveable *item);
   void flushCache();
   void objectDeleted(ISaveable *item);
 
+  // Background I/O
+  void startIOThread();
+  void stopIOThread();
+  void waitForIOThread();
+  /// @return true if the buffer is written out by a background thread
+  bool hasIOThread() const { return m_ioThread.joinable(); }
+  void prefetch(ISaveable *item);
+
   // Free space map methods
   void freeBlock(uint64_t const pos, uint64_t const size);
   void defragFreeBlocks();
@@ -133,6 +151,8 @@ public:
 
 protected:
   inline void writeOldObjects();
+  void writeObject(ISaveable *obj);
+  void runIOThread();
 
   // ----------------------- To-write buffer
   // --------------------------------------
@@ -152,6 +172,43 @@ protected:
   /// Mutex for modifying the the toWrite buffer.
   std::mutex m_mutex;
 
+  /// Only one thread writes out the buffer at a time
+  std::mutex m_writeMutex;
+
+  // ----------------------- Background I/O -----------------------------------
+  /// Thread writing out the buffer and loading objects ahead of use
+  std::thread m_ioThread;
+
+  /// Wakes the I/O thread, and threads waiting for an object to be written
+  std::condition_variable m_ioCondition;
+
+  /// Set when the buffer is full and the I/O thread should write it out
+  bool m_writeRequested;
+
+  /// Set when the I/O thread should finish
+  bool m_stopIOThread;
+
+  /// Number of times writing out the buffer has started and finished, so
+  /// producers can wait for a pass which sees their objects
+  uint64_t m_writePassesStarted;
+  uint64_t m_writePassesDone;
+
+  /// Objects to load ahead of use
+  std::deque<ISaveable *> m_toPrefetch;
+
+  /// Object being written out without holding m_mutex
+  ISaveable *m_writingObject;
+
+  /// Object being loaded by the I/O thread without holding m_mutex
+  ISaveable *m_loadingObject;
+
+  /// Last object written out by the current pass, through which the file is
+  /// flushed. objectDeleted() clears it, so it is never a deleted object.
+  ISaveable *m_flushObject;
+
+  /// First error in the I/O thread, rethrown by flushCache()
+  std::exception_ptr m_ioError;
+
   // ----------------------- Free space map
   // --------------------------------------
   /// Map of the free blocks in the file
@@ -2,6 +2,7 @@
 #define MANTID_KERNEL_ISAVEABLE_H_
 
 #include "MantidKernel/System.h"
+#include <atomic>
 #include <list>
 #include <mutex>
 #ifndef Q_MOC_RUN
@@ -130,12 +131,16 @@ public:
   virtual uint64_t getTotalDataSize() const = 0;
   /// the data size kept in memory
   virtual size_t getDataMemorySize() const = 0;
+  /** @return the mutex guarding the data of the object, if it has one. The
+     DiskBuffer holds it while the data are written out and cleared, and the
+     object must hold it when marking the data busy */
+  virtual std::mutex *getDataMutex() const { return nullptr; }
 
 protected:
   //--------------
   /// a user needs to set this variable to true preventing from deleting data
   /// from buffer
-  bool m_Busy;
+  std::atomic<bool> m_Busy;
   /** a user needs to set this variable to true to allow DiskBuffer saving the
      object to HDD
       when it decides it suitable,  if the size of iSavable object in cache is
@@ -170,6 +175,9 @@ private:
        overloaded object specific save operation above    */
   void saveAt(uint64_t newPos, uint64_t newSize);
 
+  /// load the data ahead of use, from the I/O thread of the DiskBuffer
+  bool loadAhead();
+
   /// sets the iterator pointing to the location of this object in the memory
   /// buffer to write later
   size_t setBufferPosition(std::list<ISaveable *>::iterator bufPosition);
@@ -0,0 +1,108 @@
+#ifndef MANTID_KERNEL_PERTHREAD_H_
+#define MANTID_KERNEL_PERTHREAD_H_
+
+#include "MantidKernel/MultiThreaded.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+
+/** PerThread : One copy of a value for each thread of an OpenMP parallel
+ * region, to accumulate results without a PARALLEL_CRITICAL section.
+ *
+ * Each thread adds its contributions to local(), e.g. a histogram, a mask or
+ * a set of detector IDs. Once the parallel region has finished the copies are
+ * combined with reduce():
+ *
+ * @code
+ * PerThread<std::vector<double>> counts(std::vector<double>(nBins, 0.0));
+ * PARALLEL_FOR_IF(...)
+ * for (int i = 0; i < n; ++i) {
+ *   auto &localCounts = counts.local();
+ *   localCounts[bin(i)] += y(i);
+ * }
+ * const auto &total = counts.reduce(AddElementwise());
+ * @endcode
+ *
+ * The object must be created outside of the parallel region. Call local()
+ * once per iteration rather than in inner loops.
+ *
+ * Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+ * National Laboratory & European Spallation Source
+ *
+ * This file is part of Mantid.
+ *
+ * Mantid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Mantid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * File change history is stored at: <https://github.com/mantidproject/mantid>
+ * Code Documentation is available at: <http://doxygen.mantidproject.org>
+ */
+template <typename T> class PerThread {
+public:
+  /** Constructor
+   * @param initial :: initial value of the copy of each thread
+   */
+  explicit PerThread(const T &initial = T())
+      : m_values(static_cast<size_t>(PARALLEL_GET_MAX_THREADS), initial) {}
+
+  /// @return the copy belonging to the calling thread
+  T &local() { return m_values[PARALLEL_THREAD_NUMBER]; }
+
+  /** Combine all copies into the first one, freeing the others. Must be
+   * called outside of the parallel region.
+   * @param op :: binary function called as op(total, copy) that adds copy
+   *        into total
+   * @return the combined value
+   */
+  template <typename BinaryOp> T &reduce(BinaryOp op) {
+    for (size_t i = 1; i < m_values.size(); ++i)
+      op(m_values.front(), m_values[i]);
+    m_values.erase(m_values.begin() + 1, m_values.end());
+    return m_values.front();
+  }
+
+  /// @return the number of copies
+  size_t size() const { return m_values.size(); }
+  typename std::vector<T>::iterator begin() { return m_values.begin(); }
+  typename std::vector<T>::iterator end() { return m_values.end(); }
+
+private:
+  std::vector<T> m_values;
+};
+
+/// Reduction operation for PerThread adding containers element by element.
+/// The containers may be of different types, e.g. a HistogramY and a vector.
+struct AddElementwise {
+  template <typename Total, typename Part>
+  void operator()(Total &total, const Part &part) const {
+    auto out = total.begin();
+    for (auto in = part.begin(); in != part.end(); ++in, ++out)
+      *out += *in;
+  }
+};
+
+/// Reduction operation for PerThread merging sets (or other containers)
+struct InsertAll {
+  template <typename Container>
+  void operator()(Container &total, const Container &part) const {
+    total.insert(part.begin(), part.end());
+  }
+};
+
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_PERTHREAD_H_ */
@@ -0,0 +1,110 @@
+#ifndef MANTID_KERNEL_SLABALLOCATOR_H_
+#define MANTID_KERNEL_SLABALLOCATOR_H_
+
+#include "MantidKernel/DllConfig.h"
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+
+/** SlabAllocator : Hands out memory for many small objects of a few different
+  sizes, e.g. the boxes of an MDEventWorkspace, from large slabs instead of
+  one heap allocation per object. Freed blocks are kept on a free list for
+  the next object of the same size, and the slabs are released all at once.
+
+  Blocks remember the allocator they came from, so deallocate() is static and
+  can be called from an operator delete. Blocks may also be allocated from
+  the heap with allocateUnpooled() and handed to the same deallocate().
+
+  The allocator is not deleted directly: the owner calls release() when it is
+  finished with it. The slabs are freed once every block has been returned,
+  so objects may safely outlive the owner of the allocator.
+
+  Allocation and deallocation are thread-safe.
+
+  Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class MANTID_KERNEL_DLL SlabAllocator {
+public:
+  /// Default size of a slab, in bytes
+  static const size_t DEFAULT_SLAB_BYTES = 1024 * 1024;
+
+  explicit SlabAllocator(const size_t slabBytes = DEFAULT_SLAB_BYTES);
+  SlabAllocator(const SlabAllocator &) = delete;
+  SlabAllocator &operator=(const SlabAllocator &) = delete;
+
+  void *allocate(const size_t bytes);
+  static void *allocateUnpooled(const size_t bytes);
+  static void deallocate(void *ptr);
+  void release();
+
+  size_t numBlocksInUse() const;
+  size_t numBytesReserved() const;
+
+private:
+  ~SlabAllocator();
+
+  /// Blocks of one size
+  struct Pool {
+    /// Size of a block, including the header
+    size_t blockBytes;
+    /// Free blocks, linked through their first bytes
+    void *freeList;
+    /// Unused part of the newest slab of the pool
+    char *next;
+    char *end;
+  };
+
+  /// Written in front of every block
+  struct alignas(16) Header {
+    /// The allocator, or nullptr for blocks from the heap
+    SlabAllocator *owner;
+    /// Index into m_pools
+    size_t pool;
+  };
+
+  void returnBlock(Header *header);
+
+  /// Size of a new slab, in bytes
+  const size_t m_slabBytes;
+  /// Pools for each block size that has been requested
+  std::vector<Pool> m_pools;
+  /// The memory handed out by the pools
+  std::vector<std::unique_ptr<char[]>> m_slabs;
+  /// Total size of the slabs
+  size_t m_bytesReserved;
+  /// Number of blocks allocated and not yet returned
+  size_t m_blocksInUse;
+  /// Set once the owner has released the allocator
+  bool m_released;
+  /// Protects all of the above
+  mutable std::mutex m_mutex;
+};
+
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_SLABALLOCATOR_H_ */
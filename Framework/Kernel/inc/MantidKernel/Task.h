@@ -47,6 +47,10 @@ public:
    */
   virtual double cost() { return m_cost; }
 
+  //---------------------------------------------------------------------------------------------
+  /** @return a name for the kind of task, used to label it in traces */
+  virtual const char *name() const { return "Task"; }
+
   //---------------------------------------------------------------------------------------------
   /** Use an arbitrary pointer to lock (mutex) the execution of this task.
    * For example, you might point to a particular EventList in memory to signify
@@ -23,12 +23,23 @@ namespace Kernel {
  * Popping a task scales with the N^2 where N is the number of different
  *mutexes.
  *
+ * By default, when every queued task has a busy mutex, one of them is still
+ * returned and the calling thread then blocks on that mutex. This can be
+ * turned off in the constructor, in which case pop() returns NULL and the
+ * thread remains free to run tasks that are pushed while it waits (e.g.
+ * processing tasks created by the task holding the disk mutex).
+ *
  * @author Janik Zikovsky
  * @date 2011-02-25 16:39:43.233991
  */
 class DLLExport ThreadSchedulerMutexes : public ThreadScheduler {
 public:
-  ThreadSchedulerMutexes() = default;
+  /** Constructor
+   * @param popBusyMutexTasks :: if true, return a task whose mutex is busy
+   *        when no other task can run; the thread will then wait on it.
+   */
+  explicit ThreadSchedulerMutexes(const bool popBusyMutexTasks = true)
+      : m_popBusyMutexTasks(popBusyMutexTasks) {}
 
   ~ThreadSchedulerMutexes() override { clear(); }
 
@@ -74,7 +85,7 @@ public:
           }
         }
       }
-      if (temp == nullptr) {
+      if (temp == nullptr && m_popBusyMutexTasks) {
         // Nothing was found, meaning all mutexes are in use
         // Try the first non-empty map
         for (auto &mutexedMap : m_supermap) {
@@ -167,6 +178,9 @@ protected:
 
   /// Vector of currently used mutexes.
   std::set<boost::shared_ptr<std::mutex>> m_mutexes;
+
+  /// Return tasks with a busy mutex if nothing else can run
+  const bool m_popBusyMutexTasks;
 };
 
 } // namespace Kernel
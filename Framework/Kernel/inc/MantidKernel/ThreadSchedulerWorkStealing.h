@@ -0,0 +1,93 @@
+#ifndef MANTID_KERNEL_THREADSCHEDULERWORKSTEALING_H_
+#define MANTID_KERNEL_THREADSCHEDULERWORKSTEALING_H_
+
+#include "MantidKernel/DllConfig.h"
+#include "MantidKernel/ThreadScheduler.h"
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+
+/** ThreadSchedulerWorkStealing : A ThreadScheduler that keeps one queue of
+ * tasks per thread instead of a single shared queue.
+ *
+ * A thread pops the most recently added task from its own queue. When that is
+ * empty it steals the oldest task from the queue of another thread. Tasks
+ * pushed from inside a running task go to the queue of the thread running it,
+ * other tasks are spread over the queues in turn. Each queue has its own lock,
+ * so threads only contend with each other when stealing.
+ *
+ * This suits a large number of small tasks, in particular tasks that create
+ * more tasks (e.g. splitting MD boxes). Task mutexes are not taken into
+ * account; use ThreadSchedulerMutexes for that. totalCost() is not tracked by
+ * this scheduler, to keep push() free of a shared lock.
+ *
+ * Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+ * National Laboratory & European Spallation Source
+ *
+ * This file is part of Mantid.
+ *
+ * Mantid is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Mantid is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * File change history is stored at: <https://github.com/mantidproject/mantid>
+ * Code Documentation is available at: <http://doxygen.mantidproject.org>
+ */
+class MANTID_KERNEL_DLL ThreadSchedulerWorkStealing : public ThreadScheduler {
+public:
+  explicit ThreadSchedulerWorkStealing(size_t numThreads = 0);
+  ~ThreadSchedulerWorkStealing() override;
+
+  void push(Task *newTask) override;
+  Task *pop(size_t threadnum) override;
+  size_t size() override;
+  bool empty() override;
+  void clear() override;
+
+  /// @return the number of tasks taken from the queue of another thread
+  size_t numberOfSteals() const { return m_numSteals; }
+  /// @return the number of calls to pop() that found no task to run
+  size_t numberOfIdlePops() const { return m_numIdlePops; }
+
+private:
+  /// A queue of tasks with its own lock
+  struct WorkQueue {
+    std::mutex lock;
+    std::deque<Task *> tasks;
+  };
+
+  Task *popBack(WorkQueue &queue);
+  Task *popFront(WorkQueue &queue);
+
+  /// Unique id of this scheduler
+  const size_t m_id;
+  /// One queue per thread
+  std::vector<std::unique_ptr<WorkQueue>> m_queues;
+  /// Queue receiving the next task pushed from outside the pool
+  std::atomic<size_t> m_nextQueue;
+  /// Number of tasks in all queues
+  std::atomic<size_t> m_numTasks;
+  /// Number of tasks stolen from another thread's queue
+  std::atomic<size_t> m_numSteals;
+  /// Number of pops that returned no task
+  std::atomic<size_t> m_numIdlePops;
+};
+
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_THREADSCHEDULERWORKSTEALING_H_ */
@@ -343,6 +343,11 @@ private:
   bool isTimeFiltered(const Types::Core::DateAndTime &time) const;
   /// Time weighted mean and standard deviation
   std::pair<double, double> timeAverageValueAndStdDev() const;
+  /// Time integrals of the value and its square up to a time
+  std::pair<double, double>
+  integralsUpTo(const Types::Core::DateAndTime &t) const;
+  /// Bring the running time integrals up to date with the values
+  void updateIntegrals() const;
 
   /// Holds the time series data
   mutable std::vector<TimeValueUnit<TYPE>> m_values;
@@ -360,6 +365,10 @@ private:
   mutable std::vector<std::pair<size_t, size_t>> m_filterQuickRef;
   /// True if a filter has been applied
   mutable bool m_filterApplied;
+  /// Running time integrals (in seconds) of the value and of its square up to
+  /// the time of each entry, with the first value subtracted from every value.
+  /// Built on demand and extended as values are appended in time order.
+  mutable std::vector<std::pair<double, double>> m_integrals;
 };
 
 /// Function filtering double TimeSeriesProperties according to the requested
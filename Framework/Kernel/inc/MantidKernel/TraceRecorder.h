@@ -0,0 +1,128 @@
+#ifndef MANTID_KERNEL_TRACERECORDER_H_
+#define MANTID_KERNEL_TRACERECORDER_H_
+
+#include "MantidKernel/DllConfig.h"
+#include "MantidKernel/SingletonHolder.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+
+/** TraceRecorderImpl : Records when algorithms, thread pool tasks and other
+  marked regions of code start and finish, on which thread, and writes them
+  out in the Chrome trace event format. The file can be opened in
+  chrome://tracing or https://ui.perfetto.dev.
+
+  Recording is off by default and costs a single check of an atomic flag per
+  region. It is switched on by setting the configuration key tracing.filename
+  to the name of the file to write on shutdown, or with setEnabled().
+
+  A region of code is recorded with a Scope:
+  @code
+  {
+    TraceRecorderImpl::Scope scope("ReadBank", "io");
+    ...
+  }
+  @endcode
+
+  Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class MANTID_KERNEL_DLL TraceRecorderImpl {
+public:
+  /// A region of code that has finished
+  struct Event {
+    std::string name;
+    std::string category;
+    /// Start time in microseconds since the recorder was created
+    int64_t start;
+    /// Duration in microseconds
+    int64_t duration;
+    /// Small integer identifying the thread that ran the region
+    int thread;
+  };
+
+  /// Records the lifetime of the object as a region, if recording is enabled
+  /// when it is created.
+  class MANTID_KERNEL_DLL Scope {
+  public:
+    Scope(const std::string &name, const char *category);
+    Scope(const char *name, const char *category);
+    ~Scope();
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+  private:
+    bool m_enabled;
+    std::string m_name;
+    const char *m_category;
+    int64_t m_start;
+  };
+
+  /// @return true if regions are being recorded
+  bool isEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+  void setEnabled(const bool enabled);
+
+  void record(const std::string &name, const std::string &category,
+              const int64_t start, const int64_t duration);
+  int64_t now() const;
+  static int currentThread();
+
+  std::vector<Event> events() const;
+  void clear();
+  void writeJSON(std::ostream &out) const;
+  void writeFile(const std::string &filename) const;
+  void shutdown();
+
+private:
+  friend struct Mantid::Kernel::CreateUsingNew<TraceRecorderImpl>;
+  TraceRecorderImpl();
+  ~TraceRecorderImpl();
+  TraceRecorderImpl(const TraceRecorderImpl &) = delete;
+  TraceRecorderImpl &operator=(const TraceRecorderImpl &) = delete;
+
+  /// Whether regions are being recorded
+  std::atomic<bool> m_enabled;
+  /// File to write on shutdown, if any
+  std::string m_filename;
+  /// Time from which event times are measured
+  const std::chrono::steady_clock::time_point m_origin;
+  /// The recorded events
+  std::vector<Event> m_events;
+  /// Protects m_events
+  mutable std::mutex m_mutex;
+};
+
+EXTERN_MANTID_KERNEL template class MANTID_KERNEL_DLL
+    Mantid::Kernel::SingletonHolder<TraceRecorderImpl>;
+using TraceRecorder = Mantid::Kernel::SingletonHolder<TraceRecorderImpl>;
+
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_TRACERECORDER_H_ */
@@ -183,6 +183,21 @@ public:
    */
   virtual double singleFromTOF(const double tof) const = 0;
 
+  /** Convert an array of X values to TOF in place. The unit must have been
+   * initialized. The default calls singleToTOF() for each value; units
+   * override it with a loop free of virtual calls.
+   * @param values :: the values to convert
+   * @param count :: the number of values
+   */
+  virtual void manyToTOF(double *values, const size_t count) const;
+
+  /** Convert an array of TOF values to this unit in place. The unit must have
+   * been initialized.
+   * @param values :: the values to convert
+   * @param count :: the number of values
+   */
+  virtual void manyFromTOF(double *values, const size_t count) const;
+
   /// @return true if the unit was initialized and so can use singleToTOF()
   bool isInitialized() const { return initialized; }
 
@@ -303,6 +318,8 @@ public:
   void init() override;
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void manyToTOF(double *values, const size_t count) const override;
+  void manyFromTOF(double *values, const size_t count) const override;
   Unit *clone() const override;
   ///@return -DBL_MAX as ToF convertible to TOF for in any time range
   double conversionTOFMin() const override;
@@ -320,6 +337,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void manyToTOF(double *values, const size_t count) const override;
+  void manyFromTOF(double *values, const size_t count) const override;
   void init() override;
   Unit *clone() const override;
 
@@ -347,6 +366,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void manyToTOF(double *values, const size_t count) const override;
+  void manyFromTOF(double *values, const size_t count) const override;
   void init() override;
   Unit *clone() const override;
 
@@ -394,6 +415,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void manyToTOF(double *values, const size_t count) const override;
+  void manyFromTOF(double *values, const size_t count) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -444,6 +467,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void manyToTOF(double *values, const size_t count) const override;
+  void manyFromTOF(double *values, const size_t count) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -489,6 +514,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void manyToTOF(double *values, const size_t count) const override;
+  void manyFromTOF(double *values, const size_t count) const override;
   void init() override;
   Unit *clone() const override;
 
@@ -574,6 +601,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void manyToTOF(double *values, const size_t count) const override;
+  void manyFromTOF(double *values, const size_t count) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -593,6 +622,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void manyToTOF(double *values, const size_t count) const override;
+  void manyFromTOF(double *values, const size_t count) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
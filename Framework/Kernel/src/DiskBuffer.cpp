@@ -1,5 +1,6 @@
 #include "MantidKernel/DiskBuffer.h"
 #include "MantidKernel/ISaveable.h"
+#include <algorithm>
 #include <sstream>
 #include <utility>
 
@@ -8,12 +9,21 @@ using namespace Mantid::Kernel;
 namespace Mantid {
 namespace Kernel {
 
+namespace {
+/// Number of objects waiting to be prefetched beyond which further requests
+/// are ignored
+const size_t MAX_PREFETCH_QUEUE = 64;
+} // namespace
+
 //----------------------------------------------------------------------------------------------
 /** Constructor
  */
 DiskBuffer::DiskBuffer()
     : m_writeBufferSize(50), m_writeBufferUsed(0), m_nObjectsToWrite(0),
-      m_free(), m_free_bySize(m_free.get<1>()), m_fileLength(0) {
+      m_writeRequested(false), m_stopIOThread(false), m_writePassesStarted(0),
+      m_writePassesDone(0), m_writingObject(nullptr), m_loadingObject(nullptr),
+      m_flushObject(nullptr), m_free(), m_free_bySize(m_free.get<1>()),
+      m_fileLength(0) {
   m_free.clear();
 }
 
@@ -26,17 +36,28 @@ DiskBuffer::DiskBuffer()
  */
 DiskBuffer::DiskBuffer(uint64_t m_writeBufferSize)
     : m_writeBufferSize(m_writeBufferSize), m_writeBufferUsed(0),
-      m_nObjectsToWrite(0), m_free(), m_free_bySize(m_free.get<1>()),
-      m_fileLength(0) {
+      m_nObjectsToWrite(0), m_writeRequested(false), m_stopIOThread(false),
+      m_writePassesStarted(0), m_writePassesDone(0), m_writingObject(nullptr),
+      m_loadingObject(nullptr), m_flushObject(nullptr), m_free(),
+      m_free_bySize(m_free.get<1>()), m_fileLength(0) {
   m_free.clear();
 }
 
+//----------------------------------------------------------------------------------------------
+/** Destructor. Stops the I/O thread, if any. Subclasses that write to a file
+ * must stop it themselves before closing the file.
+ */
+DiskBuffer::~DiskBuffer() { stopIOThread(); }
+
 //---------------------------------------------------------------------------------------------
 /** Call this method when an object is ready to be written
  * out to disk.
  *
  * When the to-write buffer is full, all of it gets written
- * out to disk using writeOldObjects()
+ * out to disk using writeOldObjects(), by this thread or by the I/O thread
+ * if there is one. When the I/O thread falls behind so that the buffer holds
+ * more than twice its size, the calling thread waits for it to write the
+ * buffer out.
  *
  * @param item :: item that can be written to disk.
  */
@@ -45,27 +66,42 @@ void DiskBuffer::toWrite(ISaveable *item) {
     return;
   //    if (!m_useWriteBuffer) return;
 
+  std::unique_lock<std::mutex> uniqueLock(m_mutex);
   if (item->getBufPostion()) // already in the buffer and probably have changed
                              // its size in memory
   {
     // forget old memory size
-    std::unique_lock<std::mutex> uniqueLock(m_mutex);
     m_writeBufferUsed -= item->getBufferSize();
     // add new size
     size_t newMemorySize = item->getDataMemorySize();
     m_writeBufferUsed += newMemorySize;
-    uniqueLock.unlock();
     item->setBufferSize(newMemorySize);
   } else {
-    std::lock_guard<std::mutex> lock(m_mutex);
     m_toWriteBuffer.push_front(item);
     m_writeBufferUsed += item->setBufferPosition(m_toWriteBuffer.begin());
     m_nObjectsToWrite++;
   }
 
   // Should we now write out the old data?
-  if (m_writeBufferUsed > m_writeBufferSize)
-    writeOldObjects();
+  if (m_writeBufferUsed > m_writeBufferSize) {
+    if (m_ioThread.joinable()) {
+      m_writeRequested = true;
+      m_ioCondition.notify_all();
+      if (m_writeBufferUsed > 2 * m_writeBufferSize &&
+          std::this_thread::get_id() != m_ioThread.get_id()) {
+        // Busy objects are skipped, so wait for the next pass rather than
+        // for the buffer to empty
+        const uint64_t pass = m_writePassesStarted + 1;
+        m_ioCondition.wait(uniqueLock, [this, pass] {
+          return m_writeBufferUsed <= 2 * m_writeBufferSize ||
+                 m_writePassesDone >= pass || m_stopIOThread;
+        });
+      }
+    } else {
+      uniqueLock.unlock();
+      writeOldObjects();
+    }
+  }
 }
 
 //---------------------------------------------------------------------------------------------
@@ -79,8 +115,18 @@ void DiskBuffer::toWrite(ISaveable *item) {
 void DiskBuffer::objectDeleted(ISaveable *item) {
   if (item == nullptr)
     return;
-  // have it ever been in the buffer?
   std::unique_lock<std::mutex> uniqueLock(m_mutex);
+  // The object may be being written or loaded right now
+  m_ioCondition.wait(uniqueLock, [this, item] {
+    return m_writingObject != item && m_loadingObject != item;
+  });
+  if (m_flushObject == item)
+    m_flushObject = nullptr;
+  m_toPrefetch.erase(
+      std::remove(m_toPrefetch.begin(), m_toPrefetch.end(), item),
+      m_toPrefetch.end());
+
+  // have it ever been in the buffer?
   auto opt2it = item->getBufPostion();
   if (opt2it) {
     m_writeBufferUsed -= item->getBufferSize();
@@ -101,95 +147,267 @@ void DiskBuffer::objectDeleted(ISaveable *item) {
 //---------------------------------------------------------------------------------------------
 /** Method to write out the old objects that have been
  * stored in the "toWrite" buffer.
+ *
+ * The buffer is not locked while an object is written, so other threads can
+ * keep adding to it. Objects added meanwhile are left for the next call.
+ * Each object is written and removed from the buffer under its own data lock,
+ * so that it can not be marked busy or changed in the meantime. The file is
+ * flushed once at the end, through an object which has not been deleted.
  */
 void DiskBuffer::writeOldObjects() {
+  std::lock_guard<std::mutex> writeLock(m_writeMutex);
+  std::unique_lock<std::mutex> uniqueLock(m_mutex);
+  m_writeRequested = false;
+  ++m_writePassesStarted;
 
-  std::lock_guard<std::mutex> _lock(m_mutex);
-  // Holder for any objects that you were NOT able to write.
-  std::list<ISaveable *> couldNotWrite;
-  size_t objectsNotWritten(0);
-  size_t memoryNotWritten(0);
-
-  // Iterate through the list
+  bool saved(false);
+  m_flushObject = nullptr;
   auto it = m_toWriteBuffer.begin();
-  auto it_end = m_toWriteBuffer.end();
-
-  ISaveable *obj = nullptr;
-
-  for (; it != it_end; ++it) {
-    obj = *it;
-    if (!obj->isBusy()) {
-      uint64_t NumObjEvents = obj->getTotalDataSize();
-      uint64_t fileIndexStart;
-      if (!obj->wasSaved()) {
-        fileIndexStart = this->allocate(NumObjEvents);
-        // Write to the disk; this will call the object specific save function;
-        // Prevent simultaneous file access (e.g. write while loading)
-        obj->saveAt(fileIndexStart, NumObjEvents);
-      } else {
-        uint64_t NumFileEvents = obj->getFileSize();
-        if (NumObjEvents != NumFileEvents) {
-          // Event list changed size. The MRU can tell us where it best fits
-          // now.
-          fileIndexStart = this->relocate(obj->getFilePosition(), NumFileEvents,
-                                          NumObjEvents);
-          // Write to the disk; this will call the object specific save
-          // function;
-          obj->saveAt(fileIndexStart, NumObjEvents);
-        } else // despite object size have not been changed, it can be modified
-               // other way. In this case, the method which changed the data
-               // should set dataChanged ID
-        {
-          if (obj->isDataChanged()) {
-            fileIndexStart = obj->getFilePosition();
-            // Write to the disk; this will call the object specific save
-            // function;
-            obj->saveAt(fileIndexStart, NumObjEvents);
-            // this is questionable operation, which adjust file size in case
-            // when the file postions were allocated externaly
-            if (fileIndexStart + NumObjEvents > m_fileLength)
-              m_fileLength = fileIndexStart + NumObjEvents;
-          } else // just clean the object up -- it just occupies memory
-            obj->clearDataFromMemory();
-        }
-      }
-      // tell the object that it has been removed from the buffer
-      obj->clearBufferState();
-    } else // object busy
-    {
-      // The object is busy, can't write. Save it for later
-      couldNotWrite.push_back(obj);
-      // When a prefix or postfix operator is applied to a function argument,
-      // the value of the argument is
-      // NOT GUARANTEED to be incremented or decremented before it is passed to
-      // the function.
-      auto it = --couldNotWrite.end();
-      memoryNotWritten += obj->setBufferPosition(it);
-      objectsNotWritten++;
+  while (it != m_toWriteBuffer.end()) {
+    ISaveable *obj = *it;
+    if (obj->isBusy()) {
+      // The object is busy, can't write. Leave it for later
+      ++it;
+      continue;
     }
+    // objectDeleted() waits until the object has been written
+    m_writingObject = obj;
+    m_ioCondition.notify_all();
+    uniqueLock.unlock();
+    std::unique_lock<std::mutex> dataLock;
+    bool busy(false);
+    try {
+      // Loading takes the data lock, so load the old contents of an object
+      // which is going to be saved first
+      if (obj->wasSaved() && !obj->isLoaded() &&
+          (obj->getTotalDataSize() != obj->getFileSize() ||
+           obj->isDataChanged()))
+        obj->load();
+      if (std::mutex *dataMutex = obj->getDataMutex())
+        dataLock = std::unique_lock<std::mutex>(*dataMutex);
+      // check again, now that nobody can mark the object busy
+      busy = obj->isBusy();
+      if (!busy)
+        writeObject(obj);
+    } catch (...) {
+      uniqueLock.lock();
+      m_writingObject = nullptr;
+      m_flushObject = nullptr;
+      ++m_writePassesDone;
+      m_ioCondition.notify_all();
+      throw;
+    }
+    uniqueLock.lock();
+    if (busy) {
+      ++it;
+      continue;
+    }
+    // tell the object that it has been removed from the buffer
+    m_writeBufferUsed -= obj->getBufferSize();
+    m_nObjectsToWrite--;
+    obj->clearBufferState();
+    it = m_toWriteBuffer.erase(it);
+    m_flushObject = obj;
+    saved = true;
   }
 
   // use last object to clear NeXus buffer and actually write data to HDD
-  if (obj) {
+  if (saved) {
     // NXS needs to flush the writes to file by closing and re-opening the data
     // block.
     // For speed, it is best to do this only once per write dump, using last
-    // object saved
-    obj->flushData();
+    // object saved. If that has been deleted since, any object still in the
+    // buffer shares the file; failing that, closing the file flushes it.
+    ISaveable *flushObject = m_flushObject;
+    if (!flushObject && !m_toWriteBuffer.empty())
+      flushObject = m_toWriteBuffer.front();
+    if (flushObject) {
+      // objectDeleted() waits until the flush is done
+      m_writingObject = flushObject;
+      m_ioCondition.notify_all();
+      uniqueLock.unlock();
+      try {
+        flushObject->flushData();
+      } catch (...) {
+        uniqueLock.lock();
+        m_writingObject = nullptr;
+        m_flushObject = nullptr;
+        ++m_writePassesDone;
+        m_ioCondition.notify_all();
+        throw;
+      }
+      uniqueLock.lock();
+    }
   }
+  m_writingObject = nullptr;
+  m_flushObject = nullptr;
+  ++m_writePassesDone;
+  m_ioCondition.notify_all();
+}
 
-  // Exchange with the new map you built out of the not-written blocks.
-  m_toWriteBuffer.swap(couldNotWrite);
-  m_writeBufferUsed = memoryNotWritten;
-  m_nObjectsToWrite = objectsNotWritten;
+//---------------------------------------------------------------------------------------------
+/** Write one object from the buffer to its place in the file, or just clear
+ * it from memory if it has not changed.
+ * @param obj :: the object, which must not be busy
+ */
+void DiskBuffer::writeObject(ISaveable *obj) {
+  uint64_t NumObjEvents = obj->getTotalDataSize();
+  uint64_t fileIndexStart;
+  if (!obj->wasSaved()) {
+    fileIndexStart = this->allocate(NumObjEvents);
+    // Write to the disk; this will call the object specific save function;
+    // Prevent simultaneous file access (e.g. write while loading)
+    obj->saveAt(fileIndexStart, NumObjEvents);
+  } else {
+    uint64_t NumFileEvents = obj->getFileSize();
+    if (NumObjEvents != NumFileEvents) {
+      // Event list changed size. The MRU can tell us where it best fits
+      // now.
+      fileIndexStart =
+          this->relocate(obj->getFilePosition(), NumFileEvents, NumObjEvents);
+      // Write to the disk; this will call the object specific save
+      // function;
+      obj->saveAt(fileIndexStart, NumObjEvents);
+    } else // despite object size have not been changed, it can be modified
+           // other way. In this case, the method which changed the data
+           // should set dataChanged ID
+    {
+      if (obj->isDataChanged()) {
+        fileIndexStart = obj->getFilePosition();
+        // Write to the disk; this will call the object specific save
+        // function;
+        obj->saveAt(fileIndexStart, NumObjEvents);
+        // this is questionable operation, which adjust file size in case
+        // when the file postions were allocated externaly
+        if (fileIndexStart + NumObjEvents > m_fileLength)
+          m_fileLength = fileIndexStart + NumObjEvents;
+      } else // just clean the object up -- it just occupies memory
+        obj->clearDataFromMemory();
+    }
+  }
 }
 
 //---------------------------------------------------------------------------------------------
 /** Flush out all the data in the memory; and writes out everything in the
- * to-write cache. */
+ * to-write cache.
+ * @throw any error raised while the I/O thread was writing
+ */
 void DiskBuffer::flushCache() {
   // Now write everything out.
   writeOldObjects();
+
+  std::exception_ptr error;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::swap(error, m_ioError);
+  }
+  if (error)
+    std::rethrow_exception(error);
+}
+
+//---------------------------------------------------------------------------------------------
+/** Start a background thread to write out the buffer when it is full and to
+ * load objects passed to prefetch(). Does nothing if it is already running.
+ * Must not be called while other threads are using the buffer.
+ */
+void DiskBuffer::startIOThread() {
+  if (m_ioThread.joinable())
+    return;
+  m_stopIOThread = false;
+  m_ioThread = std::thread(&DiskBuffer::runIOThread, this);
+}
+
+//---------------------------------------------------------------------------------------------
+/** Stop the I/O thread, if any, once it has finished any write it was asked
+ * to do. Objects left in the buffer are written by the next flushCache() or
+ * toWrite(). Must not be called while other threads are using the buffer.
+ */
+void DiskBuffer::stopIOThread() {
+  if (!m_ioThread.joinable())
+    return;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stopIOThread = true;
+    m_toPrefetch.clear();
+  }
+  m_ioCondition.notify_all();
+  m_ioThread.join();
+}
+
+//---------------------------------------------------------------------------------------------
+/** Wait until the I/O thread, if any, has finished writing out the buffer,
+ * including any write it has been asked to do but has not started yet.
+ * Objects loaded ahead of use may still be loading.
+ */
+void DiskBuffer::waitForIOThread() {
+  if (!m_ioThread.joinable())
+    return;
+  std::unique_lock<std::mutex> uniqueLock(m_mutex);
+  m_ioCondition.wait(uniqueLock, [this] {
+    return (!m_writeRequested &&
+            m_writePassesDone == m_writePassesStarted) ||
+           m_stopIOThread;
+  });
+}
+
+//---------------------------------------------------------------------------------------------
+/** Ask the I/O thread to load an object that will be used soon. Does nothing
+ * if there is no I/O thread, or if too many objects are already waiting.
+ * The object is added to the to-write buffer once it is loaded, so its
+ * memory is released again if it is not used.
+ *
+ * @param item :: object to load
+ */
+void DiskBuffer::prefetch(ISaveable *item) {
+  if (item == nullptr || !m_ioThread.joinable())
+    return;
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_toPrefetch.size() >= MAX_PREFETCH_QUEUE)
+    return;
+  m_toPrefetch.push_back(item);
+  m_ioCondition.notify_all();
+}
+
+//---------------------------------------------------------------------------------------------
+/** Body of the I/O thread. Writing out the buffer takes priority over
+ * loading objects ahead of use.
+ */
+void DiskBuffer::runIOThread() {
+  std::unique_lock<std::mutex> uniqueLock(m_mutex);
+  while (true) {
+    m_ioCondition.wait(uniqueLock, [this] {
+      return m_writeRequested || m_stopIOThread || !m_toPrefetch.empty();
+    });
+    if (m_writeRequested) {
+      uniqueLock.unlock();
+      try {
+        writeOldObjects();
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_ioError)
+          m_ioError = std::current_exception();
+      }
+      uniqueLock.lock();
+    } else if (m_stopIOThread) {
+      break;
+    } else {
+      ISaveable *item = m_toPrefetch.front();
+      m_toPrefetch.pop_front();
+      m_loadingObject = item;
+      uniqueLock.unlock();
+      try {
+        if (item->loadAhead())
+          toWrite(item);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_ioError)
+          m_ioError = std::current_exception();
+      }
+      uniqueLock.lock();
+      m_loadingObject = nullptr;
+      m_ioCondition.notify_all();
+    }
+  }
 }
 
 //---------------------------------------------------------------------------------------------
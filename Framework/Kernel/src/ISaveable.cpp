@@ -16,7 +16,7 @@ ISaveable::ISaveable()
     Note setting isLoaded to false to break connection with the file object
    which is not copyale */
 ISaveable::ISaveable(const ISaveable &other)
-    : m_Busy(other.m_Busy), m_dataChanged(other.m_dataChanged),
+    : m_Busy(other.m_Busy.load()), m_dataChanged(other.m_dataChanged),
       m_wasSaved(other.m_wasSaved), m_isLoaded(false),
       m_BufPosition(other.m_BufPosition),
       m_BufMemorySize(other.m_BufMemorySize),
@@ -60,6 +60,19 @@ void ISaveable::saveAt(uint64_t newPos, uint64_t newSize) {
   this->clearDataFromMemory();
 }
 
+/** private function used by the disk buffer to load the contents of an object
+ which is about to be used. Nothing is done if the object is busy, already
+ loaded or was never saved.
+ @returns true if the object was loaded
+*/
+bool ISaveable::loadAhead() {
+  std::lock_guard<std::mutex> lock(m_setter);
+  if (m_Busy || m_isLoaded || !m_wasSaved)
+    return false;
+  this->load();
+  return true;
+}
+
 /** Method stores the position of the object in Disc buffer and returns the size
  * of this object for disk buffer to store
  * @param bufPosition -- the allocator which specifies the position of the
@@ -0,0 +1,136 @@
+#include "MantidKernel/SlabAllocator.h"
+
+#include <algorithm>
+#include <new>
+
+namespace Mantid {
+namespace Kernel {
+
+namespace {
+/// Alignment of the blocks, which is that of the header
+const size_t ALIGNMENT = 16;
+
+/// @return bytes rounded up to a multiple of the alignment
+size_t roundUp(const size_t bytes) {
+  return (bytes + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+}
+} // namespace
+
+/** Constructor
+ * @param slabBytes :: size of each slab requested from the heap, in bytes
+ */
+SlabAllocator::SlabAllocator(const size_t slabBytes)
+    : m_slabBytes(slabBytes), m_bytesReserved(0), m_blocksInUse(0),
+      m_released(false) {}
+
+/// Destructor. Frees the slabs.
+SlabAllocator::~SlabAllocator() = default;
+
+/** Allocate a block from the slabs
+ * @param bytes :: size of the block
+ * @return pointer to the block, aligned for any fundamental type
+ */
+void *SlabAllocator::allocate(const size_t bytes) {
+  const size_t blockBytes =
+      sizeof(Header) + roundUp(std::max(bytes, sizeof(void *)));
+  std::lock_guard<std::mutex> lock(m_mutex);
+  // There are only ever a few pools, e.g. one per box type
+  auto pool = std::find_if(
+      m_pools.begin(), m_pools.end(),
+      [blockBytes](const Pool &p) { return p.blockBytes == blockBytes; });
+  if (pool == m_pools.end()) {
+    m_pools.push_back(Pool{blockBytes, nullptr, nullptr, nullptr});
+    pool = m_pools.end() - 1;
+  }
+
+  Header *header;
+  if (pool->freeList) {
+    header = static_cast<Header *>(pool->freeList);
+    pool->freeList = *reinterpret_cast<void **>(header + 1);
+  } else {
+    if (pool->next == pool->end) {
+      const size_t slabBytes =
+          std::max(m_slabBytes / blockBytes, size_t(1)) * blockBytes;
+      m_slabs.emplace_back(new char[slabBytes]);
+      m_bytesReserved += slabBytes;
+      pool->next = m_slabs.back().get();
+      pool->end = pool->next + slabBytes;
+    }
+    header = reinterpret_cast<Header *>(pool->next);
+    pool->next += blockBytes;
+  }
+  header->owner = this;
+  header->pool = static_cast<size_t>(pool - m_pools.begin());
+  ++m_blocksInUse;
+  return header + 1;
+}
+
+/** Allocate a block from the heap that can be passed to deallocate()
+ * @param bytes :: size of the block
+ * @return pointer to the block
+ */
+void *SlabAllocator::allocateUnpooled(const size_t bytes) {
+  auto header = static_cast<Header *>(::operator new(sizeof(Header) + bytes));
+  header->owner = nullptr;
+  header->pool = 0;
+  return header + 1;
+}
+
+/** Return a block to the allocator it came from, or to the heap
+ * @param ptr :: a block from allocate() or allocateUnpooled(). May be null.
+ */
+void SlabAllocator::deallocate(void *ptr) {
+  if (!ptr)
+    return;
+  auto header = static_cast<Header *>(ptr) - 1;
+  if (header->owner)
+    header->owner->returnBlock(header);
+  else
+    ::operator delete(header);
+}
+
+/** Put a block on the free list of its pool. Deletes the allocator if it was
+ * released and this was the last block in use.
+ * @param header :: the header of the block
+ */
+void SlabAllocator::returnBlock(Header *header) {
+  bool finished;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto &pool = m_pools[header->pool];
+    *reinterpret_cast<void **>(header + 1) = pool.freeList;
+    pool.freeList = header;
+    --m_blocksInUse;
+    finished = m_released && m_blocksInUse == 0;
+  }
+  if (finished)
+    delete this;
+}
+
+/// Called by the owner instead of deleting the allocator. The slabs are freed
+/// now, or when the last block in use is returned.
+void SlabAllocator::release() {
+  bool finished;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_released = true;
+    finished = m_blocksInUse == 0;
+  }
+  if (finished)
+    delete this;
+}
+
+/// @return the number of blocks allocated and not yet returned
+size_t SlabAllocator::numBlocksInUse() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_blocksInUse;
+}
+
+/// @return the total size of the slabs, in bytes
+size_t SlabAllocator::numBytesReserved() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_bytesReserved;
+}
+
+} // namespace Kernel
+} // namespace Mantid
@@ -2,6 +2,7 @@
 #include "MantidKernel/ProgressBase.h"
 #include "MantidKernel/Task.h"
 #include "MantidKernel/ThreadScheduler.h"
+#include "MantidKernel/TraceRecorder.h"
 
 #include <Poco/Thread.h>
 
@@ -58,6 +59,7 @@ void ThreadPoolRunnable::run() {
         mutex->lock();
 
       try {
+        TraceRecorderImpl::Scope trace(task->name(), "task");
         // Run the task (synchronously within this thread)
         task->run();
       } catch (std::exception &e) {
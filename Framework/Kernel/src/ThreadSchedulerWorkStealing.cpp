@@ -0,0 +1,130 @@
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
+#include "MantidKernel/ThreadPool.h"
+
+namespace Mantid {
+namespace Kernel {
+
+namespace {
+/// Source of unique scheduler ids. 0 is never used.
+std::atomic<size_t> nextSchedulerId(1);
+
+/// The scheduler and queue of the task running in this thread, if any
+struct CurrentQueue {
+  size_t schedulerId = 0;
+  size_t index = 0;
+};
+thread_local CurrentQueue currentQueue;
+} // namespace
+
+/** Constructor
+ *
+ * @param numThreads :: number of threads that will pop tasks, i.e. the
+ *        number of queues; default = 0, meaning one per physical core as used
+ *        by ThreadPool.
+ */
+ThreadSchedulerWorkStealing::ThreadSchedulerWorkStealing(size_t numThreads)
+    : ThreadScheduler(), m_id(nextSchedulerId++), m_nextQueue(0),
+      m_numTasks(0), m_numSteals(0), m_numIdlePops(0) {
+  if (numThreads == 0)
+    numThreads = ThreadPool::getNumPhysicalCores();
+  m_queues.reserve(numThreads);
+  for (size_t i = 0; i < numThreads; ++i)
+    m_queues.emplace_back(new WorkQueue);
+}
+
+/// Destructor. Deletes any tasks left in the queues.
+ThreadSchedulerWorkStealing::~ThreadSchedulerWorkStealing() { clear(); }
+
+/** Add a Task to the queue of the calling thread if it is running one of our
+ * tasks, otherwise to the next queue in turn.
+ * @param newTask :: Task to add to queue
+ */
+void ThreadSchedulerWorkStealing::push(Task *newTask) {
+  size_t index;
+  if (currentQueue.schedulerId == m_id)
+    index = currentQueue.index;
+  else
+    index = m_nextQueue++ % m_queues.size();
+
+  auto &queue = *m_queues[index];
+  std::lock_guard<std::mutex> lock(queue.lock);
+  queue.tasks.push_back(newTask);
+  ++m_numTasks;
+}
+
+/** Retrieves the next Task to execute: the newest task of this thread's
+ * queue or, if it is empty, the oldest task of another thread's queue.
+ * @param threadnum :: ID of the calling thread.
+ * @return a Task pointer to execute, or NULL if there are none.
+ */
+Task *ThreadSchedulerWorkStealing::pop(size_t threadnum) {
+  const size_t numQueues = m_queues.size();
+  const size_t own = threadnum % numQueues;
+  // Tasks created by the popped task will be added to this thread's queue
+  currentQueue.schedulerId = m_id;
+  currentQueue.index = own;
+
+  Task *task = popBack(*m_queues[own]);
+  if (task)
+    return task;
+
+  for (size_t i = 1; i < numQueues; ++i) {
+    task = popFront(*m_queues[(own + i) % numQueues]);
+    if (task) {
+      ++m_numSteals;
+      return task;
+    }
+  }
+  ++m_numIdlePops;
+  return nullptr;
+}
+
+/// @return the number of tasks in all of the queues
+size_t ThreadSchedulerWorkStealing::size() { return m_numTasks; }
+
+/// @return true if all of the queues are empty
+bool ThreadSchedulerWorkStealing::empty() { return m_numTasks == 0; }
+
+/// Empty out all of the queues, deleting the tasks.
+void ThreadSchedulerWorkStealing::clear() {
+  for (auto &queue : m_queues) {
+    std::lock_guard<std::mutex> lock(queue->lock);
+    for (auto task : queue->tasks)
+      delete task;
+    m_numTasks -= queue->tasks.size();
+    queue->tasks.clear();
+  }
+  m_cost = 0;
+  m_costExecuted = 0;
+}
+
+/** Take the newest task out of a queue
+ * @param queue :: the queue to pop
+ * @return the task or NULL if the queue is empty
+ */
+Task *ThreadSchedulerWorkStealing::popBack(WorkQueue &queue) {
+  std::lock_guard<std::mutex> lock(queue.lock);
+  if (queue.tasks.empty())
+    return nullptr;
+  Task *task = queue.tasks.back();
+  queue.tasks.pop_back();
+  --m_numTasks;
+  return task;
+}
+
+/** Take the oldest task out of a queue
+ * @param queue :: the queue to pop
+ * @return the task or NULL if the queue is empty
+ */
+Task *ThreadSchedulerWorkStealing::popFront(WorkQueue &queue) {
+  std::lock_guard<std::mutex> lock(queue.lock);
+  if (queue.tasks.empty())
+    return nullptr;
+  Task *task = queue.tasks.front();
+  queue.tasks.pop_front();
+  --m_numTasks;
+  return task;
+}
+
+} // namespace Kernel
+} // namespace Mantid
@@ -307,6 +307,7 @@ void TimeSeriesProperty<TYPE>::filterByTime(
 
   // 4. Make size consistent
   m_size = static_cast<int>(m_values.size());
+  m_integrals.clear();
 }
 
 /**
@@ -384,6 +385,7 @@ void TimeSeriesProperty<TYPE>::filterByTimes(
   mp_copy.clear();
 
   m_size = static_cast<int>(m_values.size());
+  m_integrals.clear();
 }
 
 /**
@@ -419,6 +421,7 @@ void TimeSeriesProperty<TYPE>::splitByTime(
         dynamic_cast<TimeSeriesProperty<TYPE> *>(outputs[i]);
     if (myOutput) {
       outputs_tsp.push_back(myOutput);
+      myOutput->m_integrals.clear();
       if (this->m_values.size() == 1) {
         // Special case for TSP with a single entry = just copy.
         myOutput->m_values = this->m_values;
@@ -464,8 +467,14 @@ void TimeSeriesProperty<TYPE>::splitByTime(
     }
 
     // Skip the events before the start of the time
-    while (i_property < m_values.size() && m_values[i_property].time() < start)
-      ++i_property;
+    i_property = static_cast<size_t>(
+        std::lower_bound(m_values.cbegin() + i_property, m_values.cend(),
+                         start,
+                         [](const TimeValueUnit<TYPE> &entry,
+                            const DateAndTime &time) {
+                           return entry.time() < time;
+                         }) -
+        m_values.cbegin());
 
     if (i_property == m_values.size()) {
       // i_property is out of the range. Then use the last entry
@@ -945,35 +954,21 @@ double TimeSeriesProperty<TYPE>::averageValueInFilter(
     return static_cast<double>(m_values.front().value());
   }
 
-  sortIfNecessary();
+  updateIntegrals();
 
   double numerator(0.0), totalTime(0.0);
   // Loop through the filter ranges
   for (const auto &time : filter) {
     // Calculate the total time duration (in seconds) within by the filter
     totalTime += time.duration();
-
-    // Get the log value and index at the start time of the filter
-    int index;
-    double value = getSingleValue(time.start(), index);
-    DateAndTime startTime = time.start();
-
-    while (index < realSize() - 1 && m_values[index + 1].time() < time.stop()) {
-      ++index;
-      numerator +=
-          DateAndTime::secondsFromDuration(m_values[index].time() - startTime) *
-          value;
-      startTime = m_values[index].time();
-      value = static_cast<double>(m_values[index].value());
-    }
-
-    // Now close off with the end of the current filter range
     numerator +=
-        DateAndTime::secondsFromDuration(time.stop() - startTime) * value;
+        integralsUpTo(time.stop()).first - integralsUpTo(time.start()).first;
   }
 
-  // 'Normalise' by the total time
-  return numerator / totalTime;
+  // 'Normalise' by the total time. The integrals are of the values less the
+  // first value so add that back on.
+  return static_cast<double>(m_values.front().value()) +
+         numerator / totalTime;
 }
 
 /** Function specialization for TimeSeriesProperty<std::string>
@@ -1015,36 +1010,24 @@ std::pair<double, double> TimeSeriesProperty<TYPE>::averageAndStdDevInFilter(
                                      std::numeric_limits<double>::quiet_NaN()};
   }
 
-  double numerator(0.0), totalTime(0.0);
+  updateIntegrals();
+
+  double sum(0.0), sumSquares(0.0), totalTime(0.0);
   // Loop through the filter ranges
   for (const auto &time : filter) {
     // Calculate the total time duration (in seconds) within by the filter
     totalTime += time.duration();
-
-    // Get the log value and index at the start time of the filter
-    int index;
-    double value = getSingleValue(time.start(), index);
-    double valuestddev = (value - mean) * (value - mean);
-    DateAndTime startTime = time.start();
-
-    while (index < realSize() - 1 && m_values[index + 1].time() < time.stop()) {
-      ++index;
-
-      numerator +=
-          DateAndTime::secondsFromDuration(m_values[index].time() - startTime) *
-          valuestddev;
-      startTime = m_values[index].time();
-      value = static_cast<double>(m_values[index].value());
-      valuestddev = (value - mean) * (value - mean);
-    }
-
-    // Now close off with the end of the current filter range
-    numerator +=
-        DateAndTime::secondsFromDuration(time.stop() - startTime) * valuestddev;
+    const auto start = integralsUpTo(time.start());
+    const auto stop = integralsUpTo(time.stop());
+    sum += stop.first - start.first;
+    sumSquares += stop.second - start.second;
   }
 
-  // Normalise by the total time
-  return std::pair<double, double>{mean, std::sqrt(numerator / totalTime)};
+  // Normalise by the total time. Subtracting the first value from every value
+  // keeps the rounding error of the difference small.
+  const double shiftedMean = sum / totalTime;
+  const double variance = sumSquares / totalTime - shiftedMean * shiftedMean;
+  return std::pair<double, double>{mean, std::sqrt(std::max(variance, 0.0))};
 }
 
 /** Function specialization for TimeSeriesProperty<std::string>
@@ -1059,6 +1042,83 @@ TimeSeriesProperty<std::string>::averageAndStdDevInFilter(
                                        "implemented for string properties");
 }
 
+/** Returns the time integrals of the value and of its square from the first
+ *  entry up to a time, with the first value subtracted from every value. Each
+ *  value holds until the time of the next entry, the first value holds before
+ *  the first entry and the last value after the last one.
+ *  updateIntegrals() must have been called first.
+ *  @param t :: The time to integrate up to
+ *  @return The integrals of the value and its square in value * seconds
+ */
+template <typename TYPE>
+std::pair<double, double>
+TimeSeriesProperty<TYPE>::integralsUpTo(const DateAndTime &t) const {
+  // The last entry at or before t
+  const auto next = std::upper_bound(
+      m_values.cbegin(), m_values.cend(), t,
+      [](const DateAndTime &time, const TimeValueUnit<TYPE> &entry) {
+        return time < entry.time();
+      });
+  const size_t index =
+      next == m_values.cbegin()
+          ? 0
+          : static_cast<size_t>(next - m_values.cbegin()) - 1;
+
+  const double seconds =
+      DateAndTime::secondsFromDuration(t - m_values[index].time());
+  const double value = static_cast<double>(m_values[index].value()) -
+                       static_cast<double>(m_values.front().value());
+  return std::make_pair(m_integrals[index].first + seconds * value,
+                        m_integrals[index].second + seconds * value * value);
+}
+
+/** Function specialization for TimeSeriesProperty<std::string>
+ *  @throws Kernel::Exception::NotImplementedError always
+ */
+template <>
+std::pair<double, double>
+TimeSeriesProperty<std::string>::integralsUpTo(const DateAndTime &) const {
+  throw Exception::NotImplementedError("TimeSeriesProperty::integralsUpTo is "
+                                       "not implemented for string "
+                                       "properties");
+}
+
+/** Sorts the values if necessary and calculates the running time integrals
+ *  for any entries that do not have them yet, so that the time-weighted
+ *  statistics of an interval can be found without a pass over the values.
+ */
+template <typename TYPE>
+void TimeSeriesProperty<TYPE>::updateIntegrals() const {
+  sortIfNecessary();
+  if (m_integrals.size() > m_values.size())
+    m_integrals.clear();
+  if (m_values.empty() || m_integrals.size() == m_values.size())
+    return;
+
+  const double firstValue = static_cast<double>(m_values.front().value());
+  m_integrals.reserve(m_values.size());
+  if (m_integrals.empty())
+    m_integrals.emplace_back(0.0, 0.0);
+  for (size_t i = m_integrals.size(); i < m_values.size(); ++i) {
+    const double seconds = DateAndTime::secondsFromDuration(
+        m_values[i].time() - m_values[i - 1].time());
+    const double value =
+        static_cast<double>(m_values[i - 1].value()) - firstValue;
+    const auto &previous = m_integrals.back();
+    m_integrals.emplace_back(previous.first + seconds * value,
+                             previous.second + seconds * value * value);
+  }
+}
+
+/** Function specialization for TimeSeriesProperty<std::string>
+ *  @throws Kernel::Exception::NotImplementedError always
+ */
+template <> void TimeSeriesProperty<std::string>::updateIntegrals() const {
+  throw Exception::NotImplementedError("TimeSeriesProperty::updateIntegrals "
+                                       "is not implemented for string "
+                                       "properties");
+}
+
 // Re-enable the warnings disabled before makeFilterByValue
 #ifdef _WIN32
 #pragma warning(pop)
@@ -1454,6 +1514,7 @@ TimeSeriesProperty<TYPE>::setDataItem(const boost::shared_ptr<DataItem>) {
 template <typename TYPE> void TimeSeriesProperty<TYPE>::clear() {
   m_size = 0;
   m_values.clear();
+  m_integrals.clear();
 
   m_propSortedFlag = TimeSeriesSortStatus::TSSORTED;
   m_filterApplied = false;
@@ -2051,6 +2112,7 @@ template <typename TYPE> void TimeSeriesProperty<TYPE>::eliminateDuplicates() {
 
   // update m_size
   countSize();
+  m_integrals.clear();
 
   // 3. Finish
   g_log.warning() << "Log " << this->name() << " has " << numremoved
@@ -2094,6 +2156,7 @@ void TimeSeriesProperty<TYPE>::sortIfNecessary() const {
         "TimeSeriesProperty is not sorted.  Sorting is operated on it. ");
     std::stable_sort(m_values.begin(), m_values.end());
     m_propSortedFlag = TimeSeriesSortStatus::TSSORTED;
+    m_integrals.clear();
   }
 }
 
@@ -2346,6 +2409,7 @@ TimeSeriesProperty<TYPE>::setValueFromProperty(const Property &right) {
   m_filter = prop->m_filter;
   m_filterQuickRef = prop->m_filterQuickRef;
   m_filterApplied = prop->m_filterApplied;
+  m_integrals = prop->m_integrals;
   return "";
 }
 
@@ -0,0 +1,197 @@
+#include "MantidKernel/TraceRecorder.h"
+#include "MantidKernel/ConfigService.h"
+#include "MantidKernel/Logger.h"
+
+#include <Poco/Process.h>
+
+#include <fstream>
+#include <ostream>
+#include <stdexcept>
+
+namespace Mantid {
+namespace Kernel {
+
+namespace {
+/// static logger
+Logger g_log("TraceRecorder");
+
+/// Source of the thread numbers written to the trace
+std::atomic<int> nextThread(0);
+
+/** Write a string as a JSON string literal
+ * @param out :: the stream to write to
+ * @param value :: the string to write
+ */
+void writeJSONString(std::ostream &out, const std::string &value) {
+  out << '"';
+  for (const char c : value) {
+    switch (c) {
+    case '"':
+      out << "\\\"";
+      break;
+    case '\\':
+      out << "\\\\";
+      break;
+    default:
+      if (static_cast<unsigned char>(c) < 0x20)
+        out << ' ';
+      else
+        out << c;
+    }
+  }
+  out << '"';
+}
+} // namespace
+
+//----------------------------------------------------------------------------------------------
+/** Start recording a region if recording is enabled
+ * @param name :: name of the region, e.g. the algorithm name
+ * @param category :: category of the region, e.g. "algorithm"
+ */
+TraceRecorderImpl::Scope::Scope(const std::string &name, const char *category)
+    : m_enabled(TraceRecorder::Instance().isEnabled()), m_category(category),
+      m_start(0) {
+  if (m_enabled) {
+    m_name = name;
+    m_start = TraceRecorder::Instance().now();
+  }
+}
+
+/** Start recording a region if recording is enabled. The name is only copied
+ * if recording is enabled.
+ * @param name :: name of the region, e.g. the task name
+ * @param category :: category of the region, e.g. "task"
+ */
+TraceRecorderImpl::Scope::Scope(const char *name, const char *category)
+    : m_enabled(TraceRecorder::Instance().isEnabled()), m_category(category),
+      m_start(0) {
+  if (m_enabled) {
+    m_name = name;
+    m_start = TraceRecorder::Instance().now();
+  }
+}
+
+/// Record the region, now that it has finished
+TraceRecorderImpl::Scope::~Scope() {
+  if (m_enabled) {
+    auto &recorder = TraceRecorder::Instance();
+    recorder.record(m_name, m_category, m_start, recorder.now() - m_start);
+  }
+}
+
+//----------------------------------------------------------------------------------------------
+/// Constructor. Recording starts if the tracing.filename key is set.
+TraceRecorderImpl::TraceRecorderImpl()
+    : m_enabled(false), m_origin(std::chrono::steady_clock::now()) {
+  auto filename =
+      ConfigService::Instance().getValue<std::string>("tracing.filename");
+  if (filename.is_initialized() && !filename.get().empty()) {
+    m_filename = filename.get();
+    g_log.notice() << "Recording a trace of algorithms and tasks to write to "
+                   << m_filename << " on exit\n";
+    setEnabled(true);
+  }
+}
+
+/// Destructor. Writes the trace file if shutdown() has not been called.
+TraceRecorderImpl::~TraceRecorderImpl() {
+  if (!isEnabled() || m_filename.empty())
+    return;
+  try {
+    writeFile(m_filename);
+  } catch (std::exception &) {
+    // Nowhere to report errors this late
+  }
+}
+
+/** Switch recording on or off. Events recorded so far are kept.
+ * @param enabled :: true to record regions
+ */
+void TraceRecorderImpl::setEnabled(const bool enabled) {
+  m_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+/** Record a finished region
+ * @param name :: name of the region
+ * @param category :: category of the region
+ * @param start :: start time as returned by now()
+ * @param duration :: duration in microseconds
+ */
+void TraceRecorderImpl::record(const std::string &name,
+                               const std::string &category,
+                               const int64_t start, const int64_t duration) {
+  Event event{name, category, start, duration, currentThread()};
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_events.push_back(std::move(event));
+}
+
+/// @return the time in microseconds since the recorder was created
+int64_t TraceRecorderImpl::now() const {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now() - m_origin)
+      .count();
+}
+
+/// @return a small number identifying the calling thread in the trace
+int TraceRecorderImpl::currentThread() {
+  thread_local const int thread = nextThread++;
+  return thread;
+}
+
+/// @return a copy of the events recorded so far
+std::vector<TraceRecorderImpl::Event> TraceRecorderImpl::events() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_events;
+}
+
+/// Discard the events recorded so far
+void TraceRecorderImpl::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_events.clear();
+}
+
+/** Write the events recorded so far in the Chrome trace event format
+ * @param out :: the stream to write to
+ */
+void TraceRecorderImpl::writeJSON(std::ostream &out) const {
+  const auto pid = Poco::Process::id();
+  const auto recorded = events();
+  out << "{\"traceEvents\":[";
+  for (size_t i = 0; i < recorded.size(); ++i) {
+    const auto &event = recorded[i];
+    out << (i == 0 ? "\n" : ",\n") << "{\"name\":";
+    writeJSONString(out, event.name);
+    out << ",\"cat\":";
+    writeJSONString(out, event.category);
+    out << ",\"ph\":\"X\",\"ts\":" << event.start
+        << ",\"dur\":" << event.duration << ",\"pid\":" << pid
+        << ",\"tid\":" << event.thread << '}';
+  }
+  out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+/** Write the events recorded so far to a file in the Chrome trace event format
+ * @param filename :: the file to write
+ */
+void TraceRecorderImpl::writeFile(const std::string &filename) const {
+  std::ofstream out(filename);
+  if (!out)
+    throw std::runtime_error("Unable to open trace file " + filename);
+  writeJSON(out);
+}
+
+/// Stop recording and write the file given by tracing.filename, if any
+void TraceRecorderImpl::shutdown() {
+  setEnabled(false);
+  if (m_filename.empty())
+    return;
+  try {
+    writeFile(m_filename);
+    g_log.notice() << "Trace written to " << m_filename << "\n";
+  } catch (std::exception &ex) {
+    g_log.error() << ex.what() << "\n";
+  }
+}
+
+} // namespace Kernel
+} // namespace Mantid
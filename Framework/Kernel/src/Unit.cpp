@@ -5,6 +5,7 @@
 #include "MantidKernel/PhysicalConstants.h"
 #include "MantidKernel/UnitFactory.h"
 #include "MantidKernel/UnitLabelTypes.h"
+#include <algorithm>
 #include <cfloat>
 
 namespace Mantid {
@@ -138,9 +139,7 @@ void Unit::toTOF(std::vector<double> &xdata, std::vector<double> &ydata,
                  const double &_delta) {
   UNUSED_ARG(ydata);
   this->initialize(_l1, _l2, _twoTheta, _emode, _efixed, _delta);
-  size_t numX = xdata.size();
-  for (size_t i = 0; i < numX; i++)
-    xdata[i] = this->singleToTOF(xdata[i]);
+  this->manyToTOF(xdata.data(), xdata.size());
 }
 
 /** Convert a single value to TOF
@@ -169,9 +168,7 @@ void Unit::fromTOF(std::vector<double> &xdata, std::vector<double> &ydata,
                    const double &_efixed, const double &_delta) {
   UNUSED_ARG(ydata);
   this->initialize(_l1, _l2, _twoTheta, _emode, _efixed, _delta);
-  size_t numX = xdata.size();
-  for (size_t i = 0; i < numX; i++)
-    xdata[i] = this->singleFromTOF(xdata[i]);
+  this->manyFromTOF(xdata.data(), xdata.size());
 }
 
 /** Convert a single value from TOF
@@ -198,6 +195,16 @@ std::pair<double, double> Unit::conversionRange() const {
   return std::pair<double, double>(std::min(u1, u2), std::max(u1, u2));
 }
 
+void Unit::manyToTOF(double *values, const size_t count) const {
+  for (size_t i = 0; i < count; ++i)
+    values[i] = this->singleToTOF(values[i]);
+}
+
+void Unit::manyFromTOF(double *values, const size_t count) const {
+  for (size_t i = 0; i < count; ++i)
+    values[i] = this->singleFromTOF(values[i]);
+}
+
 namespace Units {
 
 /* =============================================================================
@@ -287,6 +294,14 @@ double TOF::singleFromTOF(const double tof) const {
   return tof;
 }
 
+void TOF::manyToTOF(double *, const size_t) const {
+  // Nothing to do
+}
+
+void TOF::manyFromTOF(double *, const size_t) const {
+  // Nothing to do
+}
+
 Unit *TOF::clone() const { return new TOF(*this); }
 double TOF::conversionTOFMin() const { return -DBL_MAX; }
 ///@return DBL_MAX as ToF convetanble to TOF for in any time range
@@ -395,6 +410,24 @@ double Wavelength::singleFromTOF(const double tof) const {
   x *= factorFrom;
   return x;
 }
+void Wavelength::manyToTOF(double *values, const size_t count) const {
+  if (emode == 1 || emode == 2) {
+    for (size_t i = 0; i < count; ++i)
+      values[i] = values[i] * factorTo + sfpTo;
+  } else {
+    for (size_t i = 0; i < count; ++i)
+      values[i] *= factorTo;
+  }
+}
+void Wavelength::manyFromTOF(double *values, const size_t count) const {
+  if (do_sfpFrom) {
+    for (size_t i = 0; i < count; ++i)
+      values[i] = (values[i] - sfpFrom) * factorFrom;
+  } else {
+    for (size_t i = 0; i < count; ++i)
+      values[i] *= factorFrom;
+  }
+}
 ///@return  Minimal time of flight, which can be reversively converted into
 /// wavelength
 double Wavelength::conversionTOFMin() const {
@@ -471,6 +504,22 @@ double Energy::singleFromTOF(const double tof) const {
   return factorFrom / (temp * temp);
 }
 
+void Energy::manyToTOF(double *values, const size_t count) const {
+  for (size_t i = 0; i < count; ++i) {
+    // Protect against divide by zero
+    const double temp = values[i] == 0.0 ? DBL_MIN : values[i];
+    values[i] = factorTo / sqrt(temp);
+  }
+}
+
+void Energy::manyFromTOF(double *values, const size_t count) const {
+  for (size_t i = 0; i < count; ++i) {
+    // Protect against divide by zero
+    const double temp = values[i] == 0.0 ? DBL_MIN : values[i];
+    values[i] = factorFrom / (temp * temp);
+  }
+}
+
 Unit *Energy::clone() const { return new Energy(*this); }
 
 // ============================================================================================
@@ -577,6 +626,14 @@ double dSpacing::singleToTOF(const double x) const { return x * factorTo; }
 double dSpacing::singleFromTOF(const double tof) const {
   return tof / factorFrom;
 }
+void dSpacing::manyToTOF(double *values, const size_t count) const {
+  for (size_t i = 0; i < count; ++i)
+    values[i] *= factorTo;
+}
+void dSpacing::manyFromTOF(double *values, const size_t count) const {
+  for (size_t i = 0; i < count; ++i)
+    values[i] /= factorFrom;
+}
 double dSpacing::conversionTOFMin() const { return 0; }
 double dSpacing::conversionTOFMax() const { return DBL_MAX / factorTo; }
 
@@ -688,6 +745,22 @@ double MomentumTransfer::singleFromTOF(const double tof) const {
   return factorFrom / temp;
 }
 
+void MomentumTransfer::manyToTOF(double *values, const size_t count) const {
+  for (size_t i = 0; i < count; ++i) {
+    // Protect against divide by zero
+    const double temp = values[i] == 0.0 ? DBL_MIN : values[i];
+    values[i] = factorTo / temp;
+  }
+}
+
+void MomentumTransfer::manyFromTOF(double *values, const size_t count) const {
+  for (size_t i = 0; i < count; ++i) {
+    // Protect against divide by zero
+    const double temp = values[i] == 0.0 ? DBL_MIN : values[i];
+    values[i] = factorFrom / temp;
+  }
+}
+
 double MomentumTransfer::conversionTOFMin() const {
   return factorFrom / DBL_MAX;
 }
@@ -861,6 +934,46 @@ double DeltaE::singleFromTOF(const double tof) const {
     return DBL_MAX;
 }
 
+void DeltaE::manyToTOF(double *values, const size_t count) const {
+  // Returned where the efixed value is wrong for the energy transfer
+  const double invalid = DeltaE::conversionTOFMax();
+  if (emode == 1) {
+    for (size_t i = 0; i < count; ++i) {
+      const double e2 = efixed - values[i] / unitScaling;
+      values[i] = e2 <= 0.0 ? invalid : factorTo / sqrt(e2) + t_other;
+    }
+  } else if (emode == 2) {
+    for (size_t i = 0; i < count; ++i) {
+      const double e1 = efixed + values[i] / unitScaling;
+      values[i] = e1 <= 0.0 ? invalid : factorTo / sqrt(e1) + t_other;
+    }
+  } else {
+    std::fill(values, values + count, invalid);
+  }
+}
+
+void DeltaE::manyFromTOF(double *values, const size_t count) const {
+  if (emode == 1) {
+    for (size_t i = 0; i < count; ++i) {
+      // This is t2
+      const double this_t = values[i] - t_otherFrom;
+      values[i] = this_t <= 0.0
+                      ? -DBL_MAX
+                      : (efixed - factorFrom / (this_t * this_t)) * unitScaling;
+    }
+  } else if (emode == 2) {
+    for (size_t i = 0; i < count; ++i) {
+      // This is t1
+      const double this_t = values[i] - t_otherFrom;
+      values[i] = this_t <= 0.0
+                      ? DBL_MAX
+                      : (factorFrom / (this_t * this_t) - efixed) * unitScaling;
+    }
+  } else {
+    std::fill(values, values + count, DBL_MAX);
+  }
+}
+
 double DeltaE::conversionTOFMin() const {
   double time(
       DBL_MAX); // impossible for elastic, this units do not work for elastic
@@ -1116,6 +1229,14 @@ double SpinEchoLength::singleFromTOF(const double tof) const {
 
 Unit *SpinEchoLength::clone() const { return new SpinEchoLength(*this); }
 
+// The Wavelength conversions do not apply to spin echo units
+void SpinEchoLength::manyToTOF(double *values, const size_t count) const {
+  Unit::manyToTOF(values, count);
+}
+void SpinEchoLength::manyFromTOF(double *values, const size_t count) const {
+  Unit::manyFromTOF(values, count);
+}
+
 // ============================================================================================
 /* SpinEchoTime
  * ===================================================================================================
@@ -1161,6 +1282,14 @@ double SpinEchoTime::singleFromTOF(const double tof) const {
 
 Unit *SpinEchoTime::clone() const { return new SpinEchoTime(*this); }
 
+// The Wavelength conversions do not apply to spin echo units
+void SpinEchoTime::manyToTOF(double *values, const size_t count) const {
+  Unit::manyToTOF(values, count);
+}
+void SpinEchoTime::manyFromTOF(double *values, const size_t count) const {
+  Unit::manyFromTOF(values, count);
+}
+
 // ================================================================================
 /* Time
  * ================================================================================
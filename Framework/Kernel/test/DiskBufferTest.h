@@ -14,6 +14,9 @@
 #include <boost/multi_index_container.hpp>
 #include <cxxtest/TestSuite.h>
 
+#include <chrono>
+#include <thread>
+
 using namespace Mantid;
 using namespace Mantid::Kernel;
 using Mantid::Kernel::CPUTimer;
@@ -265,6 +268,129 @@ public:
     for (size_t i = 0; i < size_t(bigNum); i++)
       delete bigData[i];
   }
+  //--------------------------------------------------------------------------------
+  /** The I/O thread writes out the buffer when it is full */
+  void test_ioThread_writes_out_buffer() {
+    for (auto &i : data) {
+      i->setDataChanged();
+    }
+    // Room for 2 objects of size 2 in the to-write cache
+    DiskBuffer dbuf(2 * 2);
+    dbuf.startIOThread();
+    TS_ASSERT(dbuf.hasIOThread());
+    dbuf.toWrite(data[5]);
+    dbuf.toWrite(data[1]);
+    dbuf.toWrite(data[9]);
+    // Finishes the write that was requested
+    dbuf.stopIOThread();
+    TS_ASSERT(!dbuf.hasIOThread());
+    TS_ASSERT_EQUALS(dbuf.getWriteBufferUsed(), 0);
+    TS_ASSERT_EQUALS(SaveableTesterWithFile::fakeFile, "  BB      FF      JJ");
+  }
+
+  /** Busy objects stay in the buffer until flushed */
+  void test_ioThread_flushCache_writes_the_rest() {
+    DiskBuffer dbuf(2 * 2);
+    dbuf.startIOThread();
+    data[3]->setBusy(true);
+    for (size_t i = 0; i < 5; i++) {
+      data[i]->setDataChanged();
+      dbuf.toWrite(data[i]);
+    }
+    data[3]->setBusy(false);
+    dbuf.flushCache();
+    TS_ASSERT_EQUALS(dbuf.getWriteBufferUsed(), 0);
+    TS_ASSERT_EQUALS(SaveableTesterWithFile::fakeFile, "AABBCCDDEE");
+  }
+
+  /** Waiting for the I/O thread returns once the requested write is done */
+  void test_ioThread_waitForIOThread() {
+    for (auto &i : data) {
+      i->setDataChanged();
+    }
+    DiskBuffer dbuf(2 * 2);
+    dbuf.waitForIOThread();
+    dbuf.startIOThread();
+    dbuf.toWrite(data[5]);
+    dbuf.toWrite(data[1]);
+    dbuf.toWrite(data[9]);
+    dbuf.waitForIOThread();
+    TS_ASSERT_EQUALS(dbuf.getWriteBufferUsed(), 0);
+    TS_ASSERT_EQUALS(SaveableTesterWithFile::fakeFile, "  BB      FF      JJ");
+    dbuf.stopIOThread();
+  }
+
+  /** Producers wait for the I/O thread rather than filling the buffer */
+  void test_ioThread_limits_the_buffer_size() {
+    for (auto &i : data) {
+      i->setDataChanged();
+    }
+    DiskBuffer dbuf(2);
+    dbuf.startIOThread();
+    for (auto &i : data) {
+      dbuf.toWrite(i);
+      TS_ASSERT_LESS_THAN_EQUALS(dbuf.getWriteBufferUsed(), 4);
+    }
+    dbuf.flushCache();
+    dbuf.stopIOThread();
+    TS_ASSERT_EQUALS(dbuf.getWriteBufferUsed(), 0);
+    TS_ASSERT_EQUALS(SaveableTesterWithFile::fakeFile, "AABBCCDDEEFFGGHHIIJJ");
+  }
+
+  /** Objects are loaded by the I/O thread and then put in the buffer */
+  void test_ioThread_prefetch() {
+    DiskBuffer dbuf(100);
+    SaveableTesterWithFile *item = data[0];
+    item->clearDataFromMemory();
+    TS_ASSERT(!item->isLoaded());
+    // Nothing happens without the thread
+    dbuf.prefetch(item);
+    TS_ASSERT(!item->isLoaded());
+
+    dbuf.startIOThread();
+    dbuf.prefetch(item);
+    for (int i = 0; i < 1000 && !item->isLoaded(); ++i)
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    dbuf.stopIOThread();
+    TS_ASSERT(item->isLoaded());
+    TS_ASSERT_EQUALS(item->getDataMemorySize(), 2);
+    TS_ASSERT_EQUALS(dbuf.getWriteBufferUsed(), 2);
+    dbuf.objectDeleted(item);
+    TS_ASSERT_EQUALS(dbuf.getWriteBufferUsed(), 0);
+  }
+
+  /** Objects can be deleted while the I/O thread is writing */
+  void test_ioThread_thread_safety() {
+    DiskBuffer dbuf(3);
+    dbuf.startIOThread();
+    size_t bigNum = 1000;
+    std::vector<ISaveable *> bigData;
+    bigData.reserve(bigNum);
+    for (size_t i = 0; i < bigNum; i++)
+      bigData.push_back(new SaveableTesterWithFile(2 * i, 2, char(i + 0x41)));
+
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < int(bigNum); i++) {
+      dbuf.toWrite(bigData[i]);
+      if (i % 2 == 0) {
+        dbuf.prefetch(bigData[i]);
+      } else {
+        dbuf.objectDeleted(bigData[i]);
+        delete bigData[i];
+        bigData[i] = nullptr;
+      }
+    }
+    dbuf.flushCache();
+    TS_ASSERT_EQUALS(dbuf.getWriteBufferUsed(), 0);
+    dbuf.stopIOThread();
+    for (size_t i = 0; i < size_t(bigNum); i++) {
+      if (bigData[i]) {
+        dbuf.objectDeleted(bigData[i]);
+        delete bigData[i];
+      }
+    }
+  }
+
   ////--------------------------------------------------------------------------------
   ////--------------------------------------------------------------------------------
   ////----------TESTS FOR FREE SPACE MAPS
@@ -0,0 +1,73 @@
+#ifndef MANTID_KERNEL_PERTHREADTEST_H_
+#define MANTID_KERNEL_PERTHREADTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/PerThread.h"
+
+#include <algorithm>
+#include <set>
+
+using Mantid::Kernel::AddElementwise;
+using Mantid::Kernel::InsertAll;
+using Mantid::Kernel::PerThread;
+
+class PerThreadTest : public CxxTest::TestSuite {
+public:
+  void test_one_copy_per_thread() {
+    PerThread<int> values(3);
+    TS_ASSERT_EQUALS(values.size(),
+                     static_cast<size_t>(PARALLEL_GET_MAX_THREADS));
+    for (const auto value : values)
+      TS_ASSERT_EQUALS(value, 3);
+  }
+
+  void test_histogram_in_parallel_loop() {
+    const int numBins = 10;
+    const int numValues = 100000;
+    PerThread<std::vector<double>> counts(std::vector<double>(numBins, 0.0));
+
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < numValues; ++i) {
+      auto &localCounts = counts.local();
+      localCounts[i % numBins] += 1.0;
+    }
+
+    const auto &total = counts.reduce(AddElementwise());
+    TS_ASSERT_EQUALS(counts.size(), 1);
+    TS_ASSERT_EQUALS(total.size(), numBins);
+    for (const auto count : total)
+      TS_ASSERT_EQUALS(count, numValues / numBins);
+  }
+
+  void test_set_in_parallel_loop() {
+    PerThread<std::set<int>> ids;
+
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < 1000; ++i)
+      ids.local().insert(i % 100);
+
+    const auto &total = ids.reduce(InsertAll());
+    TS_ASSERT_EQUALS(total.size(), 100);
+    TS_ASSERT_EQUALS(*total.begin(), 0);
+    TS_ASSERT_EQUALS(*total.rbegin(), 99);
+  }
+
+  void test_reduce_with_custom_operation() {
+    PerThread<double> maximum(0.0);
+
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < 1000; ++i) {
+      auto &localMax = maximum.local();
+      localMax = std::max(localMax, static_cast<double>(i));
+    }
+
+    const double total =
+        maximum.reduce([](double &result, const double value) {
+          result = std::max(result, value);
+        });
+    TS_ASSERT_EQUALS(total, 999.0);
+  }
+};
+
+#endif /* MANTID_KERNEL_PERTHREADTEST_H_ */
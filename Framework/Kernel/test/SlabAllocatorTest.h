@@ -0,0 +1,90 @@
+#ifndef MANTID_KERNEL_SLABALLOCATORTEST_H_
+#define MANTID_KERNEL_SLABALLOCATORTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/SlabAllocator.h"
+
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <vector>
+
+using Mantid::Kernel::SlabAllocator;
+
+class SlabAllocatorTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static SlabAllocatorTest *createSuite() { return new SlabAllocatorTest(); }
+  static void destroySuite(SlabAllocatorTest *suite) { delete suite; }
+
+  void test_blocks_are_distinct_and_aligned() {
+    auto allocator = new SlabAllocator(1024);
+    std::set<char *> blocks;
+    for (size_t i = 0; i < 100; ++i) {
+      auto block = static_cast<char *>(allocator->allocate(40));
+      TS_ASSERT_EQUALS(reinterpret_cast<uintptr_t>(block) % 16, 0);
+      std::memset(block, static_cast<int>(i), 40);
+      blocks.insert(block);
+    }
+    TS_ASSERT_EQUALS(blocks.size(), 100);
+    TS_ASSERT_EQUALS(allocator->numBlocksInUse(), 100);
+    // 100 blocks of 64 bytes including the header, 16 to a slab
+    TS_ASSERT_EQUALS(allocator->numBytesReserved(), 7 * 1024);
+    for (auto block : blocks)
+      SlabAllocator::deallocate(block);
+    TS_ASSERT_EQUALS(allocator->numBlocksInUse(), 0);
+    allocator->release();
+  }
+
+  void test_freed_blocks_are_reused() {
+    auto allocator = new SlabAllocator();
+    void *first = allocator->allocate(100);
+    SlabAllocator::deallocate(first);
+    TS_ASSERT_EQUALS(allocator->allocate(100), first);
+    // Blocks of a different size come from a different pool
+    TS_ASSERT_DIFFERS(allocator->allocate(200), first);
+    TS_ASSERT_EQUALS(allocator->numBlocksInUse(), 2);
+    // Releasing with blocks in use frees the slabs with the last block
+    allocator->release();
+  }
+
+  void test_blocks_outlive_release() {
+    auto allocator = new SlabAllocator();
+    auto block = static_cast<int *>(allocator->allocate(sizeof(int)));
+    allocator->release();
+    *block = 42;
+    TS_ASSERT_EQUALS(*block, 42);
+    SlabAllocator::deallocate(block);
+  }
+
+  void test_unpooled_blocks() {
+    auto block = static_cast<double *>(SlabAllocator::allocateUnpooled(80));
+    block[9] = 1.0;
+    SlabAllocator::deallocate(block);
+    SlabAllocator::deallocate(nullptr);
+  }
+
+  void test_threads() {
+    auto allocator = new SlabAllocator(4096);
+    const int numBlocks = 10000;
+    std::vector<void *> blocks(numBlocks);
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < numBlocks; ++i) {
+      blocks[i] = allocator->allocate(24 + 16 * (i % 3));
+    }
+    TS_ASSERT_EQUALS(allocator->numBlocksInUse(), numBlocks);
+    TS_ASSERT_EQUALS(std::set<void *>(blocks.begin(), blocks.end()).size(),
+                     numBlocks);
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < numBlocks; ++i) {
+      SlabAllocator::deallocate(blocks[i]);
+    }
+    TS_ASSERT_EQUALS(allocator->numBlocksInUse(), 0);
+    allocator->release();
+  }
+};
+
+#endif /* MANTID_KERNEL_SLABALLOCATORTEST_H_ */
@@ -118,6 +118,40 @@ public:
     delete task7;
   }
 
+  void test_queue_without_popping_busy_mutex_tasks() {
+    ThreadSchedulerMutexes sc(false);
+    auto mut1 = boost::make_shared<std::mutex>();
+    TaskWithMutex *task1 = new TaskWithMutex(mut1, 10.0);
+    TaskWithMutex *task2 = new TaskWithMutex(mut1, 9.0);
+    TaskWithMutex *task3 =
+        new TaskWithMutex(boost::shared_ptr<std::mutex>(), 1.0);
+    sc.push(task1);
+    sc.push(task2);
+
+    // Run the first task. mut1 becomes busy
+    Task *task = sc.pop(0);
+    TS_ASSERT_EQUALS(task, task1);
+
+    // task2 cannot run until mut1 is released
+    task = sc.pop(0);
+    TS_ASSERT(!task);
+    TS_ASSERT_EQUALS(sc.size(), 1);
+
+    // Tasks without a mutex are still handed out
+    sc.push(task3);
+    task = sc.pop(0);
+    TS_ASSERT_EQUALS(task, task3);
+
+    sc.finished(task1, 0);
+    task = sc.pop(0);
+    TS_ASSERT_EQUALS(task, task2);
+    TS_ASSERT_EQUALS(sc.size(), 0);
+
+    delete task1;
+    delete task2;
+    delete task3;
+  }
+
   void test_clear() {
     ThreadSchedulerMutexes sc;
     for (size_t i = 0; i < 10; i++) {
@@ -0,0 +1,112 @@
+#ifndef MANTID_KERNEL_THREADSCHEDULERWORKSTEALINGTEST_H_
+#define MANTID_KERNEL_THREADSCHEDULERWORKSTEALINGTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
+
+using namespace Mantid::Kernel;
+
+int ThreadSchedulerWorkStealingTest_numDestructed;
+
+class ThreadSchedulerWorkStealingTest : public CxxTest::TestSuite {
+public:
+  class TaskDoNothing : public Task {
+  public:
+    ~TaskDoNothing() override {
+      // To keep track of proper deleting of Task pointers
+      ThreadSchedulerWorkStealingTest_numDestructed++;
+    }
+    void run() override {}
+  };
+
+  /** Task that pushes another task to the scheduler */
+  class TaskThatPushes : public Task {
+  public:
+    TaskThatPushes(ThreadScheduler &scheduler, Task *child)
+        : m_scheduler(scheduler), m_child(child) {}
+    void run() override { m_scheduler.push(m_child); }
+
+  private:
+    ThreadScheduler &m_scheduler;
+    Task *m_child;
+  };
+
+  void test_push_and_size() {
+    ThreadSchedulerWorkStealing sc(2);
+    TS_ASSERT(sc.empty());
+    sc.push(new TaskDoNothing());
+    sc.push(new TaskDoNothing());
+    sc.push(new TaskDoNothing());
+    TS_ASSERT_EQUALS(sc.size(), 3);
+    TS_ASSERT(!sc.empty());
+  }
+
+  void test_pop_from_own_queue_takes_newest_task() {
+    ThreadSchedulerWorkStealing sc(1);
+    TaskDoNothing task1, task2, task3;
+    sc.push(&task1);
+    sc.push(&task2);
+    sc.push(&task3);
+    TS_ASSERT_EQUALS(sc.pop(0), &task3);
+    TS_ASSERT_EQUALS(sc.pop(0), &task2);
+    TS_ASSERT_EQUALS(sc.pop(0), &task1);
+    TS_ASSERT(!sc.pop(0));
+    TS_ASSERT(sc.empty());
+    TS_ASSERT_EQUALS(sc.numberOfSteals(), 0);
+    TS_ASSERT_EQUALS(sc.numberOfIdlePops(), 1);
+  }
+
+  void test_pop_steals_oldest_task_of_other_thread() {
+    ThreadSchedulerWorkStealing sc(2);
+    TaskDoNothing task1, task2, task3;
+    // Tasks pushed from outside are spread over the queues in turn, so
+    // thread 0 gets task1 and task3, thread 1 gets task2.
+    sc.push(&task1);
+    sc.push(&task2);
+    sc.push(&task3);
+    TS_ASSERT_EQUALS(sc.pop(1), &task2);
+    TS_ASSERT_EQUALS(sc.numberOfSteals(), 0);
+    // Thread 1's queue is empty: it steals the oldest task of thread 0
+    TS_ASSERT_EQUALS(sc.pop(1), &task1);
+    TS_ASSERT_EQUALS(sc.numberOfSteals(), 1);
+    TS_ASSERT_EQUALS(sc.pop(0), &task3);
+    TS_ASSERT(sc.empty());
+  }
+
+  void test_task_pushed_while_running_goes_to_own_queue() {
+    ThreadSchedulerWorkStealing sc(2);
+    TaskDoNothing child, other;
+    TaskThatPushes parent(sc, &child);
+    sc.push(&parent);
+    sc.push(&other);
+    Task *task = sc.pop(0);
+    TS_ASSERT_EQUALS(task, &parent);
+    task->run();
+    // The child was added to thread 0's queue and not thread 1's
+    TS_ASSERT_EQUALS(sc.pop(0), &child);
+    TS_ASSERT_EQUALS(sc.pop(1), &other);
+    TS_ASSERT_EQUALS(sc.numberOfSteals(), 0);
+  }
+
+  void test_threadnum_beyond_number_of_queues() {
+    ThreadSchedulerWorkStealing sc(2);
+    TaskDoNothing task1;
+    sc.push(&task1);
+    TS_ASSERT_EQUALS(sc.pop(5), &task1);
+  }
+
+  void test_clear_deletes_tasks() {
+    ThreadSchedulerWorkStealing sc(3);
+    for (size_t i = 0; i < 10; i++)
+      sc.push(new TaskDoNothing());
+    TS_ASSERT_EQUALS(sc.size(), 10);
+    ThreadSchedulerWorkStealingTest_numDestructed = 0;
+    sc.clear();
+    TS_ASSERT_EQUALS(sc.size(), 0);
+    TS_ASSERT(sc.empty());
+    TS_ASSERT_EQUALS(ThreadSchedulerWorkStealingTest_numDestructed, 10);
+  }
+};
+
+#endif /* MANTID_KERNEL_THREADSCHEDULERWORKSTEALINGTEST_H_ */
@@ -624,6 +624,53 @@ public:
     delete intLog;
   }
 
+  void test_averageValueInFilter_follows_changes_to_the_values() {
+    auto dblLog = createDoubleTSP();
+    TimeSplitterType filter{
+        SplittingInterval(DateAndTime("2007-11-30T16:17:00"),
+                          DateAndTime("2007-11-30T16:17:50"))};
+    TS_ASSERT_DELTA(dblLog->averageValueInFilter(filter), 8.838, 1e-4);
+
+    // Appended in time order
+    dblLog->addValue("2007-11-30T16:17:40", 1.0);
+    TS_ASSERT_DELTA(dblLog->averageValueInFilter(filter), 6.928, 1e-4);
+
+    // Out of time order
+    dblLog->addValue("2007-11-30T16:17:05", 0.0);
+    TS_ASSERT_DELTA(dblLog->averageValueInFilter(filter), 5.929, 1e-4);
+
+    dblLog->clear();
+    dblLog->addValue("2007-11-30T16:17:00", 2.0);
+    dblLog->addValue("2007-11-30T16:17:25", 4.0);
+    TS_ASSERT_DELTA(dblLog->averageValueInFilter(filter), 3.0, 1e-4);
+
+    delete dblLog;
+  }
+
+  void test_averageAndStdDevInFilter_with_large_values() {
+    TimeSeriesProperty<double> log("LargeValues");
+    DateAndTime time("2007-11-30T16:17:00");
+    for (size_t i = 0; i < 100000; ++i) {
+      log.addValue(time, i % 2 == 0 ? 1e6 + 1.0 : 1e6 - 1.0);
+      time += 0.001;
+    }
+    TimeSplitterType filter{SplittingInterval(log.firstTime(), time)};
+
+    const auto meanAndStdDev = log.averageAndStdDevInFilter(filter);
+    TS_ASSERT_DELTA(meanAndStdDev.first, 1e6, 1e-6);
+    TS_ASSERT_DELTA(meanAndStdDev.second, 1.0, 1e-6);
+
+    // Only the first millisecond of each pair, which has the larger value
+    filter.clear();
+    for (size_t i = 0; i < 100000; i += 2) {
+      const DateAndTime start = log.nthTime(static_cast<int>(i));
+      filter.emplace_back(start, start + 0.001);
+    }
+    const auto firstOfEachPair = log.averageAndStdDevInFilter(filter);
+    TS_ASSERT_DELTA(firstOfEachPair.first, 1e6 + 1.0, 1e-6);
+    TS_ASSERT_DELTA(firstOfEachPair.second, 0.0, 1e-6);
+  }
+
   void test_averageValueInFilter_throws_for_string_property() {
     TimeSplitterType splitter;
     TS_ASSERT_THROWS(sProp->averageValueInFilter(splitter),
@@ -0,0 +1,101 @@
+#ifndef MANTID_KERNEL_TRACERECORDERTEST_H_
+#define MANTID_KERNEL_TRACERECORDERTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/FunctionTask.h"
+#include "MantidKernel/ThreadPool.h"
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
+#include "MantidKernel/TraceRecorder.h"
+
+#include <json/json.h>
+#include <sstream>
+
+using Mantid::Kernel::FunctionTask;
+using Mantid::Kernel::ThreadPool;
+using Mantid::Kernel::ThreadSchedulerWorkStealing;
+using Mantid::Kernel::TraceRecorder;
+using Mantid::Kernel::TraceRecorderImpl;
+
+namespace {
+void doNothing() {}
+} // namespace
+
+class TraceRecorderTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static TraceRecorderTest *createSuite() { return new TraceRecorderTest(); }
+  static void destroySuite(TraceRecorderTest *suite) { delete suite; }
+
+  void setUp() override {
+    TraceRecorder::Instance().clear();
+    TraceRecorder::Instance().setEnabled(true);
+  }
+
+  void tearDown() override {
+    TraceRecorder::Instance().setEnabled(false);
+    TraceRecorder::Instance().clear();
+  }
+
+  void test_nothing_is_recorded_when_disabled() {
+    TraceRecorder::Instance().setEnabled(false);
+    { TraceRecorderImpl::Scope scope("Ignored", "test"); }
+    TS_ASSERT(TraceRecorder::Instance().events().empty());
+  }
+
+  void test_nested_scopes() {
+    {
+      TraceRecorderImpl::Scope outer("Outer", "algorithm");
+      TraceRecorderImpl::Scope inner(std::string("Inner"), "child algorithm");
+    }
+    const auto events = TraceRecorder::Instance().events();
+    TS_ASSERT_EQUALS(events.size(), 2);
+    // The inner scope finishes first
+    TS_ASSERT_EQUALS(events[0].name, "Inner");
+    TS_ASSERT_EQUALS(events[0].category, "child algorithm");
+    TS_ASSERT_EQUALS(events[1].name, "Outer");
+    TS_ASSERT_EQUALS(events[1].category, "algorithm");
+    TS_ASSERT_EQUALS(events[0].thread, events[1].thread);
+    TS_ASSERT_LESS_THAN_EQUALS(events[1].start, events[0].start);
+    TS_ASSERT_LESS_THAN_EQUALS(events[0].start + events[0].duration,
+                               events[1].start + events[1].duration);
+  }
+
+  void test_thread_pool_tasks_are_recorded() {
+    ThreadPool pool(new ThreadSchedulerWorkStealing(2), 2);
+    for (int i = 0; i < 10; ++i)
+      pool.schedule(new FunctionTask(doNothing));
+    pool.joinAll();
+
+    const auto events = TraceRecorder::Instance().events();
+    TS_ASSERT_EQUALS(events.size(), 10);
+    for (const auto &event : events) {
+      TS_ASSERT_EQUALS(event.name, "Task");
+      TS_ASSERT_EQUALS(event.category, "task");
+      TS_ASSERT_DIFFERS(event.thread, TraceRecorderImpl::currentThread());
+    }
+  }
+
+  void test_writeJSON_writes_chrome_trace_events() {
+    { TraceRecorderImpl::Scope scope("Load \"file\"", "algorithm"); }
+    std::ostringstream out;
+    TraceRecorder::Instance().writeJSON(out);
+
+    Json::Value root;
+    Json::Reader reader;
+    TS_ASSERT(reader.parse(out.str(), root));
+    const auto &traceEvents = root["traceEvents"];
+    TS_ASSERT_EQUALS(traceEvents.size(), 1);
+    const auto &event = traceEvents[0];
+    TS_ASSERT_EQUALS(event["name"].asString(), "Load \"file\"");
+    TS_ASSERT_EQUALS(event["cat"].asString(), "algorithm");
+    TS_ASSERT_EQUALS(event["ph"].asString(), "X");
+    TS_ASSERT(event.isMember("ts"));
+    TS_ASSERT(event.isMember("dur"));
+    TS_ASSERT(event.isMember("pid"));
+    TS_ASSERT_EQUALS(event["tid"].asInt(), TraceRecorderImpl::currentThread());
+  }
+};
+
+#endif /* MANTID_KERNEL_TRACERECORDERTEST_H_ */
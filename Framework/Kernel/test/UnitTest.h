@@ -240,6 +240,30 @@ public:
     delete unit;
   }
 
+  void test_many_conversions_match_single_conversions() {
+    std::vector<Unit *> units{&tof, &lambda, &energy, &d, &q,
+                              &dE,  &dEk,    &dEf,    &delta};
+    const std::vector<double> values{0.0, 0.25, 0.5, 1.0, 3.7, 100.0, 2.5e4};
+    for (int emode = 0; emode <= 2; ++emode) {
+      for (auto unit : units) {
+        const bool isDeltaE = unit->unitID().find("DeltaE") == 0;
+        if ((isDeltaE && emode == 0) || (unit == &delta && emode != 0))
+          continue;
+        unit->initialize(10.0, 1.5, 0.6, emode, 25.0, 0.0);
+        auto toTOF = values;
+        unit->manyToTOF(toTOF.data(), toTOF.size());
+        auto fromTOF = values;
+        unit->manyFromTOF(fromTOF.data(), fromTOF.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+          TSM_ASSERT_EQUALS(unit->unitID(), toTOF[i],
+                            unit->singleToTOF(values[i]));
+          TSM_ASSERT_EQUALS(unit->unitID(), fromTOF[i],
+                            unit->singleFromTOF(values[i]));
+        }
+      }
+    }
+  }
+
   //----------------------------------------------------------------------
   // TOF tests
   //----------------------------------------------------------------------
@@ -5,9 +5,12 @@
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidLiveData/Kafka/IKafkaBroker.h"
 #include "MantidLiveData/Kafka/IKafkaStreamSubscriber.h"
+#include "MantidTypes/Event/TofEvent.h"
 
 #include <atomic>
 #include <condition_variable>
+#include <deque>
+#include <exception>
 #include <mutex>
 #include <thread>
 
@@ -19,7 +22,9 @@ namespace LiveData {
   3 topic names of the data streams.
 
   A call to capture() starts the process of capturing the stream on a separate
-  thread.
+  thread. The event messages are decoded on a pool of decoder threads, each
+  appending the events to its own partial buffer. The partial buffers are added
+  to the buffer workspaces when the data are extracted.
 
   Copyright &copy; 2016 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
   National Laboratory & European Spallation Source
@@ -93,6 +98,14 @@ private:
     size_t nPeriods;
     int64_t runStartMsgOffset;
   };
+  /// Data decoded by one decoder thread and not yet added to the buffers
+  struct PartialBuffer {
+    /// Events for each period and workspace index
+    std::vector<std::vector<std::vector<Types::Event::TofEvent>>> events;
+    /// Proton charge values for each period
+    std::vector<std::vector<std::pair<Types::Core::DateAndTime, double>>>
+        protonCharge;
+  };
   /// Main loop of listening for data messages and populating the cache
   /// workspaces
   void captureImpl() noexcept;
@@ -119,9 +132,21 @@ private:
   RunStartStruct getRunStartMessage(std::string &rawMsgBuffer);
 
   /// Populate cache workspaces with data from messages
-  void eventDataFromMessage(const std::string &buffer);
+  void eventDataFromMessage(const std::string &buffer,
+                            PartialBuffer &partialBuffer);
   void sampleDataFromMessage(const std::string &buffer);
 
+  ///@name Decoding of event messages on the decoder threads
+  ///@{
+  void startDecoding();
+  void stopDecoding() noexcept;
+  void decodeImpl(PartialBuffer &partialBuffer) noexcept;
+  void queueEventMessage(std::string &buffer);
+  void waitForDecoding(std::unique_lock<std::mutex> &decodeLock);
+  void resetPartialBuffers(size_t nperiods, size_t nspectra);
+  void mergePartialBuffers();
+  ///@}
+
   /// For LoadLiveData to extract the cached data
   API::Workspace_sptr extractDataImpl();
 
@@ -189,6 +214,25 @@ private:
       const std::unordered_map<std::string, std::vector<bool>> &reachedEnd,
       bool &checkOffsets);
 
+  /// Threads decoding the event messages
+  std::vector<std::thread> m_decoderThreads;
+  /// Decoded data of each decoder thread
+  std::vector<PartialBuffer> m_partialBuffers;
+  /// Event messages waiting to be decoded
+  std::deque<std::string> m_eventMessages;
+  /// Number of messages being decoded right now
+  size_t m_nDecoding;
+  /// Flag telling the decoder threads to finish
+  bool m_stopDecoding;
+  /// The first error raised by a decoder thread
+  std::exception_ptr m_decodingError;
+  /// Mutex protecting the message queue and the decoder state
+  std::mutex m_decodeMutex;
+  /// Notifies the decoder threads of new messages
+  std::condition_variable m_cvDecode;
+  /// Notifies that messages have been taken or decoded
+  std::condition_variable m_cvDecoded;
+
   /// Callbacks for unit tests
   CallbackFn m_cbIterationEnd;
   CallbackFn m_cbError;
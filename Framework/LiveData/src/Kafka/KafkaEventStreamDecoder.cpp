@@ -4,8 +4,10 @@
 #include "MantidAPI/Run.h"
 #include "MantidAPI/WorkspaceFactory.h"
 #include "MantidAPI/WorkspaceGroup.h"
+#include "MantidKernel/ConfigService.h"
 #include "MantidKernel/DateAndTimeHelpers.h"
 #include "MantidKernel/Logger.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/OptionalBool.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 #include "MantidKernel/UnitFactory.h"
@@ -39,6 +41,24 @@ const std::string SAMPLE_MESSAGE_ID = "f142";
 
 const std::chrono::seconds MAX_LATENCY(1);
 
+/// The most threads used to decode event messages, unless more cores are
+/// configured
+const size_t MAX_DECODER_THREADS = 8;
+/// The most event messages waiting to be decoded before capture waits
+const size_t MAX_QUEUED_MESSAGES = 100;
+
+/// @return the number of threads to decode event messages, leaving a core for
+/// the thread receiving the messages. Follows MultiThreaded.MaxCores, as the
+/// thread pool and OpenMP do, if it is set.
+size_t numberOfDecoderThreads() {
+  const auto maxCores = Mantid::Kernel::ConfigService::Instance().getValue<int>(
+      "MultiThreaded.MaxCores");
+  if (maxCores.get_value_or(0) > 0)
+    return std::max<size_t>(static_cast<size_t>(maxCores.get()), 2) - 1;
+  const auto nCores = static_cast<size_t>(std::thread::hardware_concurrency());
+  return std::min(std::max<size_t>(nCores, 2) - 1, MAX_DECODER_THREADS);
+}
+
 /**
  * Append sample log data to existing log or create a new log if one with
  * specified name does not already exist
@@ -86,7 +106,8 @@ KafkaEventStreamDecoder::KafkaEventStreamDecoder(
       m_spDetTopic(spDetTopic), m_sampleEnvTopic(sampleEnvTopic),
       m_interrupt(false), m_localEvents(), m_specToIdx(), m_runStart(),
       m_runNumber(-1), m_thread(), m_capturing(false), m_exception(),
-      m_extractWaiting(false), m_cbIterationEnd([] {}), m_cbError([] {}) {}
+      m_extractWaiting(false), m_nDecoding(0), m_stopDecoding(false),
+      m_cbIterationEnd([] {}), m_cbError([] {}) {}
 
 /**
  * Destructor.
@@ -223,6 +244,12 @@ API::Workspace_sptr KafkaEventStreamDecoder::extractData() {
 
 API::Workspace_sptr KafkaEventStreamDecoder::extractDataImpl() {
   std::lock_guard<std::mutex> lock(m_mutex);
+  if (!m_localEvents.empty()) {
+    // Add the events decoded so far to the buffers
+    std::unique_lock<std::mutex> decodeLock(m_decodeMutex);
+    waitForDecoding(decodeLock);
+    mergePartialBuffers();
+  }
   if (m_localEvents.size() == 1) {
     auto temp = createBufferWorkspace(m_localEvents.front());
     std::swap(m_localEvents.front(), temp);
@@ -249,6 +276,7 @@ API::Workspace_sptr KafkaEventStreamDecoder::extractDataImpl() {
 void KafkaEventStreamDecoder::captureImpl() noexcept {
   m_capturing = true;
   try {
+    startDecoding();
     captureImplExcept();
   } catch (std::exception &exc) {
     m_cbError();
@@ -258,6 +286,7 @@ void KafkaEventStreamDecoder::captureImpl() noexcept {
     m_exception = boost::make_shared<std::runtime_error>(
         "KafkaEventStreamDecoder: Unknown exception type caught.");
   }
+  stopDecoding();
   m_capturing = false;
 }
 
@@ -334,7 +363,7 @@ void KafkaEventStreamDecoder::captureImplExcept() {
     if (flatbuffers::BufferHasIdentifier(
             reinterpret_cast<const uint8_t *>(buffer.c_str()),
             EVENT_MESSAGE_ID.c_str())) {
-      eventDataFromMessage(buffer);
+      queueEventMessage(buffer);
     }
     // Check if we have a sample environment log message
     else if (flatbuffers::BufferHasIdentifier(
@@ -602,7 +631,13 @@ void KafkaEventStreamDecoder::sampleDataFromMessage(const std::string &buffer) {
   }
 }
 
-void KafkaEventStreamDecoder::eventDataFromMessage(const std::string &buffer) {
+/**
+ * Decode an event message into the partial buffer of a decoder thread
+ * @param buffer : the event message
+ * @param partialBuffer : the partial buffer of the calling decoder thread
+ */
+void KafkaEventStreamDecoder::eventDataFromMessage(
+    const std::string &buffer, PartialBuffer &partialBuffer) {
   auto eventMsg =
       GetEventMessage(reinterpret_cast<const uint8_t *>(buffer.c_str()));
 
@@ -611,24 +646,173 @@ void KafkaEventStreamDecoder::eventDataFromMessage(const std::string &buffer) {
   const auto &detData = *(eventMsg->detector_id());
   auto nEvents = tofData.size();
 
-  DataObjects::EventWorkspace_sptr periodBuffer;
-  std::lock_guard<std::mutex> lock(m_mutex);
+  size_t period(0);
   if (eventMsg->facility_specific_data_type() == FacilityData_ISISData) {
     auto ISISMsg =
         static_cast<const ISISData *>(eventMsg->facility_specific_data());
-    periodBuffer = m_localEvents[static_cast<size_t>(ISISMsg->period_number())];
-    auto &mutableRunInfo = periodBuffer->mutableRun();
-    mutableRunInfo.getTimeSeriesProperty<double>(PROTON_CHARGE_PROPERTY)
-        ->addValue(pulseTime, ISISMsg->proton_charge());
-  } else {
-    periodBuffer = m_localEvents[0];
+    period = static_cast<size_t>(ISISMsg->period_number());
+    partialBuffer.protonCharge[period].emplace_back(pulseTime,
+                                                    ISISMsg->proton_charge());
   }
+  auto &periodEvents = partialBuffer.events[period];
+  const auto unknownSpectrum = m_specToIdx.cend();
   for (decltype(nEvents) i = 0; i < nEvents; ++i) {
-    auto &spectrum = periodBuffer->getSpectrum(
-        m_specToIdx[static_cast<int32_t>(detData[i])]);
-    spectrum.addEventQuickly(TofEvent(static_cast<double>(tofData[i]) *
-                                          1e-3, // nanoseconds to microseconds
-                                      pulseTime));
+    // Events of an unknown spectrum go to the first workspace index
+    const auto index = m_specToIdx.find(static_cast<int32_t>(detData[i]));
+    const size_t wsIdx = index != unknownSpectrum ? index->second : 0;
+    periodEvents[wsIdx].emplace_back(static_cast<double>(tofData[i]) *
+                                         1e-3, // nanoseconds to microseconds
+                                     pulseTime);
+  }
+}
+
+/**
+ * Start the threads decoding the event messages. Each thread has its own
+ * partial buffer, sized by initLocalCaches()
+ */
+void KafkaEventStreamDecoder::startDecoding() {
+  const size_t nThreads = numberOfDecoderThreads();
+  {
+    std::lock_guard<std::mutex> decodeLock(m_decodeMutex);
+    m_eventMessages.clear();
+    m_nDecoding = 0;
+    m_stopDecoding = false;
+    m_decodingError = nullptr;
+    m_partialBuffers.assign(nThreads, PartialBuffer());
+  }
+  for (size_t i = 0; i < nThreads; ++i) {
+    m_decoderThreads.emplace_back(
+        [this, i]() { this->decodeImpl(m_partialBuffers[i]); });
+  }
+}
+
+/**
+ * Stop the decoder threads once they have decoded the queued messages
+ */
+void KafkaEventStreamDecoder::stopDecoding() noexcept {
+  {
+    std::lock_guard<std::mutex> decodeLock(m_decodeMutex);
+    m_stopDecoding = true;
+  }
+  m_cvDecode.notify_all();
+  for (auto &thread : m_decoderThreads) {
+    thread.join();
+  }
+  m_decoderThreads.clear();
+}
+
+/**
+ * Main loop of a decoder thread: decode queued event messages into the
+ * partial buffer until asked to stop
+ * @param partialBuffer : the partial buffer of this thread
+ */
+void KafkaEventStreamDecoder::decodeImpl(
+    PartialBuffer &partialBuffer) noexcept {
+  std::unique_lock<std::mutex> decodeLock(m_decodeMutex);
+  while (true) {
+    m_cvDecode.wait(decodeLock, [this] {
+      return m_stopDecoding || !m_eventMessages.empty();
+    });
+    if (m_eventMessages.empty())
+      return;
+    std::string buffer = std::move(m_eventMessages.front());
+    m_eventMessages.pop_front();
+    ++m_nDecoding;
+    decodeLock.unlock();
+    m_cvDecoded.notify_all();
+
+    std::exception_ptr error;
+    try {
+      eventDataFromMessage(buffer, partialBuffer);
+    } catch (...) {
+      error = std::current_exception();
+    }
+
+    decodeLock.lock();
+    if (error && !m_decodingError)
+      m_decodingError = error;
+    --m_nDecoding;
+    m_cvDecoded.notify_all();
+  }
+}
+
+/**
+ * Hand an event message to the decoder threads. Waits while too many messages
+ * are already waiting to be decoded.
+ * @param buffer : the event message, which is moved from
+ * @throw any error raised while decoding an earlier message
+ */
+void KafkaEventStreamDecoder::queueEventMessage(std::string &buffer) {
+  std::unique_lock<std::mutex> decodeLock(m_decodeMutex);
+  m_cvDecoded.wait(decodeLock, [this] {
+    return m_eventMessages.size() < MAX_QUEUED_MESSAGES || m_decodingError;
+  });
+  if (m_decodingError)
+    std::rethrow_exception(m_decodingError);
+  m_eventMessages.emplace_back(std::move(buffer));
+  decodeLock.unlock();
+  m_cvDecode.notify_one();
+}
+
+/**
+ * Wait until every queued event message has been decoded
+ * @param decodeLock : a lock on m_decodeMutex
+ */
+void KafkaEventStreamDecoder::waitForDecoding(
+    std::unique_lock<std::mutex> &decodeLock) {
+  m_cvDecoded.wait(decodeLock, [this] {
+    return m_eventMessages.empty() && m_nDecoding == 0;
+  });
+}
+
+/**
+ * Size the partial buffers of the decoder threads for a new run. Must be
+ * called with m_decodeMutex locked and nothing left to decode.
+ * @param nperiods : the number of periods
+ * @param nspectra : the number of spectra
+ */
+void KafkaEventStreamDecoder::resetPartialBuffers(size_t nperiods,
+                                                  size_t nspectra) {
+  for (auto &partialBuffer : m_partialBuffers) {
+    partialBuffer.events.assign(
+        nperiods, std::vector<std::vector<TofEvent>>(nspectra));
+    partialBuffer.protonCharge.assign(
+        nperiods, std::vector<std::pair<DateAndTime, double>>());
+  }
+}
+
+/**
+ * Add the data decoded by the decoder threads to the buffer workspaces and
+ * empty the partial buffers. Must be called with m_mutex and m_decodeMutex
+ * locked and nothing left to decode.
+ */
+void KafkaEventStreamDecoder::mergePartialBuffers() {
+  for (size_t period = 0; period < m_localEvents.size(); ++period) {
+    auto &periodBuffer = *m_localEvents[period];
+    const auto nspectra =
+        static_cast<int64_t>(periodBuffer.getNumberHistograms());
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t i = 0; i < nspectra; ++i) {
+      const auto wsIdx = static_cast<size_t>(i);
+      auto &spectrum = periodBuffer.getSpectrum(wsIdx);
+      for (auto &partialBuffer : m_partialBuffers) {
+        auto &events = partialBuffer.events[period][wsIdx];
+        if (!events.empty()) {
+          spectrum += events;
+          events.clear();
+        }
+      }
+    }
+
+    auto protonCharge =
+        periodBuffer.mutableRun().getTimeSeriesProperty<double>(
+            PROTON_CHARGE_PROPERTY);
+    for (auto &partialBuffer : m_partialBuffers) {
+      for (const auto &value : partialBuffer.protonCharge[period]) {
+        protonCharge->addValue(value.first, value.second);
+      }
+      partialBuffer.protonCharge[period].clear();
+    }
   }
 }
 
@@ -713,9 +897,6 @@ void KafkaEventStreamDecoder::initLocalCaches(
   mutableRun.addProperty(
       new Kernel::TimeSeriesProperty<double>(PROTON_CHARGE_PROPERTY));
 
-  // Cache spec->index mapping. We assume it is the same across all periods
-  m_specToIdx = eventBuffer->getSpectrumToWorkspaceIndexMap();
-
   // Buffers for each period
   const size_t nperiods = runStartData.nPeriods;
   if (nperiods == 0) {
@@ -725,6 +906,12 @@ void KafkaEventStreamDecoder::initLocalCaches(
   }
   {
     std::lock_guard<std::mutex> lock(m_mutex);
+    // The decoder threads use the mapping and the partial buffers
+    std::unique_lock<std::mutex> decodeLock(m_decodeMutex);
+    waitForDecoding(decodeLock);
+    // Cache spec->index mapping. We assume it is the same across all periods
+    m_specToIdx = eventBuffer->getSpectrumToWorkspaceIndexMap();
+    resetPartialBuffers(nperiods, eventBuffer->getNumberHistograms());
     m_localEvents.resize(nperiods);
     m_localEvents[0] = eventBuffer;
     for (size_t i = 1; i < nperiods; ++i) {
@@ -144,6 +144,17 @@ void LiveDataAlgorithm::initProps() {
                                 FileProperty::OptionalLoad, "py"),
       " Python script that will be run to process the accumulated data.");
 
+  declareProperty(
+      "IncrementalPostProcessing", false,
+      "Post-process only each new chunk of data and add the result to the "
+      "previous output, instead of post-processing all of the accumulated "
+      "data at every update. This keeps the time for an update constant "
+      "through a long run.\n"
+      "Only for the Add accumulation method, and only correct if the "
+      "post-processing is linear in the data (e.g. rebinning with fixed "
+      "parameters, focussing or summing spectra), so that the sum of the "
+      "post-processed chunks equals the post-processed sum of the chunks.");
+
   std::vector<std::string> runOptions{"Restart", "Stop", "Rename"};
   declareProperty("RunTransitionBehavior", "Restart",
                   boost::make_shared<StringListValidator>(runOptions),
@@ -409,6 +420,17 @@ std::map<std::string, std::string> LiveDataAlgorithm::validateInputs() {
     }
   }
 
+  const bool incrementalPostProcessing =
+      this->getProperty("IncrementalPostProcessing");
+  if (incrementalPostProcessing) {
+    if (!this->hasPostProcessing())
+      out["IncrementalPostProcessing"] =
+          "IncrementalPostProcessing requires a post-processing step.";
+    else if (getPropertyValue("AccumulationMethod") != "Add")
+      out["IncrementalPostProcessing"] =
+          "IncrementalPostProcessing requires the Add accumulation method.";
+  }
+
   // For StartLiveData and MonitorLiveData, make sure another thread is not
   // already using these names
   if (this->name() != "LoadLiveData") {
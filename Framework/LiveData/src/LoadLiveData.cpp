@@ -89,12 +89,14 @@ void LoadLiveData::init() { this->initProps(); }
  *
  * @param inputWS :: workspace being processed
  * @param PostProcess :: flag, TRUE if doing the post-processing
+ * @param onChunk :: flag, TRUE if inputWS is a chunk of data rather than the
+ *accumulation workspace. A chunk is processed in place under an anonymous name.
  * @return the processed workspace. Will point to inputWS if no processing is to
  *do
  */
 Mantid::API::Workspace_sptr
 LoadLiveData::runProcessing(Mantid::API::Workspace_sptr inputWS,
-                            bool PostProcess) {
+                            bool PostProcess, bool onChunk) {
   if (!inputWS)
     throw std::runtime_error(
         "LoadLiveData::runProcessing() called for an empty input workspace.");
@@ -118,8 +120,9 @@ LoadLiveData::runProcessing(Mantid::API::Workspace_sptr inputWS,
     // Transform the chunk in-place
     std::string outputName = inputName;
 
-    // Except, no need for anonymous names with the post-processing
-    if (PostProcess) {
+    // Except, no need for anonymous names with the post-processing of the
+    // accumulation workspace
+    if (!onChunk) {
       inputName = this->getPropertyValue("AccumulationWorkspace");
       outputName = this->getPropertyValue("OutputWorkspace");
     }
@@ -170,7 +173,7 @@ LoadLiveData::runProcessing(Mantid::API::Workspace_sptr inputWS,
           " Algorithm's OutputWorkspace property is not a WorkspaceProperty!");
     Workspace_sptr temp = wsProp->getWorkspace();
 
-    if (!PostProcess) {
+    if (onChunk) {
       if (!temp) {
         // a group workspace cannot be returned by wsProp
         temp = AnalysisDataService::Instance().retrieve(inputName);
@@ -199,7 +202,7 @@ LoadLiveData::runProcessing(Mantid::API::Workspace_sptr inputWS,
 Mantid::API::Workspace_sptr
 LoadLiveData::processChunk(Mantid::API::Workspace_sptr chunkWS) {
   try {
-    return runProcessing(chunkWS, false);
+    return runProcessing(chunkWS, false, true);
   } catch (...) {
     g_log.error("While processing chunk:");
     throw;
@@ -213,13 +216,36 @@ LoadLiveData::processChunk(Mantid::API::Workspace_sptr chunkWS) {
  */
 void LoadLiveData::runPostProcessing() {
   try {
-    m_outputWS = runProcessing(m_accumWS, true);
+    m_outputWS = runProcessing(m_accumWS, true, false);
   } catch (...) {
     g_log.error("While post processing:");
     throw;
   }
 }
 
+//----------------------------------------------------------------------------------------------
+/** Perform the PostProcessing steps on a chunk of data only and add the result
+ * to the previous output, which must already exist.
+ * This is only correct for post-processing that is linear in the data.
+ * Sets the m_outputWS member to the updated output.
+ *
+ * @param chunkWS :: processed live data chunk workspace
+ */
+void LoadLiveData::runIncrementalPostProcessing(
+    Mantid::API::Workspace_sptr chunkWS) {
+  try {
+    auto processed = runProcessing(chunkWS, true, true);
+    // Keeps the locked workspace alive if the output is replaced
+    const Workspace_sptr outputWS = m_outputWS;
+    WriteLock _lock1(*outputWS);
+    ReadLock _lock2(*processed);
+    addWorkspace(m_outputWS, processed);
+  } catch (...) {
+    g_log.error("While post processing the chunk:");
+    throw;
+  }
+}
+
 //----------------------------------------------------------------------------------------------
 /** Accumulate the data by adding (summing) to the output workspace.
  * Calls the Plus algorithm
@@ -228,15 +254,29 @@ void LoadLiveData::runPostProcessing() {
  * @param chunkWS :: processed live data chunk workspace
  */
 void LoadLiveData::addChunk(Mantid::API::Workspace_sptr chunkWS) {
-  // Acquire locks on the workspaces we use
-  WriteLock _lock1(*m_accumWS);
+  // Acquire locks on the workspaces we use, keeping the locked workspace
+  // alive if the accumulation workspace is replaced
+  const Workspace_sptr accumWS = m_accumWS;
+  WriteLock _lock1(*accumWS);
   ReadLock _lock2(*chunkWS);
 
+  addWorkspace(m_accumWS, chunkWS);
+}
+
+//----------------------------------------------------------------------------------------------
+/** Add (sum) a workspace to another one, which is updated in place if
+ * possible.
+ *
+ * @param accumWS :: workspace to add to. May be replaced by a new workspace.
+ * @param chunkWS :: workspace to add
+ */
+void LoadLiveData::addWorkspace(Workspace_sptr &accumWS,
+                                Workspace_sptr chunkWS) {
   // ISIS multi-period data come in workspace groups
   if (WorkspaceGroup_sptr gws =
           boost::dynamic_pointer_cast<WorkspaceGroup>(chunkWS)) {
     WorkspaceGroup_sptr accum_gws =
-        boost::dynamic_pointer_cast<WorkspaceGroup>(m_accumWS);
+        boost::dynamic_pointer_cast<WorkspaceGroup>(accumWS);
     if (!accum_gws) {
       throw std::runtime_error("Two workspace groups are expected.");
     }
@@ -246,17 +286,28 @@ void LoadLiveData::addChunk(Mantid::API::Workspace_sptr chunkWS) {
     }
     // binary operations cannot handle groups passed by pointers, so add members
     // one by one
-    for (size_t i = 0; i < static_cast<size_t>(gws->getNumberOfEntries());
-         ++i) {
-      addMatrixWSChunk(accum_gws->getItem(i), gws->getItem(i));
+    const auto nItems = static_cast<size_t>(gws->getNumberOfEntries());
+    std::vector<Workspace_sptr> items(nItems);
+    bool replaced = false;
+    for (size_t i = 0; i < nItems; ++i) {
+      items[i] = accum_gws->getItem(i);
+      const Workspace_sptr item = items[i];
+      addMatrixWSChunk(items[i], gws->getItem(i));
+      replaced |= items[i] != item;
+    }
+    // put the group back together if a member was not updated in place
+    if (replaced) {
+      accum_gws->removeAll();
+      for (const auto &item : items)
+        accum_gws->addWorkspace(item);
     }
   } else if (MatrixWorkspace_sptr mws =
                  boost::dynamic_pointer_cast<MatrixWorkspace>(chunkWS)) {
     // If workspace is a Matrix workspace just add the chunk
-    addMatrixWSChunk(m_accumWS, chunkWS);
+    addMatrixWSChunk(accumWS, chunkWS);
   } else {
     // Assume MD Workspace
-    addMDWSChunk(m_accumWS, chunkWS);
+    addMDWSChunk(accumWS, chunkWS);
   }
 }
 
@@ -264,11 +315,11 @@ void LoadLiveData::addChunk(Mantid::API::Workspace_sptr chunkWS) {
 /**
  * Add a matrix workspace to the accumulation workspace.
  *
- * @param algoName :: Name of algorithm which will be adding the workspaces.
- * @param accumWS :: accumulation matrix workspace
+ * @param accumWS :: accumulation matrix workspace. Replaced by the output of
+ * Plus if it could not add in place.
  * @param chunkWS :: processed live data chunk matrix workspace
  */
-void LoadLiveData::addMatrixWSChunk(Workspace_sptr accumWS,
+void LoadLiveData::addMatrixWSChunk(Workspace_sptr &accumWS,
                                     Workspace_sptr chunkWS) {
   // Handle the addition of the internal monitor workspace, if present
   auto accumMW = boost::dynamic_pointer_cast<MatrixWorkspace>(accumWS);
@@ -287,6 +338,9 @@ void LoadLiveData::addMatrixWSChunk(Workspace_sptr accumWS,
   alg->setProperty("RHSWorkspace", chunkWS);
   alg->setProperty("OutputWorkspace", accumWS);
   alg->execute();
+
+  MatrixWorkspace_sptr outputWS = alg->getProperty("OutputWorkspace");
+  accumWS = outputWS;
 }
 
 //----------------------------------------------------------------------------------------------
@@ -545,6 +599,14 @@ void LoadLiveData::exec() {
   if (!m_accumWS || dataReset)
     accum = "Replace";
 
+  // Post-process only the new chunk if the output of the previous chunks can
+  // be added to
+  const bool incrementalPostProcessing =
+      this->getProperty("IncrementalPostProcessing");
+  const bool postProcessChunk = incrementalPostProcessing &&
+                                this->hasPostProcessing() && accum == "Add" &&
+                                m_outputWS && m_outputWS != m_accumWS;
+
   g_log.notice() << "Performing the " << accum << " operation.\n";
 
   // Perform the accumulation and set the AccumulationWorkspace workspace
@@ -565,7 +627,10 @@ void LoadLiveData::exec() {
 
   if (this->hasPostProcessing()) {
     // ----------- Run post-processing -------------
-    this->runPostProcessing();
+    if (postProcessChunk)
+      this->runIncrementalPostProcessing(processed);
+    else
+      this->runPostProcessing();
     // Set both output workspaces
     this->setProperty("AccumulationWorkspace", m_accumWS);
     this->setProperty("OutputWorkspace", m_outputWS);
@@ -133,6 +133,36 @@ public:
     }
   }
 
+  void test_Event_Messages_Decoded_In_Parallel_Are_All_Extracted() {
+    using namespace ::testing;
+    using namespace KafkaTesting;
+    using Mantid::API::Workspace_sptr;
+    using Mantid::DataObjects::EventWorkspace;
+    using namespace Mantid::LiveData;
+
+    auto mockBroker = std::make_shared<MockKafkaBroker>();
+    EXPECT_CALL(*mockBroker, subscribe_(_, _))
+        .Times(Exactly(3))
+        .WillOnce(Return(new FakeISISEventSubscriber(1)))
+        .WillOnce(Return(new FakeRunInfoStreamSubscriber(1)))
+        .WillOnce(Return(new FakeISISSpDetStreamSubscriber));
+    auto decoder = createTestDecoder(mockBroker);
+    const uint8_t nMessages(50);
+    startCapturing(*decoder, nMessages);
+
+    Workspace_sptr workspace;
+    TS_ASSERT_THROWS_NOTHING(workspace = decoder->extractData());
+    TS_ASSERT_THROWS_NOTHING(decoder->stopCapture());
+    TS_ASSERT(!decoder->isCapturing());
+
+    // Every message received before the extraction must be in the workspace
+    auto eventWksp = boost::dynamic_pointer_cast<EventWorkspace>(workspace);
+    TS_ASSERT(eventWksp);
+    checkWorkspaceEventData(*eventWksp);
+    TS_ASSERT_LESS_THAN_EQUALS(static_cast<size_t>(6 * nMessages),
+                               eventWksp->getNumberEvents());
+  }
+
   void test_Varying_Period_Event_Stream() {
     /**
      * Test that period number is correctly updated between runs
@@ -53,7 +53,7 @@ public:
          std::string PostProcessingAlgorithm = "",
          std::string PostProcessingProperties = "", bool PreserveEvents = true,
          ILiveListener_sptr listener = ILiveListener_sptr(),
-         bool makeThrow = false) {
+         bool makeThrow = false, bool IncrementalPostProcessing = false) {
     FacilityHelper::ScopedFacilities loadTESTFacility(
         "IDFs_for_UNIT_TESTING/UnitTestFacilities.xml", "TEST");
 
@@ -73,6 +73,8 @@ public:
     TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("PostProcessingProperties",
                                                   PostProcessingProperties));
     TS_ASSERT_THROWS_NOTHING(alg.setProperty("PreserveEvents", PreserveEvents));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("IncrementalPostProcessing",
+                                             IncrementalPostProcessing));
     if (!PostProcessingAlgorithm.empty())
       TS_ASSERT_THROWS_NOTHING(
           alg.setPropertyValue("AccumulationWorkspace", "fake_accum"));
@@ -299,6 +301,34 @@ public:
     TS_ASSERT_EQUALS(AnalysisDataService::Instance().size(), 2);
   }
 
+  //--------------------------------------------------------------------------------------------
+  /** Post-process only the new chunks and add them to the previous output */
+  void test_Add_with_IncrementalPostProcessing() {
+    Workspace2D_sptr ws1, ws2;
+    ws1 = doExec<Workspace2D>("Add", "Rebin", "Params=40e3, 1e3, 60e3",
+                              "SumSpectra", "", false, ILiveListener_sptr(),
+                              false, true);
+    TS_ASSERT_EQUALS(ws1->getNumberHistograms(), 1);
+    TS_ASSERT_EQUALS(ws1->blocksize(), 20);
+    TS_ASSERT_DELTA(countsInFirstSpectrum(*ws1), 200.0, 1e-4);
+
+    // The second chunk is summed on its own and added to the output
+    ws2 = doExec<Workspace2D>("Add", "Rebin", "Params=40e3, 1e3, 60e3",
+                              "SumSpectra", "", false, ILiveListener_sptr(),
+                              false, true);
+    TSM_ASSERT("Output being added to stayed the same pointer", ws1 == ws2);
+    TS_ASSERT_EQUALS(ws2->getNumberHistograms(), 1);
+    TS_ASSERT_DELTA(countsInFirstSpectrum(*ws2), 400.0, 1e-4);
+
+    // The accumulation workspace still holds all of the data
+    auto ws_accum =
+        AnalysisDataService::Instance().retrieveWS<Workspace2D>("fake_accum");
+    TS_ASSERT(ws_accum);
+    TS_ASSERT_EQUALS(ws_accum->getNumberHistograms(), 2);
+    TS_ASSERT_DELTA(countsInFirstSpectrum(*ws_accum), 200.0, 1e-4);
+    TS_ASSERT_EQUALS(AnalysisDataService::Instance().size(), 2);
+  }
+
   //--------------------------------------------------------------------------------------------
   /** Do some processing that converts to a different type of workspace */
   void test_ProcessToMDWorkspace_and_Add() {
@@ -509,6 +539,12 @@ public:
                      16.0);
     AnalysisDataService::Instance().clear();
   }
+
+private:
+  double countsInFirstSpectrum(const MatrixWorkspace &ws) {
+    const auto &y = ws.y(0);
+    return std::accumulate(y.begin(), y.end(), 0.0);
+  }
 };
 
 #endif /* MANTID_LIVEDATA_LOADLIVEDATATEST_H_ */
@@ -66,10 +66,16 @@ private:
   template <typename MDE, size_t nd>
   void binByIterating(typename DataObjects::MDEventWorkspace<MDE, nd>::sptr ws);
 
+  /// Helper method binning with a copy of the output for each thread
+  template <typename MDE, size_t nd>
+  void binWithThreadHistograms(
+      typename DataObjects::MDEventWorkspace<MDE, nd>::sptr ws);
+
   /// Method to bin a single MDBox
   template <typename MDE, size_t nd>
   void binMDBox(DataObjects::MDBox<MDE, nd> *box, const size_t *const chunkMin,
-                const size_t *const chunkMax);
+                const size_t *const chunkMax, signal_t *signals,
+                signal_t *errors, signal_t *numEvents);
 
   /// The output MDHistoWorkspace
   Mantid::DataObjects::MDHistoWorkspace_sptr outWS;
@@ -80,9 +86,6 @@ private:
 
   /// Cached values for speed up
   size_t *indexMultiplier;
-  signal_t *signals;
-  signal_t *errors;
-  signal_t *numEvents;
   bool m_accumulate{false};
 };
 
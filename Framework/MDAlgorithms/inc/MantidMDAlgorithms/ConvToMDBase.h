@@ -1,6 +1,7 @@
 #ifndef MANTID_MDALGORITHMS_CONVERTMD_BASE_H
 #define MANTID_MDALGORITHMS_CONVERTMD_BASE_H
 
+#include "MantidAPI/BoxController.h"
 #include "MantidAPI/ExperimentInfo.h"
 #include "MantidAPI/MatrixWorkspace_fwd.h"
 #include "MantidAPI/NumericAxis.h"
@@ -108,6 +109,9 @@ protected:
   /// Any special coordinate system used.
   Mantid::Kernel::SpecialCoordinateSystem m_coordinateSystem;
 
+  /// Write the boxes of a file-backed workspace out if its buffer is full
+  static void writeOutFullBuffer(API::BoxController &bc);
+
 private:
   /** internal function which do one peace of work, which should be performed by
     one thread
@@ -2,8 +2,11 @@
 #define MANTID_MDALGORITHMS_MDNORMSCD_H_
 
 #include "MantidAPI/Algorithm.h"
+#include "MantidMDAlgorithms/MDNormTrajectoryCache.h"
 #include "MantidMDAlgorithms/SlicingAlgorithm.h"
 
+#include <atomic>
+
 namespace Mantid {
 namespace DataObjects {
 class EventWorkspace;
@@ -63,13 +66,14 @@ private:
   void cacheDimensionXValues();
   void calculateNormalization(const std::vector<coord_t> &otherValues,
                               const Kernel::Matrix<coord_t> &affineTrans,
-                              uint16_t expInfoIndex);
+                              uint16_t expInfoIndex,
+                              std::vector<std::atomic<signal_t>> &signalArray);
   void calcIntegralsForIntersections(const std::vector<double> &xValues,
                                      const API::MatrixWorkspace &integrFlux,
                                      size_t sp,
                                      std::vector<double> &yValues) const;
   void calculateIntersections(std::vector<std::array<double, 4>> &intersections,
-                              const double theta, const double phi);
+                              const Kernel::V3D &direction);
 
   /// Normalization workspace
   DataObjects::MDHistoWorkspace_sptr m_normWS;
@@ -97,6 +101,8 @@ private:
   bool m_accumulate{false};
   /// number of experiment infos
   uint16_t m_numExptInfos;
+  /// detector trajectories shared by the runs with the same detectors
+  MDNormTrajectoryCache m_trajectoryCache;
 };
 
 } // namespace MDAlgorithms
@@ -0,0 +1,100 @@
+#ifndef MANTID_MDALGORITHMS_MDNORMTRAJECTORYCACHE_H_
+#define MANTID_MDALGORITHMS_MDNORMTRAJECTORYCACHE_H_
+
+#include "MantidAPI/MatrixWorkspace_fwd.h"
+#include "MantidKernel/System.h"
+#include "MantidKernel/V3D.h"
+#include "MantidKernel/cow_ptr.h"
+#include "MantidTypes/SpectrumDefinition.h"
+
+#include <array>
+#include <vector>
+
+namespace Mantid {
+namespace API {
+class ExperimentInfo;
+}
+namespace Geometry {
+class DetectorInfo;
+}
+namespace MDAlgorithms {
+
+/** MDNormTrajectoryCache : Holds the detector information needed to compute
+  the trajectories of MDNormSCD and MDNormDirectSC, so that it is computed
+  once for all the runs that share the same detector geometry, rather than
+  once per run.
+
+  For each detector that is not a monitor or masked it stores the direction
+  of the detector seen from the sample in the beam frame, the solid angle and
+  the index of its spectrum in the flux workspace. It also holds a buffer for
+  the intersections of the trajectories with the grid for every thread, so
+  that they are not reallocated for every run.
+
+  Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class DLLExport MDNormTrajectoryCache {
+public:
+  /// The cached values for a single detector
+  struct Trajectory {
+    /// Unit vector from the sample to the detector in the beam frame,
+    /// (sin(theta)cos(phi), sin(theta)sin(phi), cos(theta))
+    Kernel::V3D direction;
+    /// Solid angle of the detector, or 1 if no solid angle workspace is given
+    double solidAngle;
+    /// Workspace index of the detector in the flux workspace, if given
+    size_t fluxIndex;
+  };
+
+  bool update(const API::ExperimentInfo &exptInfo,
+              const Kernel::V3D &samplePos, const Kernel::V3D &beamDir,
+              const API::MatrixWorkspace *solidAngleWS,
+              const API::MatrixWorkspace *fluxWS = nullptr);
+  void clear();
+  /// The trajectories of the valid detectors
+  const std::vector<Trajectory> &trajectories() const { return m_trajectories; }
+  void reserveThreads(const int nthreads);
+  std::vector<std::array<double, 4>> &intersections(const int thread);
+
+private:
+  bool isValidFor(const API::ExperimentInfo &exptInfo,
+                  const API::MatrixWorkspace *solidAngleWS,
+                  const API::MatrixWorkspace *fluxWS) const;
+
+  /// Detector info the trajectories were computed from
+  const Geometry::DetectorInfo *m_detectorInfo{nullptr};
+  /// Spectrum definitions the trajectories were computed from
+  Kernel::cow_ptr<std::vector<SpectrumDefinition>> m_spectrumDefinitions{
+      nullptr};
+  /// Solid angle workspace the trajectories were computed with
+  const API::MatrixWorkspace *m_solidAngleWS{nullptr};
+  /// Flux workspace the trajectories were computed with
+  const API::MatrixWorkspace *m_fluxWS{nullptr};
+  /// The cached trajectories
+  std::vector<Trajectory> m_trajectories;
+  /// Intersection buffers, one per thread
+  std::vector<std::vector<std::array<double, 4>>> m_intersections;
+};
+
+} // namespace MDAlgorithms
+} // namespace Mantid
+
+#endif /* MANTID_MDALGORITHMS_MDNORMTRAJECTORYCACHE_H_ */
@@ -77,6 +77,8 @@ private:
 
   uint64_t loadEventsFromSubBoxes(API::IMDNode *TargetBox);
 
+  void mergeBoxesStreaming(Kernel::DiskBuffer *diskBuf);
+
   // the class which flatten the box structure and deal with it
   DataObjects::MDBoxFlatTree m_BoxStruct;
   // the vector of box structures for contributing files components
@@ -12,11 +12,14 @@
 #include "MantidGeometry/MDGeometry/MDHistoDimension.h"
 #include "MantidKernel/CPUTimer.h"
 #include "MantidKernel/EnabledWhenProperty.h"
+#include "MantidKernel/PerThread.h"
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/System.h"
 #include "MantidKernel/Utils.h"
 #include <boost/algorithm/string.hpp>
 
+#include <algorithm>
+
 namespace Mantid {
 namespace MDAlgorithms {
 
@@ -28,12 +31,29 @@ using namespace Mantid::API;
 using namespace Mantid::Geometry;
 using namespace Mantid::DataObjects;
 
+namespace {
+/// Number of events transformed together by CoordTransform::applyMany
+const size_t EVENT_BLOCK_SIZE = 1024;
+
+/// Largest number of bins, summed over all threads, for which each thread
+/// accumulates into its own copy of the output (24 bytes per bin)
+const size_t MAX_THREAD_HISTOGRAM_BINS = 1 << 22;
+
+/// Output signal, error squared and number of events summed by one thread
+struct BinSums {
+  explicit BinSums(const size_t numBins)
+      : signals(numBins, 0.0), errors(numBins, 0.0), numEvents(numBins, 0.0) {}
+  std::vector<signal_t> signals;
+  std::vector<signal_t> errors;
+  std::vector<signal_t> numEvents;
+};
+} // namespace
+
 //----------------------------------------------------------------------------------------------
 /** Constructor
  */
 BinMD::BinMD()
-    : outWS(), implicitFunction(nullptr), indexMultiplier(nullptr),
-      signals(nullptr), errors(nullptr), numEvents(nullptr) {}
+    : outWS(), implicitFunction(nullptr), indexMultiplier(nullptr) {}
 
 //----------------------------------------------------------------------------------------------
 /** Initialize the algorithm's properties.
@@ -91,10 +111,14 @@ void BinMD::init() {
  *(inclusive)
  * @param chunkMax :: the maximum index in each dimension to consider "valid"
  *(exclusive)
+ * @param signals :: signal array of the output to add to
+ * @param errors :: error squared array of the output to add to
+ * @param numEvents :: number of events array of the output to add to
  */
 template <typename MDE, size_t nd>
 inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin,
-                            const size_t *const chunkMax) {
+                            const size_t *const chunkMax, signal_t *signals,
+                            signal_t *errors, signal_t *numEvents) {
   // An array to hold the rotated/transformed coordinates
   auto outCenter = new coord_t[m_outD];
 
@@ -174,43 +198,55 @@ inline void BinMD::binMDBox(MDBox<MDE, nd> *box, const size_t *const chunkMin,
 
   // If you get here, you could not determine that the entire box was in the
   // same bin.
-  // So you need to iterate through events.
+  // So you need to iterate through events. They are transformed in blocks,
+  // with the coordinates stored by dimension so that the transformation and
+  // the bin indices are computed with vectorized loops.
   const std::vector<MDE> &events = box->getConstEvents();
-  for (auto it = events.begin(); it != events.end(); ++it) {
-    // Cache the center of the event (again for speed)
-    const coord_t *inCenter = it->getCenter();
+  const size_t blockSize = std::min(EVENT_BLOCK_SIZE, events.size());
+  std::vector<coord_t> inCoords(nd * blockSize);
+  std::vector<coord_t> outCoords(m_outD * blockSize);
+  std::vector<size_t> linearIndex(blockSize);
+  // To mark events outside range
+  std::vector<char> inRange(blockSize);
+
+  for (size_t first = 0; first < events.size(); first += blockSize) {
+    const size_t count = std::min(blockSize, events.size() - first);
+    for (size_t i = 0; i < count; ++i) {
+      const coord_t *inCenter = events[first + i].getCenter();
+      for (size_t d = 0; d < nd; ++d)
+        inCoords[d * count + i] = inCenter[d];
+    }
 
     // Now transform to the output dimensions
-    m_transform->apply(inCenter, outCenter);
-
-    // To build up the linear index
-    size_t linearIndex = 0;
-    // To mark events outside range
-    bool badOne = false;
+    m_transform->applyMany(inCoords.data(), outCoords.data(), count);
 
-    /// Loop through the dimensions on which we bin
+    // Build up the linear index one dimension on which we bin at a time
+    std::fill_n(linearIndex.begin(), count, 0);
+    std::fill_n(inRange.begin(), count, 1);
     for (size_t bd = 0; bd < m_outD; bd++) {
-      // What is the bin index in that dimension
-      coord_t x = outCenter[bd];
-      size_t ix = size_t(x);
-      // Within range (for this chunk)?
-      if ((x >= 0) && (ix >= chunkMin[bd]) && (ix < chunkMax[bd])) {
-        // Build up the linear index
-        linearIndex += indexMultiplier[bd] * ix;
-      } else {
-        // Outside the range
-        badOne = true;
-        break;
+      const coord_t *x = outCoords.data() + bd * count;
+      const size_t multiplier = indexMultiplier[bd];
+      for (size_t i = 0; i < count; ++i) {
+        // What is the bin index in that dimension
+        const size_t ix = size_t(x[i]);
+        // Within range (for this chunk)?
+        inRange[i] = static_cast<char>(inRange[i] && (x[i] >= 0) &&
+                                       (ix >= chunkMin[bd]) &&
+                                       (ix < chunkMax[bd]));
+        linearIndex[i] += multiplier * ix;
       }
     } // (for each dim in MDHisto)
 
-    if (!badOne) {
-      // Sum the signals as doubles to preserve precision
-      signals[linearIndex] += static_cast<signal_t>(it->getSignal());
-      errors[linearIndex] += static_cast<signal_t>(it->getErrorSquared());
-      // TODO: If DataObjects get a weight, this would need to get the summed
-      // weight.
-      numEvents[linearIndex] += 1.0;
+    for (size_t i = 0; i < count; ++i) {
+      if (inRange[i]) {
+        const MDE &event = events[first + i];
+        // Sum the signals as doubles to preserve precision
+        signals[linearIndex[i]] += static_cast<signal_t>(event.getSignal());
+        errors[linearIndex[i]] += static_cast<signal_t>(event.getErrorSquared());
+        // TODO: If DataObjects get a weight, this would need to get the summed
+        // weight.
+        numEvents[linearIndex[i]] += 1.0;
+      }
     }
   }
   // Done with the events list
@@ -242,9 +278,9 @@ void BinMD::binByIterating(typename MDEventWorkspace<MDE, nd>::sptr ws) {
     else
       indexMultiplier[d] = 1;
   }
-  signals = outWS->getSignalArray();
-  errors = outWS->getErrorSquaredArray();
-  numEvents = outWS->getNumEventsArray();
+  signal_t *signals = outWS->getSignalArray();
+  signal_t *errors = outWS->getErrorSquaredArray();
+  signal_t *numEvents = outWS->getNumEventsArray();
 
   if (!m_accumulate) {
     // Start with signal/error/numEvents at 0.0
@@ -278,9 +314,15 @@ void BinMD::binByIterating(typename MDEventWorkspace<MDE, nd>::sptr ws) {
     prog->resetNumSteps(100, 0.00, 1.0);
   }
 
-  // Run the chunks in parallel. There is no overlap in the output workspace so
-  // it is thread safe to write to it..
-  // cppcheck-suppress syntaxError
+  if (doParallel &&
+      outWS->getNPoints() * static_cast<size_t>(PARALLEL_GET_MAX_THREADS) <=
+          MAX_THREAD_HISTOGRAM_BINS) {
+    // The whole output fits in memory once per thread
+    this->binWithThreadHistograms<MDE, nd>(ws);
+  } else {
+    // Run the chunks in parallel. There is no overlap in the output workspace
+    // so it is thread safe to write to it..
+    // cppcheck-suppress syntaxError
     PRAGMA_OMP( parallel for schedule(dynamic,1) if (doParallel) )
     for (int chunk = 0;
          chunk < int(m_binDimensions[chunkDimension]->getNBins());
@@ -332,7 +374,8 @@ void BinMD::binByIterating(typename MDEventWorkspace<MDE, nd>::sptr ws) {
         MDBox<MDE, nd> *box = dynamic_cast<MDBox<MDE, nd> *>(boxe);
         // Perform the binning in this separate method.
         if (box && !box->getIsMasked())
-          this->binMDBox(box, chunkMin.data(), chunkMax.data());
+          this->binMDBox(box, chunkMin.data(), chunkMax.data(), signals,
+                         errors, numEvents);
 
         // Progress reporting
         if (prog)
@@ -344,17 +387,76 @@ void BinMD::binByIterating(typename MDEventWorkspace<MDE, nd>::sptr ws) {
       PARALLEL_END_INTERUPT_REGION
     } // for each chunk in parallel
     PARALLEL_CHECK_INTERUPT_REGION
+  }
 
-    // Now the implicit function
-    if (implicitFunction) {
-      if (prog)
-        prog->report("Applying implicit function.");
-      signal_t nan = std::numeric_limits<signal_t>::quiet_NaN();
-      outWS->applyImplicitFunction(implicitFunction, nan, nan);
-    }
+  // Now the implicit function
+  if (implicitFunction) {
+    if (prog)
+      prog->report("Applying implicit function.");
+    signal_t nan = std::numeric_limits<signal_t>::quiet_NaN();
+    outWS->applyImplicitFunction(implicitFunction, nan, nan);
+  }
 
-    // return the size of the input workspace write buffer to its initial value
-    // bc->setCacheParameters(sizeof(MDE),writeBufSize);
+  // return the size of the input workspace write buffer to its initial value
+  // bc->setCacheParameters(sizeof(MDE),writeBufSize);
+}
+
+//----------------------------------------------------------------------------------------------
+/** Bin every box of the workspace in parallel, with each thread adding to its
+ * own copy of the output. The copies are summed into the output at the end,
+ * so each box is visited once and the threads never wait for each other.
+ *
+ * @param ws :: MDEventWorkspace of the given type. Must not be file backed.
+ */
+template <typename MDE, size_t nd>
+void BinMD::binWithThreadHistograms(
+    typename MDEventWorkspace<MDE, nd>::sptr ws) {
+  std::vector<size_t> chunkMin(m_outD, 0);
+  std::vector<size_t> chunkMax(m_outD);
+  for (size_t bd = 0; bd < m_outD; bd++)
+    chunkMax[bd] = m_binDimensions[bd]->getNBins();
+
+  // Leaf boxes touching the region of the output
+  std::unique_ptr<MDImplicitFunction> function(
+      this->getImplicitFunctionForChunk(chunkMin.data(), chunkMax.data()));
+  std::vector<API::IMDNode *> boxes;
+  ws->getBox()->getBoxes(boxes, 1000, true, function.get());
+  g_log.debug() << "Found " << boxes.size()
+                << " boxes within the implicit function.\n";
+  if (prog)
+    prog->setNumSteps(boxes.size());
+
+  const size_t numBins = outWS->getNPoints();
+  PerThread<BinSums> threadSums{BinSums(numBins)};
+
+  const auto numBoxes = static_cast<int64_t>(boxes.size());
+  PRAGMA_OMP(parallel for schedule(dynamic, 16))
+  for (int64_t i = 0; i < numBoxes; ++i) {
+    PARALLEL_START_INTERUPT_REGION
+    auto box =
+        dynamic_cast<MDBox<MDE, nd> *>(boxes[static_cast<size_t>(i)]);
+    if (box && !box->getIsMasked()) {
+      auto &sums = threadSums.local();
+      this->binMDBox(box, chunkMin.data(), chunkMax.data(),
+                     sums.signals.data(), sums.errors.data(),
+                     sums.numEvents.data());
+    }
+    if (prog)
+      prog->report();
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+
+  signal_t *signals = outWS->getSignalArray();
+  signal_t *errors = outWS->getErrorSquaredArray();
+  signal_t *numEvents = outWS->getNumEventsArray();
+  for (const auto &sums : threadSums) {
+    for (size_t j = 0; j < numBins; ++j) {
+      signals[j] += sums.signals[j];
+      errors[j] += sums.errors[j];
+      numEvents[j] += sums.numEvents[j];
+    }
+  }
 }
 
 //----------------------------------------------------------------------------------------------
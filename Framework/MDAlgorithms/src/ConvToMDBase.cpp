@@ -117,5 +117,23 @@ void ConvToMDBase::setDisplayNormalization(
   }
 }
 
+/**
+ * Write out the boxes waiting in the disk buffer of a file-backed workspace
+ * once the buffer is full. Splitting the boxes hands the boxes that received
+ * events to the disk buffer; writing them out here keeps the events held in
+ * memory within the write buffer size however many events are converted.
+ * Any write the background I/O thread is doing is finished first, so that no
+ * box is being written out when events are added again.
+ * @param bc :: the box controller of the target workspace
+ */
+void ConvToMDBase::writeOutFullBuffer(API::BoxController &bc) {
+  if (!bc.isFileBacked())
+    return;
+  API::IBoxControllerIO *fileIO = bc.getFileIO();
+  fileIO->waitForIOThread();
+  if (fileIO->getWriteBufferUsed() > fileIO->getWriteBufferSize())
+    fileIO->flushCache();
+}
+
 } // namespace MDAlgorithms
 } // namespace Mantid
@@ -1,5 +1,6 @@
 #include "MantidMDAlgorithms/ConvToMDEventsWS.h"
 
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
 #include "MantidMDAlgorithms/UnitsConversionHelper.h"
 
 namespace Mantid {
@@ -82,6 +83,9 @@ size_t ConvToMDEventsWS::conversionChunk(size_t workspaceIndex) {
   case Mantid::API::WEIGHTED_NOTIME:
     return this->convertEventList<Mantid::DataObjects::WeightedEventNoTime>(
         workspaceIndex);
+  case Mantid::API::COMPACT_WEIGHTED_NOTIME:
+    return this->convertEventList<
+        Mantid::DataObjects::CompactWeightedEventNoTime>(workspaceIndex);
   default:
     throw std::runtime_error("EventList had an unexpected data type!");
   }
@@ -125,7 +129,7 @@ void ConvToMDEventsWS::runConversion(API::Progress *pProgress) {
   size_t nValidSpectra = m_NSpectra;
 
   //--->>> Thread control stuff
-  Kernel::ThreadSchedulerFIFO *ts(nullptr);
+  Kernel::ThreadScheduler *ts(nullptr);
 
   int nThreads(m_NumThreads);
   if (nThreads < 0)
@@ -135,8 +139,9 @@ void ConvToMDEventsWS::runConversion(API::Progress *pProgress) {
   if (m_NumThreads != 0) {
     runMultithreaded = true;
     // Create the thread pool that will run all of these. It will be deleted by
-    // the threadpool
-    ts = new Kernel::ThreadSchedulerFIFO();
+    // the threadpool. Splitting boxes creates many small tasks that create
+    // further tasks, which a work-stealing scheduler handles best.
+    ts = new Kernel::ThreadSchedulerWorkStealing(static_cast<size_t>(nThreads));
     // it will initiate thread pool with number threads or machine's cores (0 in
     // tp constructor)
     pProgress->resetNumSteps(nValidSpectra, 0, 1);
@@ -173,6 +178,7 @@ void ConvToMDEventsWS::runConversion(API::Progress *pProgress) {
                          ->getBoxController()
                          ->getTotalNumMDBoxes();
       eventsAdded = 0;
+      writeOutFullBuffer(*bc);
       pProgress->report(wi);
     }
   }
@@ -228,6 +228,7 @@ void ConvToMDHistoWS::runConversion(API::Progress *pProgress) {
       // Count the new # of boxes.
       lastNumBoxes = bc->getTotalNumMDBoxes();
       nAddedEvents = 0;
+      writeOutFullBuffer(*bc);
       pProgress->report(i, "Adding Events");
     }
     // TODO::
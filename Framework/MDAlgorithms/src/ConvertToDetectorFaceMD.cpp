@@ -302,6 +302,14 @@ void ConvertToDetectorFaceMD::exec() {
             this->convertEventList<WeightedEventNoTime, MDEvent<4>, 4>(
                 outWS4, wi, xPos, yPos, bankPos, runIndex, detID);
           break;
+        case COMPACT_WEIGHTED_NOTIME:
+          if (nd == 3)
+            this->convertEventList<CompactWeightedEventNoTime, MDEvent<3>, 3>(
+                outWS3, wi, xPos, yPos, bankPos, runIndex, detID);
+          else if (nd == 4)
+            this->convertEventList<CompactWeightedEventNoTime, MDEvent<4>, 4>(
+                outWS4, wi, xPos, yPos, bankPos, runIndex, detID);
+          break;
         default:
           throw std::runtime_error("EventList had an unexpected data type!");
         }
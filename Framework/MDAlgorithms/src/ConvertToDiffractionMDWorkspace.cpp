@@ -153,6 +153,10 @@ void ConvertToDiffractionMDWorkspace::convertSpectrum(
     case WEIGHTED_NOTIME:
       this->convertEventList<WeightedEventNoTime>(workspaceIndex, specInfo, el);
       break;
+    case COMPACT_WEIGHTED_NOTIME:
+      this->convertEventList<CompactWeightedEventNoTime>(workspaceIndex,
+                                                         specInfo, el);
+      break;
     default:
       throw std::runtime_error("EventList had an unexpected data type!");
     }
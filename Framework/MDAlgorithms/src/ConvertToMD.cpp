@@ -112,6 +112,16 @@ void ConvertToMD::init() {
                   "will create the specified file in addition to an output "
                   "workspace. The workspace will load data from the file on "
                   "demand in order to reduce memory use.");
+
+  declareProperty(
+      make_unique<PropertyWithValue<double>>("Memory", -1),
+      "For FileBackEnd only: the amount of memory (in MB) to allocate to the "
+      "events waiting to be written to the file. The events are written out "
+      "while they are converted, so the conversion of a large run needs about "
+      "this much memory for its events.\n"
+      "If not specified, a buffer of one million events is used.");
+  setPropertySettings("Memory", make_unique<EnabledWhenProperty>(
+                                    "FileBackEnd", IS_EQUAL_TO, "1"));
 }
 //----------------------------------------------------------------------------------------------
 
@@ -744,9 +754,26 @@ void ConvertToMD::setupFileBackend(
   auto boxControllerMem = outputWS->getBoxController();
   auto boxControllerIO =
       boost::make_shared<BoxControllerNeXusIO>(boxControllerMem.get());
+  boxControllerIO->setDataType(sizeof(coord_t), outputWS->getEventTypeName());
   boxControllerMem->setFileBacked(boxControllerIO, filebackPath);
   outputWS->setFileBacked();
-  boxControllerMem->getFileIO()->setWriteBufferSize(1000000);
+
+  // Express the memory for the events waiting to be written in units of
+  // number of events. The boxes are split and written out as the events are
+  // added, so this bounds the memory used by the conversion.
+  uint64_t cacheMemory(1000000);
+  const double mb = getProperty("Memory");
+  if (mb > 0) {
+    const double eventSize =
+        static_cast<double>(sizeof(coord_t)) *
+        static_cast<double>(boxControllerIO->getNDataColums());
+    cacheMemory = static_cast<uint64_t>((mb * 1024. * 1024.) / eventSize) + 1;
+  }
+  boxControllerMem->getFileIO()->setWriteBufferSize(cacheMemory);
+  g_log.information() << "Setting a DiskBuffer cache size of " << cacheMemory
+                      << " events.\n";
+  // Write boxes out in the background while the conversion carries on
+  boxControllerMem->getFileIO()->startIOThread();
 }
 
 } // namespace MDAlgorithms
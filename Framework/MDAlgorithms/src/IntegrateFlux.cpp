@@ -143,6 +143,10 @@ void IntegrateFlux::integrateSpectra(const API::MatrixWorkspace &inputWS,
       integrateSpectraEvents<DataObjects::WeightedEventNoTime>(*eventWS,
                                                                integrWS);
       return;
+    case (API::COMPACT_WEIGHTED_NOTIME):
+      integrateSpectraEvents<DataObjects::CompactWeightedEventNoTime>(
+          *eventWS, integrWS);
+      return;
     case (API::WEIGHTED):
       integrateSpectraEvents<DataObjects::WeightedEvent>(*eventWS, integrWS);
       return;
@@ -569,6 +569,8 @@ void LoadMD::doLoad(typename MDEventWorkspace<MDE, nd>::sptr ws) {
       g_log.information() << "Setting a DiskBuffer cache size of " << mb
                           << " MB, or " << cacheMemory << " events.\n";
     }
+    // Page boxes in and out in the background
+    bc->getFileIO()->startIOThread();
   } // Not file back end
   else if (!m_BoxStructureAndMethadata) {
     // ---------------------------------------- READ IN THE BOXES
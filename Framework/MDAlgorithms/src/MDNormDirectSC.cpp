@@ -133,6 +133,8 @@ void MDNormDirectSC::init() {
  * Execute the algorithm.
  */
 void MDNormDirectSC::exec() {
+  // The inputs of a previous execution may be gone
+  m_trajectoryCache.clear();
   cacheInputs();
   auto outputWS = binInputWS();
   convention = Kernel::ConfigService::Instance().getString("Q.convention");
@@ -143,6 +145,9 @@ void MDNormDirectSC::exec() {
   setProperty("OutputNormalizationWorkspace", m_normWS);
 
   m_numExptInfos = outputWS->getNumExperimentInfo();
+  // The normalization of all the runs is summed here and added to the
+  // normalization workspace at the end
+  std::vector<std::atomic<signal_t>> signalArray(m_normWS->getNPoints());
   // loop over all experiment infos
   for (uint16_t expInfoIndex = 0; expInfoIndex < m_numExptInfos;
        expInfoIndex++) {
@@ -156,13 +161,22 @@ void MDNormDirectSC::exec() {
     cacheDimensionXValues();
 
     if (!skipNormalization) {
-      calculateNormalization(otherValues, affineTrans, expInfoIndex);
+      calculateNormalization(otherValues, affineTrans, expInfoIndex,
+                             signalArray);
     } else {
       g_log.warning("Binning limits are outside the limits of the MDWorkspace. "
                     "Not applying normalization.");
     }
-    // if more than one experiment info, keep accumulating
-    m_accumulate = true;
+  }
+  if (m_accumulate) {
+    std::transform(signalArray.cbegin(), signalArray.cend(),
+                   m_normWS->getSignalArray(), m_normWS->getSignalArray(),
+                   [](const std::atomic<signal_t> &a, const signal_t &b) {
+                     return a + b;
+                   });
+  } else {
+    std::copy(signalArray.cbegin(), signalArray.cend(),
+              m_normWS->getSignalArray());
   }
 
   // Set the display normalization based on the input workspace
@@ -452,10 +466,12 @@ void MDNormDirectSC::cacheDimensionXValues() {
  * @param otherValues non HKLE dimensions
  * @param affineTrans affine matrix
  * @param expInfoIndex current experiment info index
+ * @param signalArray [InOut] The normalization of this run is added to it
  */
 void MDNormDirectSC::calculateNormalization(
     const std::vector<coord_t> &otherValues,
-    const Kernel::Matrix<coord_t> &affineTrans, uint16_t expInfoIndex) {
+    const Kernel::Matrix<coord_t> &affineTrans, uint16_t expInfoIndex,
+    std::vector<std::atomic<signal_t>> &signalArray) {
   constexpr double energyToK = 8.0 * M_PI * M_PI *
                                PhysicalConstants::NeutronMass *
                                PhysicalConstants::meV * 1e-20 /
@@ -476,53 +492,38 @@ void MDNormDirectSC::calculateNormalization(
   }
   const double protonCharge = currentExptInfo.run().getProtonCharge();
 
-  const auto &spectrumInfo = currentExptInfo.spectrumInfo();
-
-  // Mapping
-  const int64_t ndets = static_cast<int64_t>(spectrumInfo.size());
-  bool haveSA = false;
   API::MatrixWorkspace_const_sptr solidAngleWS =
       getProperty("SolidAngleWorkspace");
-  detid2index_map solidAngDetToIdx;
-  if (solidAngleWS != nullptr) {
-    haveSA = true;
-    solidAngDetToIdx = solidAngleWS->getDetectorIDToWorkspaceIndexMap();
-  }
-
+  // The detector directions and solid angles only need to be recomputed when
+  // the detectors differ from the previous run
+  m_trajectoryCache.update(currentExptInfo, m_samplePos, m_beamDir,
+                           solidAngleWS.get());
+  const auto &trajectories = m_trajectoryCache.trajectories();
+  m_trajectoryCache.reserveThreads(PARALLEL_GET_MAX_THREADS);
+
+  const int64_t ndets = static_cast<int64_t>(trajectories.size());
   const size_t vmdDims = 4;
-  std::vector<std::atomic<signal_t>> signalArray(m_normWS->getNPoints());
-  std::vector<std::array<double, 4>> intersections;
   std::vector<coord_t> pos, posNew;
   double progStep = 0.7 / m_numExptInfos;
   auto prog =
       make_unique<API::Progress>(this, 0.3 + progStep * expInfoIndex,
                                  0.3 + progStep * (expInfoIndex + 1.), ndets);
   // cppcheck-suppress syntaxError
-PRAGMA_OMP(parallel for private(intersections, pos, posNew))
+PRAGMA_OMP(parallel for private(pos, posNew))
 for (int64_t i = 0; i < ndets; i++) {
   PARALLEL_START_INTERUPT_REGION
 
-  if (!spectrumInfo.hasDetectors(i) || spectrumInfo.isMonitor(i) ||
-      spectrumInfo.isMasked(i)) {
-    continue;
-  }
-  const auto &detector = spectrumInfo.detector(i);
-  double theta = detector.getTwoTheta(m_samplePos, m_beamDir);
-  double phi = detector.getPhi();
-  // If the detector is a group, this should be the ID of the first detector
-  const auto detID = detector.getID();
+  const auto &trajectory = trajectories[i];
+  auto &intersections =
+      m_trajectoryCache.intersections(PARALLEL_THREAD_NUMBER);
 
   // Intersections
-  this->calculateIntersections(intersections, theta, phi);
+  this->calculateIntersections(intersections, trajectory.direction);
   if (intersections.empty())
     continue;
 
   // Get solid angle for this contribution
-  double solid = protonCharge;
-  if (haveSA) {
-    solid =
-        solidAngleWS->y(solidAngDetToIdx.find(detID)->second)[0] * protonCharge;
-  }
+  double solid = trajectory.solidAngle * protonCharge;
   // Compute final position in HKL
   // pre-allocate for efficiency and copy non-hkl dim values into place
   pos.resize(vmdDims + otherValues.size() + 1);
@@ -564,15 +565,6 @@ for (int64_t i = 0; i < ndets; i++) {
   PARALLEL_END_INTERUPT_REGION
 }
 PARALLEL_CHECK_INTERUPT_REGION
-if (m_accumulate) {
-  std::transform(
-      signalArray.cbegin(), signalArray.cend(), m_normWS->getSignalArray(),
-      m_normWS->getSignalArray(),
-      [](const std::atomic<signal_t> &a, const signal_t &b) { return a + b; });
-} else {
-  std::copy(signalArray.cbegin(), signalArray.cend(),
-            m_normWS->getSignalArray());
-}
 }
 
 /**
@@ -580,14 +572,13 @@ if (m_accumulate) {
  * surrounding the
  * detector position in HKL
  * @param intersections A list of intersections in HKL space
- * @param theta Polar angle with detector
- * @param phi Azimuthal angle with detector
+ * @param direction Unit vector from the sample to the detector in the beam
+ * frame
  */
 void MDNormDirectSC::calculateIntersections(
-    std::vector<std::array<double, 4>> &intersections, const double theta,
-    const double phi) {
-  V3D qout(sin(theta) * cos(phi), sin(theta) * sin(phi), cos(theta)),
-      qin(0., 0., m_ki);
+    std::vector<std::array<double, 4>> &intersections,
+    const Kernel::V3D &direction) {
+  V3D qout(direction), qin(0., 0., m_ki);
 
   qout = m_rubw * qout;
   qin = m_rubw * qin;
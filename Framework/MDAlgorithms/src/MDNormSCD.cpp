@@ -135,6 +135,8 @@ void MDNormSCD::init() {
  * Execute the algorithm.
  */
 void MDNormSCD::exec() {
+  // The inputs of a previous execution may be gone
+  m_trajectoryCache.clear();
   cacheInputs();
   auto outputWS = binInputWS();
   convention = Kernel::ConfigService::Instance().getString("Q.convention");
@@ -145,6 +147,9 @@ void MDNormSCD::exec() {
   setProperty("OutputNormalizationWorkspace", m_normWS);
 
   m_numExptInfos = outputWS->getNumExperimentInfo();
+  // The normalization of all the runs is summed here and added to the
+  // normalization workspace at the end
+  std::vector<std::atomic<signal_t>> signalArray(m_normWS->getNPoints());
   // loop over all experiment infos
   for (uint16_t expInfoIndex = 0; expInfoIndex < m_numExptInfos;
        expInfoIndex++) {
@@ -158,12 +163,22 @@ void MDNormSCD::exec() {
     cacheDimensionXValues();
 
     if (!skipNormalization) {
-      calculateNormalization(otherValues, affineTrans, expInfoIndex);
+      calculateNormalization(otherValues, affineTrans, expInfoIndex,
+                             signalArray);
     } else {
       g_log.warning("Binning limits are outside the limits of the MDWorkspace. "
                     "Not applying normalization.");
     }
-    m_accumulate = true;
+  }
+  if (m_accumulate) {
+    std::transform(signalArray.cbegin(), signalArray.cend(),
+                   m_normWS->getSignalArray(), m_normWS->getSignalArray(),
+                   [](const std::atomic<signal_t> &a, const signal_t &b) {
+                     return a + b;
+                   });
+  } else {
+    std::copy(signalArray.cbegin(), signalArray.cend(),
+              m_normWS->getSignalArray());
   }
 }
 
@@ -402,10 +417,12 @@ void MDNormSCD::cacheDimensionXValues() {
  * @param otherValues
  * @param affineTrans
  * @param expInfoIndex current experiment info index
+ * @param signalArray [InOut] The normalization of this run is added to it
  */
 void MDNormSCD::calculateNormalization(
     const std::vector<coord_t> &otherValues,
-    const Kernel::Matrix<coord_t> &affineTrans, uint16_t expInfoIndex) {
+    const Kernel::Matrix<coord_t> &affineTrans, uint16_t expInfoIndex,
+    std::vector<std::atomic<signal_t>> &signalArray) {
   API::MatrixWorkspace_const_sptr integrFlux = getProperty("FluxWorkspace");
   integrFlux->getXMinMax(m_kiMin, m_kiMax);
   API::MatrixWorkspace_const_sptr solidAngleWS =
@@ -427,18 +444,15 @@ void MDNormSCD::calculateNormalization(
   }
   const double protonCharge = currentExptInfo.run().getProtonCharge();
 
-  const auto &spectrumInfo = currentExptInfo.spectrumInfo();
-
-  // Mappings
-  const int64_t ndets = static_cast<int64_t>(spectrumInfo.size());
-  const detid2index_map fluxDetToIdx =
-      integrFlux->getDetectorIDToWorkspaceIndexMap();
-  const detid2index_map solidAngDetToIdx =
-      solidAngleWS->getDetectorIDToWorkspaceIndexMap();
+  // The detector directions, solid angles and flux indices only need to be
+  // recomputed when the detectors differ from the previous run
+  m_trajectoryCache.update(currentExptInfo, m_samplePos, m_beamDir,
+                           solidAngleWS.get(), integrFlux.get());
+  const auto &trajectories = m_trajectoryCache.trajectories();
+  m_trajectoryCache.reserveThreads(PARALLEL_GET_MAX_THREADS);
 
+  const int64_t ndets = static_cast<int64_t>(trajectories.size());
   const size_t vmdDims = 4;
-  std::vector<std::atomic<signal_t>> signalArray(m_normWS->getNPoints());
-  std::vector<std::array<double, 4>> intersections;
   std::vector<double> xValues, yValues;
   std::vector<coord_t> pos, posNew;
   double progStep = 0.7 / m_numExptInfos;
@@ -446,30 +460,23 @@ void MDNormSCD::calculateNormalization(
       make_unique<API::Progress>(this, 0.3 + progStep * expInfoIndex,
                                  0.3 + progStep * (expInfoIndex + 1.), ndets);
   // cppcheck-suppress syntaxError
-PRAGMA_OMP(parallel for private(intersections, xValues, yValues, pos, posNew) if (Kernel::threadSafe(*integrFlux)))
+PRAGMA_OMP(parallel for private(xValues, yValues, pos, posNew) if (Kernel::threadSafe(*integrFlux)))
 for (int64_t i = 0; i < ndets; i++) {
   PARALLEL_START_INTERUPT_REGION
 
-  if (!spectrumInfo.hasDetectors(i) || spectrumInfo.isMonitor(i) ||
-      spectrumInfo.isMasked(i)) {
-    continue;
-  }
-  const auto &detector = spectrumInfo.detector(i);
-  double theta = detector.getTwoTheta(m_samplePos, m_beamDir);
-  double phi = detector.getPhi();
-  // If the dtefctor is a group, this should be the ID of the first detector
-  const auto detID = detector.getID();
+  const auto &trajectory = trajectories[i];
+  auto &intersections =
+      m_trajectoryCache.intersections(PARALLEL_THREAD_NUMBER);
 
   // Intersections
-  this->calculateIntersections(intersections, theta, phi);
+  this->calculateIntersections(intersections, trajectory.direction);
   if (intersections.empty())
     continue;
 
   // get the flux spetrum number
-  size_t wsIdx = fluxDetToIdx.find(detID)->second;
+  size_t wsIdx = trajectory.fluxIndex;
   // Get solid angle for this contribution
-  double solid =
-      solidAngleWS->y(solidAngDetToIdx.find(detID)->second)[0] * protonCharge;
+  double solid = trajectory.solidAngle * protonCharge;
 
   // -- calculate integrals for the intersection --
   // momentum values at intersections
@@ -523,15 +530,6 @@ for (int64_t i = 0; i < ndets; i++) {
   PARALLEL_END_INTERUPT_REGION
 }
 PARALLEL_CHECK_INTERUPT_REGION
-if (m_accumulate) {
-  std::transform(
-      signalArray.cbegin(), signalArray.cend(), m_normWS->getSignalArray(),
-      m_normWS->getSignalArray(),
-      [](const std::atomic<signal_t> &a, const signal_t &b) { return a + b; });
-} else {
-  std::copy(signalArray.cbegin(), signalArray.cend(),
-            m_normWS->getSignalArray());
-}
 }
 
 /**
@@ -615,13 +613,13 @@ void MDNormSCD::calcIntegralsForIntersections(
  * surrounding the
  * detector position in HKL
  * @param intersections A list of intersections in HKL space
- * @param theta Polar angle withd detector
- * @param phi Azimuthal angle with detector
+ * @param direction Unit vector from the sample to the detector in the beam
+ * frame
  */
 void MDNormSCD::calculateIntersections(
-    std::vector<std::array<double, 4>> &intersections, const double theta,
-    const double phi) {
-  V3D q(-sin(theta) * cos(phi), -sin(theta) * sin(phi), 1. - cos(theta));
+    std::vector<std::array<double, 4>> &intersections,
+    const Kernel::V3D &direction) {
+  V3D q(-direction.X(), -direction.Y(), 1. - direction.Z());
   q = m_rubw * q;
   if (convention == "Crystallography") {
     q *= -1;
@@ -0,0 +1,151 @@
+#include "MantidMDAlgorithms/MDNormTrajectoryCache.h"
+#include "MantidAPI/ExperimentInfo.h"
+#include "MantidAPI/MatrixWorkspace.h"
+#include "MantidAPI/SpectrumInfo.h"
+#include "MantidGeometry/IDetector.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+
+namespace Mantid {
+namespace MDAlgorithms {
+
+namespace {
+/**
+ * Find the workspace index of a detector
+ * @param detToIndex A map of detector IDs to workspace indices
+ * @param detID The ID of the detector
+ * @param wsName Name of the workspace property, for the error message
+ * @return The workspace index
+ */
+size_t workspaceIndex(const detid2index_map &detToIndex, const detid_t detID,
+                      const std::string &wsName) {
+  const auto index = detToIndex.find(detID);
+  if (index == detToIndex.end()) {
+    throw std::invalid_argument("Detector " + std::to_string(detID) +
+                                " has no spectrum in the " + wsName + ".");
+  }
+  return index->second;
+}
+} // namespace
+
+/**
+ * Recompute the trajectories if the given experiment info does not have the
+ * same detectors as the one they were computed from
+ * @param exptInfo The experiment info of the current run
+ * @param samplePos The position of the sample
+ * @param beamDir The unit vector along the beam
+ * @param solidAngleWS A workspace with the solid angle of each detector in
+ * its first bin. Optional
+ * @param fluxWS A workspace with the flux spectra. Optional
+ * @return True if the trajectories were recomputed
+ */
+bool MDNormTrajectoryCache::update(const API::ExperimentInfo &exptInfo,
+                                   const Kernel::V3D &samplePos,
+                                   const Kernel::V3D &beamDir,
+                                   const API::MatrixWorkspace *solidAngleWS,
+                                   const API::MatrixWorkspace *fluxWS) {
+  if (isValidFor(exptInfo, solidAngleWS, fluxWS))
+    return false;
+
+  detid2index_map solidAngDetToIdx, fluxDetToIdx;
+  if (solidAngleWS)
+    solidAngDetToIdx = solidAngleWS->getDetectorIDToWorkspaceIndexMap();
+  if (fluxWS)
+    fluxDetToIdx = fluxWS->getDetectorIDToWorkspaceIndexMap();
+
+  const auto &spectrumInfo = exptInfo.spectrumInfo();
+  m_trajectories.clear();
+  m_trajectories.reserve(spectrumInfo.size());
+  for (size_t i = 0; i < spectrumInfo.size(); ++i) {
+    if (!spectrumInfo.hasDetectors(i) || spectrumInfo.isMonitor(i) ||
+        spectrumInfo.isMasked(i)) {
+      continue;
+    }
+    const auto &detector = spectrumInfo.detector(i);
+    const double theta = detector.getTwoTheta(samplePos, beamDir);
+    const double phi = detector.getPhi();
+    // If the detector is a group, this should be the ID of the first detector
+    const auto detID = detector.getID();
+
+    Trajectory trajectory;
+    trajectory.direction = Kernel::V3D(sin(theta) * cos(phi),
+                                       sin(theta) * sin(phi), cos(theta));
+    trajectory.solidAngle = 1.0;
+    if (solidAngleWS) {
+      trajectory.solidAngle = solidAngleWS->y(workspaceIndex(
+          solidAngDetToIdx, detID, "SolidAngleWorkspace"))[0];
+    }
+    trajectory.fluxIndex = 0;
+    if (fluxWS) {
+      trajectory.fluxIndex =
+          workspaceIndex(fluxDetToIdx, detID, "FluxWorkspace");
+    }
+    m_trajectories.push_back(trajectory);
+  }
+  m_detectorInfo = &exptInfo.detectorInfo();
+  m_spectrumDefinitions = spectrumInfo.sharedSpectrumDefinitions();
+  m_solidAngleWS = solidAngleWS;
+  m_fluxWS = fluxWS;
+  return true;
+}
+
+/**
+ * Forget the trajectories and the detectors and workspaces they were
+ * computed from. To be called before the cache is used for new inputs, as
+ * those are only referred to by address.
+ */
+void MDNormTrajectoryCache::clear() {
+  m_detectorInfo = nullptr;
+  m_spectrumDefinitions =
+      Kernel::cow_ptr<std::vector<SpectrumDefinition>>(nullptr);
+  m_solidAngleWS = nullptr;
+  m_fluxWS = nullptr;
+  m_trajectories.clear();
+}
+
+/**
+ * Returns the intersection buffer of a thread. The buffer keeps its capacity
+ * between runs.
+ * @param thread The number of the thread
+ * @return A reference to the buffer
+ */
+std::vector<std::array<double, 4>> &
+MDNormTrajectoryCache::intersections(const int thread) {
+  return m_intersections[static_cast<size_t>(thread)];
+}
+
+/**
+ * Make sure there is an intersection buffer for each thread. Must be called
+ * outside of a parallel region.
+ * @param nthreads The maximum number of threads
+ */
+void MDNormTrajectoryCache::reserveThreads(const int nthreads) {
+  if (m_intersections.size() < static_cast<size_t>(nthreads))
+    m_intersections.resize(static_cast<size_t>(nthreads));
+}
+
+/**
+ * Check whether the trajectories were computed from the same detectors and
+ * workspaces
+ * @param exptInfo The experiment info of the current run
+ * @param solidAngleWS The solid angle workspace
+ * @param fluxWS The flux workspace
+ * @return True if the cached trajectories can be used for exptInfo
+ */
+bool MDNormTrajectoryCache::isValidFor(
+    const API::ExperimentInfo &exptInfo,
+    const API::MatrixWorkspace *solidAngleWS,
+    const API::MatrixWorkspace *fluxWS) const {
+  if (!m_detectorInfo || solidAngleWS != m_solidAngleWS || fluxWS != m_fluxWS)
+    return false;
+  // Positions, rotations, masking and monitor flags
+  if (!exptInfo.detectorInfo().isEquivalent(*m_detectorInfo))
+    return false;
+  // Grouping of the detectors into spectra
+  const auto &spectrumDefinitions =
+      exptInfo.spectrumInfo().sharedSpectrumDefinitions();
+  return spectrumDefinitions == m_spectrumDefinitions ||
+         *spectrumDefinitions == *m_spectrumDefinitions;
+}
+
+} // namespace MDAlgorithms
+} // namespace Mantid
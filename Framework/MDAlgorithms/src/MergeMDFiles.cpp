@@ -4,7 +4,9 @@
 #include "MantidDataObjects/BoxControllerNeXusIO.h"
 #include "MantidDataObjects/MDBoxBase.h"
 #include "MantidDataObjects/MDEventFactory.h"
+#include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/CPUTimer.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/System.h"
 #include "MantidKernel/VectorHelper.h"
@@ -12,6 +14,12 @@
 #include <Poco/File.h>
 #include <boost/scoped_ptr.hpp>
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <thread>
+
 using namespace Mantid::Kernel;
 using namespace Mantid::API;
 using namespace Mantid::DataObjects;
@@ -22,6 +30,169 @@ namespace MDAlgorithms {
 // Register the algorithm into the AlgorithmFactory
 DECLARE_ALGORITHM(MergeMDFiles)
 
+namespace {
+/// Number of windows of boxes the reader may have read ahead of the merge
+const size_t WINDOWS_READ_AHEAD = 2;
+
+/** Reads the events of all of the input files on a thread of its own, for
+ * consecutive windows of target boxes. The files are read one after another
+ * for each window, with as few block reads as the layout of each file allows,
+ * i.e. with one read if the boxes are stored one after another, and split
+ * into a table per box.
+ */
+class WindowEventReader {
+public:
+  /// The events of each box of a window, from one file
+  using BoxEvents = std::vector<std::vector<coord_t>>;
+
+  /**
+   * @param loaders :: the opened input files
+   * @param eventIndexes :: file position and number of events of each box ID,
+   * for each file
+   * @param boxIDs :: IDs of the boxes to read, in merge order
+   * @param windowStarts :: index into boxIDs of the first box of each window,
+   * followed by the number of boxes
+   * @param ioMutex :: held while reading; the NeXus files must not be used
+   * from several threads at once
+   */
+  WindowEventReader(
+      const std::vector<API::IBoxControllerIO *> &loaders,
+      const std::vector<const std::vector<uint64_t> *> &eventIndexes,
+      const std::vector<size_t> &boxIDs,
+      const std::vector<size_t> &windowStarts, std::mutex &ioMutex)
+      : m_loaders(loaders), m_eventIndexes(eventIndexes), m_boxIDs(boxIDs),
+        m_windowStarts(windowStarts), m_ioMutex(ioMutex), m_stop(false),
+        m_thread(&WindowEventReader::run, this) {}
+
+  ~WindowEventReader() {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stop = true;
+    }
+    m_condition.notify_all();
+    m_thread.join();
+  }
+
+  /// Wait for the events of the next window, one entry per file, and take
+  /// them from the reader
+  std::vector<BoxEvents> next() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_condition.wait(lock, [this] { return !m_ready.empty() || m_error; });
+    if (m_ready.empty())
+      std::rethrow_exception(m_error);
+    std::vector<BoxEvents> events = std::move(m_ready.front());
+    m_ready.pop_front();
+    lock.unlock();
+    m_condition.notify_all();
+    return events;
+  }
+
+private:
+  /// Body of the reader thread
+  void run() {
+    try {
+      for (size_t iw = 0; iw + 1 < m_windowStarts.size(); ++iw) {
+        {
+          std::unique_lock<std::mutex> lock(m_mutex);
+          m_condition.wait(lock, [this] {
+            return m_stop || m_ready.size() < WINDOWS_READ_AHEAD;
+          });
+          if (m_stop)
+            return;
+        }
+        std::vector<BoxEvents> events(m_loaders.size());
+        for (size_t file = 0; file < m_loaders.size(); ++file)
+          events[file] =
+              readWindow(file, m_windowStarts[iw], m_windowStarts[iw + 1]);
+        {
+          std::lock_guard<std::mutex> lock(m_mutex);
+          m_ready.push_back(std::move(events));
+        }
+        m_condition.notify_all();
+      }
+    } catch (...) {
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_error = std::current_exception();
+      }
+      m_condition.notify_all();
+    }
+  }
+
+  /// Read the events of the boxes [first, end) of the merge order from a file
+  BoxEvents readWindow(const size_t file, const size_t first,
+                       const size_t end) const {
+    const std::vector<uint64_t> &eventIndex = *m_eventIndexes[file];
+    // (file position, number of events, box in window) of each box to read
+    struct Segment {
+      uint64_t position;
+      uint64_t nEvents;
+      size_t box;
+    };
+    std::vector<Segment> segments;
+    for (size_t ib = first; ib < end; ++ib) {
+      const size_t ID = m_boxIDs[ib];
+      if (eventIndex[2 * ID + 1] > 0)
+        segments.push_back(
+            {eventIndex[2 * ID], eventIndex[2 * ID + 1], ib - first});
+    }
+    std::sort(segments.begin(), segments.end(),
+              [](const Segment &a, const Segment &b) {
+                return a.position < b.position;
+              });
+
+    BoxEvents events(end - first);
+    std::vector<coord_t> block;
+    auto runBegin = segments.begin();
+    while (runBegin != segments.end()) {
+      // Find the boxes stored one after another from here
+      auto runEnd = runBegin + 1;
+      uint64_t runEvents = runBegin->nEvents;
+      while (runEnd != segments.end() &&
+             runEnd->position == runBegin->position + runEvents) {
+        runEvents += runEnd->nEvents;
+        ++runEnd;
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(m_ioMutex);
+        m_loaders[file]->loadBlock(block, runBegin->position,
+                                   static_cast<size_t>(runEvents));
+      }
+      if (runEnd - runBegin == 1) {
+        events[runBegin->box].swap(block);
+      } else {
+        const size_t nColumns = block.size() / runEvents;
+        for (auto segment = runBegin; segment != runEnd; ++segment) {
+          auto start = block.begin() +
+                       (segment->position - runBegin->position) * nColumns;
+          events[segment->box].assign(start,
+                                      start + segment->nEvents * nColumns);
+        }
+      }
+      runBegin = runEnd;
+    }
+    return events;
+  }
+
+  const std::vector<API::IBoxControllerIO *> &m_loaders;
+  const std::vector<const std::vector<uint64_t> *> &m_eventIndexes;
+  const std::vector<size_t> &m_boxIDs;
+  const std::vector<size_t> &m_windowStarts;
+  std::mutex &m_ioMutex;
+  /// Windows read and not yet taken by next()
+  std::deque<std::vector<BoxEvents>> m_ready;
+  /// Set to stop the reader early
+  bool m_stop;
+  /// An exception thrown on the reader thread
+  std::exception_ptr m_error;
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  /// Declared last so that it starts after the other members are constructed
+  std::thread m_thread;
+};
+} // namespace
+
 //----------------------------------------------------------------------------------------------
 /** Constructor
  */
@@ -54,9 +225,18 @@ void MergeMDFiles::init() {
       "If not, it will be created in memory.");
 
   declareProperty("Parallel", false,
-                  "Run the loading tasks in parallel.\n"
+                  "Stream the events of the files from a background "
+                  "reader thread and merge several boxes at once.\n"
                   "This can be faster but might use more memory.");
 
+  auto mustBePositive = boost::make_shared<BoundedValidator<int>>();
+  mustBePositive->setLower(1);
+  declareProperty("MaxEventsInMemory", 10000000, mustBePositive,
+                  "Used with Parallel. The number of events from all of the "
+                  "files merged at once. The reader holds up to two more such "
+                  "windows of boxes read ahead of the merge. A box with more "
+                  "events is merged on its own.");
+
   declareProperty(make_unique<WorkspaceProperty<IMDEventWorkspace>>(
                       "OutputWorkspace", "", Direction::Output),
                   "An output MDEventWorkspace.");
@@ -196,9 +376,6 @@ void MergeMDFiles::doExecByCloning(Mantid::API::IMDEventWorkspace_sptr ws,
   m_OutIWS = ws;
   m_MDEventType = ws->getEventTypeName();
 
-  // Run the tasks in parallel? TODO: enable
-  // bool Parallel = this->getProperty("Parallel");
-
   // Fix the box controller settings in the output workspace so that it splits
   // normally
   BoxController_sptr bc = ws->getBoxController();
@@ -234,65 +411,40 @@ void MergeMDFiles::doExecByCloning(Mantid::API::IMDEventWorkspace_sptr ws,
   m_progress = Kernel::make_unique<Progress>(this, 0.1, 0.9, size_t(numBoxes));
   m_progress->setNotifyStep(0.1);
 
-  // For tracking progress
-  // uint64_t m_totalEventsInTasks = 0;
-
-  // Prepare thread pool
   CPUTimer overallTime;
 
-  auto ts = new ThreadSchedulerFIFO();
-  ThreadPool tp(ts);
-
   Kernel::DiskBuffer *DiskBuf(nullptr);
   if (m_fileBasedTargetWS) {
     DiskBuf = bc->getFileIO();
   }
 
   this->m_totalLoaded = 0;
-  std::vector<API::IMDNode *> &boxes = m_BoxStruct.getBoxes();
-
-  for (size_t ib = 0; ib < numBoxes; ib++) {
-    auto box = boxes[ib];
-    if (!box->isBox())
-      continue;
-    // load all contributed events into current box;
-    this->loadEventsFromSubBoxes(boxes[ib]);
-
-    if (DiskBuf) {
-      if (box->getDataInMemorySize() >
-          0) { // data position has been already pre-calculated
-        box->getISaveable()->save();
-        box->clearDataFromMemory();
-        // Kernel::ISaveable *Saver = box->getISaveable();
-        // DiskBuf->toWrite(Saver);
+  const bool parallel = this->getProperty("Parallel");
+  if (parallel) {
+    this->mergeBoxesStreaming(DiskBuf);
+  } else {
+    std::vector<API::IMDNode *> &boxes = m_BoxStruct.getBoxes();
+    for (size_t ib = 0; ib < numBoxes; ib++) {
+      auto box = boxes[ib];
+      if (!box->isBox())
+        continue;
+      // load all contributed events into current box;
+      this->loadEventsFromSubBoxes(boxes[ib]);
+
+      if (DiskBuf) {
+        if (box->getDataInMemorySize() >
+            0) { // data position has been already pre-calculated
+          box->getISaveable()->save();
+          box->clearDataFromMemory();
+        }
       }
+      m_progress->reportIncrement(ib, "Loading and merging box data");
     }
-    // else
-    //{   size_t ID = box->getID();
-    //    uint64_t filePosition = targetEventIndexes[2*ID];
-    //    box->saveAt(saver.get(), filePosition);
-    //}
-    //
-    // if (!Parallel)
-    //{
-    //  // Run the task serially only
-    //  task->run();
-    //  delete task;
-    //}
-    // else
-    //{
-    //  // Enqueue to run in parallel (at the joinAll() call below).
-    //  ts->push(task);
-    //}
-
-    m_progress->reportIncrement(ib, "Loading and merging box data");
   }
   if (DiskBuf) {
     DiskBuf->flushCache();
     bc->getFileIO()->flushData();
   }
-  //// Run any final tasks
-  // tp.joinAll();
   g_log.information() << overallTime << " to do all the adding.\n";
 
   // Close any open file handle
@@ -302,6 +454,86 @@ void MergeMDFiles::doExecByCloning(Mantid::API::IMDEventWorkspace_sptr ws,
   this->finalizeOutput(outputFile);
 }
 
+//----------------------------------------------------------------------------------------------
+/** Merge the boxes in windows of consecutive boxes, holding a bounded number
+ * of events. The events of the input files are read sequentially by a reader
+ * thread, ahead of the merge, while the boxes of a window are filled in
+ * parallel and then saved to the output file.
+ *
+ * @param diskBuf :: the disk buffer of the file-backed output workspace, or
+ * nullptr if the output is in memory
+ */
+void MergeMDFiles::mergeBoxesStreaming(Kernel::DiskBuffer *diskBuf) {
+  std::vector<API::IMDNode *> &allBoxes = m_BoxStruct.getBoxes();
+  const std::vector<uint64_t> &targetEventIndexes = m_BoxStruct.getEventIndex();
+  const int maxEventsInMemory = this->getProperty("MaxEventsInMemory");
+  const auto maxEvents = static_cast<uint64_t>(maxEventsInMemory);
+
+  // Split the boxes holding events into windows, in the order of the output
+  std::vector<API::IMDNode *> boxes;
+  std::vector<size_t> boxIDs;
+  std::vector<size_t> windowStarts;
+  uint64_t windowEvents(0);
+  for (auto box : allBoxes) {
+    if (!box->isBox())
+      continue;
+    const size_t ID = box->getID();
+    const uint64_t nEvents = targetEventIndexes[2 * ID + 1];
+    if (windowStarts.empty() || windowEvents + nEvents > maxEvents) {
+      windowStarts.push_back(boxes.size());
+      windowEvents = 0;
+    }
+    boxes.push_back(box);
+    boxIDs.push_back(ID);
+    windowEvents += nEvents;
+  }
+  windowStarts.push_back(boxes.size());
+
+  std::vector<const std::vector<uint64_t> *> eventIndexes;
+  for (auto &fileStructure : m_fileComponentsStructure)
+    eventIndexes.push_back(&fileStructure.getEventIndex());
+  // Serialises the reads of the input files with the writes of the output
+  std::mutex ioMutex;
+  WindowEventReader reader(m_EventLoader, eventIndexes, boxIDs, windowStarts,
+                           ioMutex);
+
+  for (size_t window = 0; window + 1 < windowStarts.size(); ++window) {
+    std::vector<WindowEventReader::BoxEvents> fileEvents = reader.next();
+
+    const size_t first = windowStarts[window];
+    const auto nWindowBoxes =
+        static_cast<int64_t>(windowStarts[window + 1] - first);
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t i = 0; i < nWindowBoxes; ++i) {
+      PARALLEL_START_INTERUPT_REGION
+      auto box = boxes[first + i];
+      box->clear();
+      box->reserveMemoryForLoad(targetEventIndexes[2 * boxIDs[first + i] + 1]);
+      for (auto &events : fileEvents) {
+        if (events[i].empty())
+          continue;
+        box->addEventsData(events[i]);
+        std::vector<coord_t>().swap(events[i]);
+      }
+      PARALLEL_END_INTERUPT_REGION
+    }
+    PARALLEL_CHECK_INTERUPT_REGION
+
+    if (diskBuf) {
+      std::lock_guard<std::mutex> lock(ioMutex);
+      for (int64_t i = 0; i < nWindowBoxes; ++i) {
+        auto box = boxes[first + i];
+        if (box->getDataInMemorySize() > 0) {
+          box->getISaveable()->save();
+          box->clearDataFromMemory();
+        }
+      }
+    }
+    m_progress->reportIncrement(static_cast<size_t>(nWindowBoxes),
+                                "Loading and merging box data");
+  }
+}
+
 //----------------------------------------------------------------------------------------------
 /** Now re-save the MDEventWorkspace to update the file back end */
 void MergeMDFiles::finalizeOutput(const std::string &outputFile) {
@@ -292,6 +292,44 @@ public:
                  true /*IterateEvents*/, 20 /*numEventsPerBox*/, VMD(0, 0, 1));
   }
 
+  void test_exec_parallel_gives_same_result_as_serial() {
+    Mantid::Geometry::QSample frame;
+    IMDEventWorkspace_sptr in_ws =
+        MDEventsTestHelper::makeAnyMDEWWithFrames<MDLeanEvent<3>, 3>(
+            10, 0.0, 10.0, frame, 10);
+
+    std::vector<MDHistoWorkspace_sptr> outputs;
+    for (const bool parallel : {false, true}) {
+      BinMD alg;
+      alg.setChild(true);
+      alg.setRethrows(true);
+      alg.initialize();
+      alg.setProperty("InputWorkspace", in_ws);
+      alg.setPropertyValue("AlignedDim0", "Axis0,1.0,8.0, 7");
+      alg.setPropertyValue("AlignedDim1", "Axis1,2.0,8.0, 9");
+      alg.setPropertyValue("AlignedDim2", "Axis2,0.0,10.0, 4");
+      alg.setProperty("Parallel", parallel);
+      alg.setPropertyValue("OutputWorkspace", "dummy");
+      TS_ASSERT_THROWS_NOTHING(alg.execute());
+      MDHistoWorkspace_sptr out = alg.getProperty("OutputWorkspace");
+      outputs.push_back(out);
+    }
+
+    TS_ASSERT_EQUALS(outputs[0]->getNPoints(), outputs[1]->getNPoints());
+    double total = 0;
+    for (size_t i = 0; i < outputs[0]->getNPoints(); i++) {
+      TS_ASSERT_DELTA(outputs[1]->getSignalAt(i), outputs[0]->getSignalAt(i),
+                      1e-5);
+      TS_ASSERT_DELTA(outputs[1]->getErrorAt(i), outputs[0]->getErrorAt(i),
+                      1e-5);
+      TS_ASSERT_DELTA(outputs[1]->getNumEventsAt(i),
+                      outputs[0]->getNumEventsAt(i), 1e-5);
+      total += outputs[0]->getSignalAt(i);
+    }
+    // 10 events in each of the 7x6x10 boxes within the region
+    TS_ASSERT_DELTA(total, 4200.0, 1e-5);
+  }
+
   bool etta(int x, int base) {
     int ii = x - base / 2;
     if (ii < 0)
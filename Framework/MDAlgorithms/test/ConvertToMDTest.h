@@ -530,6 +530,86 @@ public:
     }
   }
 
+  void test_execute_filebackend_with_small_memory_matches_in_memory() {
+    std::string file_name = "convert_to_md_test_small_memory.nxs";
+    if (Poco::File(file_name).exists())
+      Poco::File(file_name).remove();
+    {
+      auto to_events = AlgorithmManager::Instance().createUnmanaged(
+          "ConvertToEventWorkspace");
+      to_events->initialize();
+      to_events->setChild(true);
+      to_events->setProperty("InputWorkspace", createTestWorkspaces());
+      to_events->setPropertyValue("OutputWorkspace", "events");
+      to_events->execute();
+      Mantid::API::MatrixWorkspace_sptr test_workspace =
+          to_events->getProperty("OutputWorkspace");
+
+      Algorithm_sptr min_max_alg = AlgorithmManager::Instance().createUnmanaged(
+          "ConvertToMDMinMaxGlobal");
+      min_max_alg->initialize();
+      min_max_alg->setChild(true);
+      min_max_alg->setProperty("InputWorkspace", test_workspace);
+      min_max_alg->setProperty("QDimensions", "Q3D");
+      min_max_alg->setProperty("dEAnalysisMode", "Direct");
+      min_max_alg->executeAsChildAlg();
+      const std::string min_values =
+          min_max_alg->getPropertyValue("MinValues");
+      const std::string max_values =
+          min_max_alg->getPropertyValue("MaxValues");
+
+      auto convert = [&](bool fileBackEnd, const std::string &fileName) {
+        Algorithm_sptr convert_alg =
+            AlgorithmManager::Instance().createUnmanaged("ConvertToMD");
+        convert_alg->initialize();
+        convert_alg->setChild(true);
+        convert_alg->setProperty("InputWorkspace", test_workspace);
+        convert_alg->setProperty("QDimensions", "Q3D");
+        convert_alg->setProperty("dEAnalysisMode", "Direct");
+        convert_alg->setPropertyValue("MinValues", min_values);
+        convert_alg->setPropertyValue("MaxValues", max_values);
+        convert_alg->setPropertyValue("SplitThreshold", "10");
+        if (fileBackEnd) {
+          convert_alg->setProperty("Filename", fileName);
+          convert_alg->setProperty("FileBackEnd", true);
+          // Room for a few tens of events only, so the boxes are written out
+          // many times during the conversion
+          convert_alg->setProperty("Memory", 0.001);
+        }
+        convert_alg->setProperty("OutputWorkspace", "blank");
+        TS_ASSERT_THROWS_NOTHING(convert_alg->execute());
+        IMDEventWorkspace_sptr out_ws =
+            convert_alg->getProperty("OutputWorkspace");
+        return out_ws;
+      };
+      auto file_ws = convert(true, file_name);
+      auto memory_ws = convert(false, "");
+      TS_ASSERT(file_ws);
+      TS_ASSERT(memory_ws);
+      file_name = file_ws->getBoxController()->getFilename();
+      TS_ASSERT(file_ws->isFileBacked());
+      TS_ASSERT_EQUALS(file_ws->getNPoints(), memory_ws->getNPoints());
+
+      auto compare_alg =
+          Mantid::API::AlgorithmManager::Instance().createUnmanaged(
+              "CompareMDWorkspaces");
+      compare_alg->setChild(true);
+      compare_alg->initialize();
+      compare_alg->setProperty("Workspace1", file_ws);
+      compare_alg->setProperty("Workspace2", memory_ws);
+      compare_alg->setProperty("Tolerance", 0.00001);
+      compare_alg->setProperty("CheckEvents", true);
+      compare_alg->setProperty("IgnoreBoxID", true);
+      TS_ASSERT_THROWS_NOTHING(compare_alg->execute());
+      bool is_equal = compare_alg->getProperty("Equals");
+      TS_ASSERT(is_equal);
+    }
+
+    if (Poco::File(file_name).exists()) {
+      Poco::File(file_name).remove();
+    }
+  }
+
 private:
   void checkHistogramsHaveBeenStored(const std::string &wsName,
                                      double val = 0.34, double bin_min = 0.3,
@@ -0,0 +1,127 @@
+#ifndef MANTID_MDALGORITHMS_MDNORMTRAJECTORYCACHETEST_H_
+#define MANTID_MDALGORITHMS_MDNORMTRAJECTORYCACHETEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/SpectrumInfo.h"
+#include "MantidGeometry/IDetector.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidMDAlgorithms/MDNormTrajectoryCache.h"
+#include "MantidTestHelpers/WorkspaceCreationHelper.h"
+
+using Mantid::MDAlgorithms::MDNormTrajectoryCache;
+using Mantid::Kernel::V3D;
+using namespace Mantid::API;
+
+class MDNormTrajectoryCacheTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MDNormTrajectoryCacheTest *createSuite() {
+    return new MDNormTrajectoryCacheTest();
+  }
+  static void destroySuite(MDNormTrajectoryCacheTest *suite) { delete suite; }
+
+  void test_trajectories_point_at_the_detectors() {
+    auto ws =
+        WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(4, 1);
+    const auto &spectrumInfo = ws->spectrumInfo();
+    MDNormTrajectoryCache cache;
+    TS_ASSERT(cache.update(*ws, m_samplePos, m_beamDir, nullptr));
+
+    const auto &trajectories = cache.trajectories();
+    TS_ASSERT_EQUALS(trajectories.size(), 4);
+    for (size_t i = 0; i < trajectories.size(); ++i) {
+      const auto &detector = spectrumInfo.detector(i);
+      const double theta = detector.getTwoTheta(m_samplePos, m_beamDir);
+      const double phi = detector.getPhi();
+      const V3D &direction = trajectories[i].direction;
+      TS_ASSERT_DELTA(direction.norm(), 1.0, 1e-12);
+      TS_ASSERT_DELTA(direction.Z(), std::cos(theta), 1e-12);
+      TS_ASSERT_DELTA(direction.X(), std::sin(theta) * std::cos(phi), 1e-12);
+      TS_ASSERT_DELTA(direction.Y(), std::sin(theta) * std::sin(phi), 1e-12);
+      TS_ASSERT_EQUALS(trajectories[i].solidAngle, 1.0);
+    }
+  }
+
+  void test_trajectories_are_reused_for_the_same_detectors() {
+    auto ws =
+        WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(4, 1);
+    MatrixWorkspace_sptr other = ws->clone();
+    MDNormTrajectoryCache cache;
+    TS_ASSERT(cache.update(*ws, m_samplePos, m_beamDir, nullptr));
+    TS_ASSERT(!cache.update(*ws, m_samplePos, m_beamDir, nullptr));
+    TS_ASSERT(!cache.update(*other, m_samplePos, m_beamDir, nullptr));
+  }
+
+  void test_trajectories_are_recomputed_after_clear() {
+    auto ws =
+        WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(4, 1);
+    MDNormTrajectoryCache cache;
+    TS_ASSERT(cache.update(*ws, m_samplePos, m_beamDir, nullptr));
+    cache.clear();
+    TS_ASSERT(cache.trajectories().empty());
+    TS_ASSERT(cache.update(*ws, m_samplePos, m_beamDir, nullptr));
+    TS_ASSERT_EQUALS(cache.trajectories().size(), 4);
+  }
+
+  void test_masked_detectors_are_left_out() {
+    auto ws =
+        WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(4, 1);
+    MatrixWorkspace_sptr masked = ws->clone();
+    masked->mutableDetectorInfo().setMasked(1, true);
+    MDNormTrajectoryCache cache;
+    cache.update(*ws, m_samplePos, m_beamDir, nullptr);
+    TS_ASSERT(cache.update(*masked, m_samplePos, m_beamDir, nullptr));
+    TS_ASSERT_EQUALS(cache.trajectories().size(), 3);
+  }
+
+  void test_solid_angle_and_flux_index_are_looked_up_by_detector_id() {
+    auto ws =
+        WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(3, 1);
+    auto solidAngleWS =
+        WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(3, 1);
+    for (size_t i = 0; i < 3; ++i) {
+      solidAngleWS->mutableY(i)[0] = static_cast<double>(i) + 1.0;
+    }
+    auto fluxWS =
+        WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(3, 2);
+    MDNormTrajectoryCache cache;
+    cache.update(*ws, m_samplePos, m_beamDir, solidAngleWS.get(),
+                 fluxWS.get());
+
+    const auto &trajectories = cache.trajectories();
+    TS_ASSERT_EQUALS(trajectories.size(), 3);
+    for (size_t i = 0; i < trajectories.size(); ++i) {
+      TS_ASSERT_EQUALS(trajectories[i].solidAngle, static_cast<double>(i) + 1);
+      TS_ASSERT_EQUALS(trajectories[i].fluxIndex, i);
+    }
+  }
+
+  void test_detector_missing_from_the_flux_workspace_throws() {
+    auto ws =
+        WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(3, 1);
+    auto fluxWS =
+        WorkspaceCreationHelper::create2DWorkspaceWithFullInstrument(2, 2);
+    MDNormTrajectoryCache cache;
+    TS_ASSERT_THROWS(
+        cache.update(*ws, m_samplePos, m_beamDir, nullptr, fluxWS.get()),
+        std::invalid_argument);
+  }
+
+  void test_intersection_buffers_keep_their_capacity() {
+    MDNormTrajectoryCache cache;
+    cache.reserveThreads(2);
+    auto &buffer = cache.intersections(1);
+    buffer.resize(10);
+    buffer.clear();
+    cache.reserveThreads(1);
+    TS_ASSERT_LESS_THAN_EQUALS(10, cache.intersections(1).capacity());
+  }
+
+private:
+  const V3D m_samplePos{0.0, 0.0, 0.0};
+  const V3D m_beamDir{0.0, 0.0, 1.0};
+};
+
+#endif /* MANTID_MDALGORITHMS_MDNORMTRAJECTORYCACHETEST_H_ */
@@ -27,7 +27,13 @@ public:
 
   void test_exec_fileBacked() { do_test_exec("MergeMDFilesTest_OutputWS.nxs"); }
 
-  void do_test_exec(std::string OutputFilename) {
+  void test_exec_parallel() { do_test_exec("", true); }
+
+  void test_exec_parallel_fileBacked() {
+    do_test_exec("MergeMDFilesTest_OutputWS.nxs", true);
+  }
+
+  void do_test_exec(std::string OutputFilename, bool parallel = false) {
     if (OutputFilename != "") {
       if (Poco::File(OutputFilename).exists())
         Poco::File(OutputFilename).remove();
@@ -63,6 +69,9 @@ public:
         alg.setPropertyValue("OutputFilename", OutputFilename));
     TS_ASSERT_THROWS_NOTHING(
         alg.setPropertyValue("OutputWorkspace", outWSName));
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("Parallel", parallel));
+    // Stream the boxes in many small windows
+    TS_ASSERT_THROWS_NOTHING(alg.setProperty("MaxEventsInMemory", 200));
 
     // clean up possible rubbish from previous runs
     std::string fullName = alg.getPropertyValue("OutputFilename");
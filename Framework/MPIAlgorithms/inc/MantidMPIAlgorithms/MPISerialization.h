@@ -81,6 +81,27 @@ void save(Archive &ar, const Mantid::DataObjects::EventList &elist,
     }
     break;
   }
+  case Mantid::API::COMPACT_WEIGHTED_NOTIME: {
+    etype = 4;
+    ar &etype;
+    std::vector<Mantid::DataObjects::CompactWeightedEventNoTime> events =
+        elist.getCompactWeightedEventsNoTime();
+    int evsize = static_cast<int>(events.size());
+    ar &evsize;
+    std::vector<Mantid::DataObjects::CompactWeightedEventNoTime>::iterator
+        itev;
+    std::vector<Mantid::DataObjects::CompactWeightedEventNoTime>::iterator
+        itev_end = events.end();
+    for (itev = events.begin(); itev != itev_end; ++itev) {
+      double tof = itev->tof();
+      ar &tof;
+      double weight = itev->weight();
+      ar &weight;
+      double errSq = itev->errorSquared();
+      ar &errSq;
+    }
+    break;
+  }
   }
 }
 template <class Archive>
@@ -139,6 +160,21 @@ void load(Archive &ar, Mantid::DataObjects::EventList &elist,
     elist = Mantid::DataObjects::EventList(mylist);
     break;
   }
+  case 4: {
+    std::vector<Mantid::DataObjects::CompactWeightedEventNoTime> mylist;
+    double tof = 0.0;
+    double weight = 0.0;
+    double errSq = 0.0;
+    for (int ev = 0; ev < evsize; ev++) {
+      ar &tof;
+      ar &weight;
+      ar &errSq;
+      mylist.push_back(
+          Mantid::DataObjects::CompactWeightedEventNoTime(tof, weight, errSq));
+    }
+    elist = Mantid::DataObjects::EventList(mylist);
+    break;
+  }
   }
 }
 // load data required for construction and invoke constructor in place
@@ -0,0 +1,86 @@
+#ifndef MANTID_NEXUS_COMPRESSEDCHUNKWRITER_H_
+#define MANTID_NEXUS_COMPRESSEDCHUNKWRITER_H_
+
+#include "MantidKernel/System.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Mantid {
+namespace NeXus {
+
+/** CompressedChunkWriter : Writes one dimensional arrays into a group of an
+  HDF5 (NeXus) file as chunked datasets with the standard shuffle and deflate
+  filters, so that any HDF5 reader can decompress them.
+
+  Unlike letting the HDF5 library apply the filters, which compresses one
+  chunk at a time on the calling thread, the chunks are shuffled and deflated
+  in parallel and then written with direct chunk writes. Only the writes
+  themselves are serial.
+
+  The file may already be open through the NeXus API, e.g. by NexusFileIO:
+  the HDF5 library shares the open file between both handles.
+
+  Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class DLLExport CompressedChunkWriter {
+public:
+  /// Default size of a chunk before compression, in bytes
+  static const size_t DEFAULT_CHUNK_BYTES = 4 * 1024 * 1024;
+
+  CompressedChunkWriter(const std::string &filename,
+                        const std::string &groupPath,
+                        const size_t chunkBytes = DEFAULT_CHUNK_BYTES,
+                        const int level = 1);
+  ~CompressedChunkWriter();
+  CompressedChunkWriter(const CompressedChunkWriter &) = delete;
+  CompressedChunkWriter &operator=(const CompressedChunkWriter &) = delete;
+
+  void write(const std::string &name, const double *data,
+             const size_t length);
+  void write(const std::string &name, const float *data, const size_t length);
+  void write(const std::string &name, const int64_t *data,
+             const size_t length);
+
+  static std::vector<char> compressChunk(const char *data, const size_t bytes,
+                                         const size_t elementSize,
+                                         const int level);
+
+private:
+  template <typename T>
+  void writeData(const std::string &name, const T *data, const size_t length);
+
+  /// HDF5 identifier of the file
+  int64_t m_file;
+  /// HDF5 identifier of the group the datasets are created in
+  int64_t m_group;
+  /// Size of a chunk before compression, in bytes
+  const size_t m_chunkBytes;
+  /// Deflate compression level, 1 (fastest) to 9 (smallest)
+  const int m_level;
+};
+
+} // namespace NeXus
+} // namespace Mantid
+
+#endif /* MANTID_NEXUS_COMPRESSEDCHUNKWRITER_H_ */
@@ -0,0 +1,224 @@
+#include "MantidNexus/CompressedChunkWriter.h"
+#include "MantidKernel/Exception.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <hdf5.h>
+#include <hdf5_hl.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+
+namespace Mantid {
+namespace NeXus {
+
+namespace {
+/// HDF5 type used in memory and in the file for each supported type
+template <typename T> hid_t getType();
+template <> hid_t getType<double>() { return H5T_NATIVE_DOUBLE; }
+template <> hid_t getType<float>() { return H5T_NATIVE_FLOAT; }
+template <> hid_t getType<int64_t>() { return H5T_NATIVE_INT64; }
+
+/// Number of chunks compressed per thread before they are written out. Limits
+/// the memory held by compressed chunks waiting to be written.
+const size_t CHUNKS_PER_THREAD = 4;
+} // namespace
+
+//----------------------------------------------------------------------------------------------
+/** Constructor. Opens the file for writing.
+ * @param filename :: the HDF5 file, which must exist
+ * @param groupPath :: absolute path of an existing group in the file, e.g.
+ *        /mantid_workspace_1/event_workspace
+ * @param chunkBytes :: size of a chunk before compression, in bytes
+ * @param level :: deflate compression level, 1 (fastest) to 9 (smallest)
+ * @throw Exception::FileError if the file or group cannot be opened
+ */
+CompressedChunkWriter::CompressedChunkWriter(const std::string &filename,
+                                             const std::string &groupPath,
+                                             const size_t chunkBytes,
+                                             const int level)
+    : m_file(-1), m_group(-1), m_chunkBytes(chunkBytes), m_level(level) {
+  // The close degree must match that of any other handle to the same file.
+  // The NeXus API uses H5F_CLOSE_STRONG.
+  const hid_t access = H5Pcreate(H5P_FILE_ACCESS);
+  H5Pset_fclose_degree(access, H5F_CLOSE_STRONG);
+  m_file = H5Fopen(filename.c_str(), H5F_ACC_RDWR, access);
+  H5Pclose(access);
+  if (m_file < 0)
+    throw Kernel::Exception::FileError("Unable to open file for writing",
+                                       filename);
+  m_group = H5Gopen2(m_file, groupPath.c_str(), H5P_DEFAULT);
+  if (m_group < 0) {
+    H5Fclose(m_file);
+    throw Kernel::Exception::FileError("Unable to open group " + groupPath +
+                                           " in file",
+                                       filename);
+  }
+}
+
+/// Destructor. Closes the group and the handle to the file.
+CompressedChunkWriter::~CompressedChunkWriter() {
+  H5Gclose(m_group);
+  H5Fclose(m_file);
+}
+
+/** Write an array as a new compressed dataset
+ * @param name :: name of the dataset
+ * @param data :: the values to write
+ * @param length :: number of values
+ */
+void CompressedChunkWriter::write(const std::string &name, const double *data,
+                                  const size_t length) {
+  writeData(name, data, length);
+}
+
+/// Write an array of single precision values as a new compressed dataset
+void CompressedChunkWriter::write(const std::string &name, const float *data,
+                                  const size_t length) {
+  writeData(name, data, length);
+}
+
+/// Write an array of 64 bit integers as a new compressed dataset
+void CompressedChunkWriter::write(const std::string &name, const int64_t *data,
+                                  const size_t length) {
+  writeData(name, data, length);
+}
+
+/** Apply the HDF5 shuffle and deflate filters to a chunk. The output is what
+ * the HDF5 library would store for a dataset created with H5Pset_shuffle
+ * followed by H5Pset_deflate.
+ * @param data :: the chunk
+ * @param bytes :: size of the chunk in bytes
+ * @param elementSize :: size of one value in bytes
+ * @param level :: deflate compression level
+ * @return the compressed chunk
+ * @throw std::runtime_error if zlib fails
+ */
+std::vector<char> CompressedChunkWriter::compressChunk(const char *data,
+                                                       const size_t bytes,
+                                                       const size_t elementSize,
+                                                       const int level) {
+  // Shuffle: group the first byte of every value, then the second and so on.
+  // The high bytes of neighbouring values are often equal and compress well.
+  const size_t count = bytes / elementSize;
+  std::vector<Bytef> shuffled(bytes);
+  for (size_t byte = 0; byte < elementSize; ++byte) {
+    auto out = shuffled.data() + byte * count;
+    for (size_t i = 0; i < count; ++i)
+      out[i] = static_cast<Bytef>(data[i * elementSize + byte]);
+  }
+  // Any trailing bytes that do not form a whole value are left in place
+  std::copy(data + count * elementSize, data + bytes,
+            shuffled.begin() + count * elementSize);
+
+  uLongf compressedBytes = compressBound(static_cast<uLong>(bytes));
+  std::vector<char> compressed(compressedBytes);
+  if (compress2(reinterpret_cast<Bytef *>(compressed.data()), &compressedBytes,
+                shuffled.data(), static_cast<uLong>(bytes), level) != Z_OK)
+    throw std::runtime_error("Failed to compress a chunk of data");
+  compressed.resize(compressedBytes);
+  return compressed;
+}
+
+/** Create the dataset, compress its chunks in parallel and write them
+ * @param name :: name of the dataset
+ * @param data :: the values to write
+ * @param length :: number of values
+ * @throw std::runtime_error if the dataset cannot be written
+ */
+template <typename T>
+void CompressedChunkWriter::writeData(const std::string &name, const T *data,
+                                      const size_t length) {
+  if (length == 0) {
+    // A chunked dataset needs chunks of at least one value, which can not be
+    // larger than an empty dataset. Store it contiguous instead.
+    const hsize_t dims[1] = {0};
+    const hid_t space = H5Screate_simple(1, dims, nullptr);
+    const hid_t dataset = H5Dcreate2(m_group, name.c_str(), getType<T>(),
+                                     space, H5P_DEFAULT, H5P_DEFAULT,
+                                     H5P_DEFAULT);
+    H5Sclose(space);
+    if (dataset < 0)
+      throw std::runtime_error("Unable to create dataset " + name);
+    H5Dclose(dataset);
+    return;
+  }
+
+  const size_t chunkLength =
+      std::max(size_t(1), std::min(m_chunkBytes / sizeof(T), length));
+  const hsize_t dims[1] = {length};
+  const hsize_t chunkDims[1] = {chunkLength};
+
+  const hid_t space = H5Screate_simple(1, dims, nullptr);
+  const hid_t properties = H5Pcreate(H5P_DATASET_CREATE);
+  H5Pset_chunk(properties, 1, chunkDims);
+  H5Pset_shuffle(properties);
+  H5Pset_deflate(properties, static_cast<unsigned>(m_level));
+  const hid_t dataset = H5Dcreate2(m_group, name.c_str(), getType<T>(), space,
+                                   H5P_DEFAULT, properties, H5P_DEFAULT);
+  H5Pclose(properties);
+  H5Sclose(space);
+  if (dataset < 0)
+    throw std::runtime_error("Unable to create dataset " + name);
+
+  const size_t chunkBytes = chunkLength * sizeof(T);
+  const size_t numChunks = (length + chunkLength - 1) / chunkLength;
+  const size_t batchSize =
+      CHUNKS_PER_THREAD * static_cast<size_t>(PARALLEL_GET_MAX_THREADS);
+  std::vector<std::vector<char>> compressed(std::min(batchSize, numChunks));
+  std::exception_ptr error;
+  bool writeFailed = false;
+
+  for (size_t first = 0; first < numChunks && !writeFailed;
+       first += batchSize) {
+    const auto batch =
+        static_cast<int64_t>(std::min(batchSize, numChunks - first));
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t i = 0; i < batch; ++i) {
+      try {
+        const size_t chunk = first + static_cast<size_t>(i);
+        const auto start =
+            reinterpret_cast<const char *>(data + chunk * chunkLength);
+        const size_t values =
+            std::min(chunkLength, length - chunk * chunkLength);
+        if (values == chunkLength) {
+          compressed[i] = compressChunk(start, chunkBytes, sizeof(T), m_level);
+        } else {
+          // The last chunk is stored at full size, padded with zeros
+          std::vector<char> padded(chunkBytes, 0);
+          std::memcpy(padded.data(), start, values * sizeof(T));
+          compressed[i] =
+              compressChunk(padded.data(), chunkBytes, sizeof(T), m_level);
+        }
+      } catch (...) {
+        PARALLEL_CRITICAL(CompressedChunkWriter_error) {
+          error = std::current_exception();
+        }
+      }
+    }
+    if (error)
+      break;
+
+    // HDF5 is not thread safe, so the writes are made from this thread
+    for (int64_t i = 0; i < batch; ++i) {
+      const hsize_t offset[1] = {(first + static_cast<size_t>(i)) *
+                                 chunkLength};
+      if (H5DOwrite_chunk(dataset, H5P_DEFAULT, 0, offset, compressed[i].size(),
+                          compressed[i].data()) < 0) {
+        writeFailed = true;
+        break;
+      }
+    }
+  }
+  H5Dclose(dataset);
+
+  if (error)
+    std::rethrow_exception(error);
+  if (writeFailed)
+    throw std::runtime_error("Unable to write a chunk of dataset " + name);
+}
+
+} // namespace NeXus
+} // namespace Mantid
@@ -20,6 +20,7 @@
 #include "MantidKernel/Unit.h"
 #include "MantidKernel/UnitFactory.h"
 #include "MantidKernel/VectorHelper.h"
+#include "MantidNexus/CompressedChunkWriter.h"
 #include "MantidNexus/NexusFileIO.h"
 
 #include <Poco/File.h>
@@ -757,18 +758,35 @@ int NexusFileIO::writeNexusProcessedDataEventCombined(
     NXclosedata(fileID);
   }
 
-  // Write out each field
-  dims_array[0] = static_cast<int>(
-      indices.back()); // TODO big truncation error! This is the # of events
-  if (tofs)
-    NXwritedata("tof", NX_FLOAT64, 1, dims_array, tofs, compress);
-  if (pulsetimes)
-    NXwritedata("pulsetime", NX_INT64, 1, dims_array, pulsetimes, compress);
-  if (weights)
-    NXwritedata("weight", NX_FLOAT32, 1, dims_array, weights, compress);
-  if (errorSquareds)
-    NXwritedata("error_squared", NX_FLOAT32, 1, dims_array, errorSquareds,
-                compress);
+  if (compress && m_nexuscompression != NX_COMP_NONE) {
+    // Compress the fields in parallel rather than one chunk at a time in the
+    // NeXus library, and write them through HDF5 into the open group
+    NXlink group;
+    NXgetgroupID(fileID, &group);
+    CompressedChunkWriter writer(m_filename, group.targetPath);
+    const auto numEvents = static_cast<size_t>(indices.back());
+    if (tofs)
+      writer.write("tof", tofs, numEvents);
+    if (pulsetimes)
+      writer.write("pulsetime", pulsetimes, numEvents);
+    if (weights)
+      writer.write("weight", weights, numEvents);
+    if (errorSquareds)
+      writer.write("error_squared", errorSquareds, numEvents);
+  } else {
+    // Write out each field
+    dims_array[0] = static_cast<int>(
+        indices.back()); // TODO big truncation error! This is the # of events
+    if (tofs)
+      NXwritedata("tof", NX_FLOAT64, 1, dims_array, tofs, compress);
+    if (pulsetimes)
+      NXwritedata("pulsetime", NX_INT64, 1, dims_array, pulsetimes, compress);
+    if (weights)
+      NXwritedata("weight", NX_FLOAT32, 1, dims_array, weights, compress);
+    if (errorSquareds)
+      NXwritedata("error_squared", NX_FLOAT32, 1, dims_array, errorSquareds,
+                  compress);
+  }
 
   // Close up the overall group
   NXstatus status = NXclosegroup(fileID);
@@ -913,6 +931,12 @@ int NexusFileIO::writeEventList(const DataObjects::EventList &el,
     eventType = "WEIGHTED_NOTIME";
     writeEventListData(el.getWeightedEventsNoTime(), true, false, true, true);
     break;
+  case COMPACT_WEIGHTED_NOTIME:
+    // Stored like WEIGHTED_NOTIME, which is what loaders know about
+    eventType = "WEIGHTED_NOTIME";
+    writeEventListData(el.getCompactWeightedEventsNoTime(), true, false, true,
+                       true);
+    break;
   }
 
   // --- Save the type of sorting -----
@@ -6,6 +6,7 @@
 #include <boost/python/register_ptr_to_python.hpp>
 #include <vector>
 
+using Mantid::API::COMPACT_WEIGHTED_NOTIME;
 using Mantid::API::EventType;
 using Mantid::API::IEventList;
 using Mantid::API::TOF;
@@ -27,6 +28,7 @@ void export_IEventList() {
       .value("TOF", TOF)
       .value("WEIGHTED", WEIGHTED)
       .value("WEIGHTED_NOTIME", WEIGHTED_NOTIME)
+      .value("COMPACT_WEIGHTED_NOTIME", COMPACT_WEIGHTED_NOTIME)
       .export_values();
 
   class_<IEventList, bases<Mantid::API::ISpectrum>, boost::noncopyable>(
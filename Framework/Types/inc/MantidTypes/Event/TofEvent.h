@@ -9,6 +9,7 @@ namespace DataObjects {
 class EventList;
 class WeightedEvent;
 class WeightedEventNoTime;
+class CompactWeightedEventNoTime;
 } // namespace DataObjects
 namespace DataHandling {
 class LoadEventNexus;
@@ -27,6 +28,7 @@ class MANTID_TYPES_DLL TofEvent {
   friend class DataObjects::EventList;
   friend class DataObjects::WeightedEvent;
   friend class DataObjects::WeightedEventNoTime;
+  friend class DataObjects::CompactWeightedEventNoTime;
   friend class DataHandling::LoadEventNexus; // Needed while the ISIS hack of
                                              // spreading events out in a bin
                                              // remains